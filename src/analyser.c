@@ -11,10 +11,15 @@
 #include "analyser.h"
 
 #include <assert.h>
+#include <pthread.h>
+#include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "ast.h"
+#include "builtins.h"
 #include "printAST.h"
 #include "symtable.h"
 
@@ -27,22 +32,31 @@
 		}                                 \
 	} while (0)
 
+#define ANALYSIS_ERROR_LENGTH 256
+#define ANALYSIS_JOBS_PER_THREAD 8	// smaller programs are analysed on the main thread only
+#define ANALYSIS_MAX_THREADS 64
+
+// state of one analysing thread
+// function bodies are analysed concurrently, each worker has its own scopes and error message
+typedef struct {
+	symbolTableStack varStack;
+	const astFunctionDefinition* currentFunction;
+	bool impure;  // current function does input or output or accesses global variables
+	char error[ANALYSIS_ERROR_LENGTH];	// message of the reported error, printed by analyseProgram
+} analysisContext;
+
 // forward decl
-static analysisResult analyseStatementBlock(const astStatementBlock*);
-static analysisResult analyseExpression(const astExpression*, astDataType* outType);
-
-static symbolTableStack VAR_SYM_STACK;
-static symbolTable* FUNC_SYM_TABLE;
-static const astFunctionDefinition* CURRENT_FUNCTION;
-
-// builtin functions
-static astParameterList EMPTY_PARAMS;
-static astParameterList INT2DOUBLE_PARAMS;
-static astParameterList DOUBLE2INT_PARAMS;
-static astParameterList LENGTH_PARAMS;
-static astParameterList SUBSTRING_PARAMS;
-static astParameterList ORD_PARAMS;
-static astParameterList CHR_PARAMS;
+static analysisResult analyseStatementBlock(analysisContext*, astStatementBlock*);
+static analysisResult analyseExpression(analysisContext*, astExpression*, astDataType* outType);
+
+static symbolFuncTable* FUNC_SYM_TABLE;	 // read only after registration pass, shared by workers
+
+static void reportError(analysisContext* ctx, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	vsnprintf(ctx->error, ANALYSIS_ERROR_LENGTH, format, args);
+	va_end(args);
+}
 
 // checks if type is easily convertible (nil to nullable, nonull to nullable)
 bool isTriviallyConvertible(astDataType to, astDataType from) {
@@ -61,30 +75,18 @@ bool isTriviallyConvertible(astDataType to, astDataType from) {
 	return to.type == from.type;
 }
 
-// recursively check if an expression contains a variable inside
-bool containsVariable(const astExpression* expr) {
-	switch (expr->type) {
-		case AST_EXPR_TERM:
-			return (expr->term.type == AST_TERM_ID);
-		case AST_EXPR_BINARY:
-			return (containsVariable(expr->binary.lhs) || containsVariable(expr->binary.rhs));
-		case AST_EXPR_UNWRAP:
-			return containsVariable(expr->unwrap.innerExpr);
-	}
-	assert(false);
-}
-
 bool isNumberType(astDataType type) { return (type.type == AST_TYPE_INT || type.type == AST_TYPE_DOUBLE); }
 
 bool isNoNullNumberType(astDataType type) { return !type.nullable && isNumberType(type); }
 
-static analysisResult analyseBinaryExpression(const astBinaryExpression* expression, astDataType* outType) {
+static analysisResult analyseBinaryExpression(analysisContext* ctx, astBinaryExpression* expression,
+											  astDataType* outType) {
 	astDataType lhsType;
 	astDataType rhsType;
-	ANALYSE(analyseExpression(expression->lhs, &lhsType), {});
-	ANALYSE(analyseExpression(expression->rhs, &rhsType), {});
-	bool lhsIsLiteral = !containsVariable(expression->lhs);
-	bool rhsIsLiteral = !containsVariable(expression->rhs);
+	ANALYSE(analyseExpression(ctx, expression->lhs, &lhsType), {});
+	ANALYSE(analyseExpression(ctx, expression->rhs, &rhsType), {});
+	bool lhsIsLiteral = expression->lhs->isLiteral;
+	bool rhsIsLiteral = expression->rhs->isLiteral;
 
 	switch (expression->op) {
 		case AST_BINARY_PLUS:
@@ -98,8 +100,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 		case AST_BINARY_DIV:
 		case AST_BINARY_MINUS:
 			if (!isNoNullNumberType(lhsType) || !isNoNullNumberType(rhsType)) {
-				fputs("Incompatible types for binary operation. ", stderr);
-				printBinaryOperator(expression->op, stderr);
+				reportError(ctx, "Incompatible types for binary operation. %s", binaryOperatorName(expression->op));
 				return ANALYSIS_WRONG_BINARY_TYPES;
 			}
 			if (lhsType.type == rhsType.type) {
@@ -108,7 +109,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 			} else {
 				if ((lhsType.type == AST_TYPE_DOUBLE && !rhsIsLiteral) ||
 					(rhsType.type == AST_TYPE_DOUBLE && !lhsIsLiteral)) {
-					fputs("Illegal implicit conversion.", stderr);
+					reportError(ctx, "Illegal implicit conversion.");
 					return ANALYSIS_WRONG_BINARY_TYPES;
 				}
 				outType->type = AST_TYPE_DOUBLE;
@@ -123,8 +124,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 				!rhsType.nullable) {
 				// string compare, OK
 			} else if (!isNoNullNumberType(lhsType) || !isNoNullNumberType(rhsType)) {
-				fputs("Incompatible types for binary operation. ", stderr);
-				printBinaryOperator(expression->op, stderr);
+				reportError(ctx, "Incompatible types for binary operation. %s", binaryOperatorName(expression->op));
 				return ANALYSIS_WRONG_BINARY_TYPES;
 			}
 
@@ -133,7 +133,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 			} else {
 				if ((lhsType.type == AST_TYPE_DOUBLE && !rhsIsLiteral) ||
 					(rhsType.type == AST_TYPE_DOUBLE && !lhsIsLiteral)) {
-					fputs("Illegal implicit conversion.", stderr);
+					reportError(ctx, "Illegal implicit conversion.");
 					return ANALYSIS_WRONG_BINARY_TYPES;
 				}
 			}
@@ -150,8 +150,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 				// OK
 			} else if ((lhsType.type == AST_TYPE_DOUBLE && !rhsIsLiteral) ||
 					   (rhsType.type == AST_TYPE_DOUBLE && !lhsIsLiteral)) {
-				fputs("Incompatible types for binary operation. ", stderr);
-				printBinaryOperator(expression->op, stderr);
+				reportError(ctx, "Incompatible types for binary operation. %s", binaryOperatorName(expression->op));
 				return ANALYSIS_WRONG_BINARY_TYPES;
 			}
 			outType->type = AST_TYPE_BOOL;
@@ -164,7 +163,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 				outType->type = rhsType.type;
 			} else {
 				if (!lhsType.nullable) {
-					fputs("Left side of nil coalescing operator must be nullable.", stderr);
+					reportError(ctx, "Left side of nil coalescing operator must be nullable.");
 					return ANALYSIS_WRONG_BINARY_TYPES;
 				}
 				if (lhsType.type == rhsType.type) {
@@ -175,7 +174,7 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 					// conversion, ok
 					outType->type = AST_TYPE_DOUBLE;
 				} else {
-					fputs("Incompatible types for binary operation. ", stderr);
+					reportError(ctx, "Incompatible types for binary operation. ");
 					return ANALYSIS_WRONG_BINARY_TYPES;
 				}
 			}
@@ -184,14 +183,19 @@ static analysisResult analyseBinaryExpression(const astBinaryExpression* express
 			break;
 	}
 
+	// int operand meeting a double one is converted (the checks above only allow this for literals)
+	expression->convertLhs = (lhsType.type == AST_TYPE_INT && rhsType.type == AST_TYPE_DOUBLE);
+	expression->convertRhs = (lhsType.type == AST_TYPE_DOUBLE && rhsType.type == AST_TYPE_INT);
+
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseUnwrapExpression(const astUnwrapExpression* expression, astDataType* outType) {
-	ANALYSE(analyseExpression(expression->innerExpr, outType), {});
+static analysisResult analyseUnwrapExpression(analysisContext* ctx, astUnwrapExpression* expression,
+											  astDataType* outType) {
+	ANALYSE(analyseExpression(ctx, expression->innerExpr, outType), {});
 
 	if (!outType->nullable) {
-		fputs("Cannot unwrap non-nullable value.", stderr);
+		reportError(ctx, "Cannot unwrap non-nullable value.");
 		return ANALYSIS_WRONG_BINARY_TYPES;
 	}
 
@@ -199,15 +203,31 @@ static analysisResult analyseUnwrapExpression(const astUnwrapExpression* express
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseVariableId(const astIdentifier* id, astDataType* outType) {
-	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, id->name, NULL);
+// global variables can change between calls of a function, so functions using them are not pure
+static void noteVariableAccess(analysisContext* ctx, const symbolScope* scope) {
+	if (ctx->currentFunction && scope == symStackGlobalScope(&ctx->varStack)) {
+		ctx->impure = true;
+	}
+}
+
+// input and output builtins are the only source of side effects
+static void noteFunctionCall(analysisContext* ctx, int funcId) {
+	if (funcId == SYM_FUNC_NONE || (isBuiltinFunction(funcId) && !BUILTINS[funcId].pure)) {
+		ctx->impure = true;
+	}
+}
+
+static analysisResult analyseVariableId(analysisContext* ctx, const astIdentifier* id, astDataType* outType) {
+	symbolScope* scope;
+	symbolTableSlot* slot = symStackLookup(&ctx->varStack, id->name, &scope);
 	if (!slot) {
-		fprintf(stderr, "Usage of undefined variable %s\n", id->name);
+		reportError(ctx, "Usage of undefined variable %s\n", id->name);
 		return ANALYSIS_UNDEFINED_VAR;
 	} else if (!slot->variable.initialisedInScope) {
-		fprintf(stderr, "Usage of uninitialised variable %s\n", id->name);
+		reportError(ctx, "Usage of uninitialised variable %s\n", id->name);
 		return ANALYSIS_UNDEFINED_VAR;
 	}
+	noteVariableAccess(ctx, scope);
 
 	if (outType) {
 		*outType = slot->variable.type;
@@ -216,7 +236,7 @@ static analysisResult analyseVariableId(const astIdentifier* id, astDataType* ou
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseTerm(const astTerm* term, astDataType* outType) {
+static analysisResult analyseTerm(analysisContext* ctx, const astTerm* term, astDataType* outType) {
 	astDataType dummyDataType;	// used when function is called without an outType
 	if (!outType) {
 		outType = &dummyDataType;
@@ -224,7 +244,7 @@ static analysisResult analyseTerm(const astTerm* term, astDataType* outType) {
 
 	switch (term->type) {
 		case AST_TERM_ID:
-			ANALYSE(analyseVariableId(&term->identifier, outType), {});
+			ANALYSE(analyseVariableId(ctx, &term->identifier, outType), {});
 			break;
 		case AST_TERM_INT:
 			outType->type = AST_TYPE_INT;
@@ -242,24 +262,32 @@ static analysisResult analyseTerm(const astTerm* term, astDataType* outType) {
 			outType->type = AST_TYPE_STRING;
 			outType->nullable = false;
 			break;
+		case AST_TERM_BOOL:
+			outType->type = AST_TYPE_BOOL;
+			outType->nullable = false;
+			break;
 	}
 
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseExpression(const astExpression* expression, astDataType* outType) {
+static analysisResult analyseExpression(analysisContext* ctx, astExpression* expression, astDataType* outType) {
 	switch (expression->type) {
 		case AST_EXPR_TERM: {
-			ANALYSE(analyseTerm(&expression->term, outType), {});
+			ANALYSE(analyseTerm(ctx, &expression->term, outType), {});
+			expression->isLiteral = (expression->term.type != AST_TERM_ID);
 			break;
 		}
 		case AST_EXPR_BINARY:
-			ANALYSE(analyseBinaryExpression(&expression->binary, outType), {});
+			ANALYSE(analyseBinaryExpression(ctx, &expression->binary, outType), {});
+			expression->isLiteral = expression->binary.lhs->isLiteral && expression->binary.rhs->isLiteral;
 			break;
 		case AST_EXPR_UNWRAP:
-			ANALYSE(analyseUnwrapExpression(&expression->unwrap, outType), {});
+			ANALYSE(analyseUnwrapExpression(ctx, &expression->unwrap, outType), {});
+			expression->isLiteral = expression->unwrap.innerExpr->isLiteral;
 			break;
 	}
+	expression->dataType = *outType;
 	return ANALYSIS_OK;
 }
 
@@ -281,144 +309,156 @@ static bool returnsInAllPaths(const astStatementBlock* body) {
 	return false;
 }
 
-static analysisResult analyseFunctionDef(const astFunctionDefinition* def) {
-	CURRENT_FUNCTION = def;
-	symStackPush(&VAR_SYM_STACK);
+static analysisResult analyseFunctionDef(analysisContext* ctx, astFunctionDefinition* def) {
+	ctx->currentFunction = def;
+	ctx->impure = false;
+	if (!symStackPush(&ctx->varStack)) {
+		return ANALYSIS_INTERNAL_ERROR;
+	}
 	// add params to scope
 	for (int i = 0; i < def->params.count; i++) {
 		astParameter* param = &def->params.data[i];
 		if (param->used) {
-			symbolVariable symbol = {param->dataType, true, symStackCurrentScope(&VAR_SYM_STACK)};
-			if (!symTableInsertVar(symStackCurrentScope(&VAR_SYM_STACK), symbol, param->insideName.name, true)) {
+			symbolVariable symbol = {param->dataType, true, symStackCurrentScope(&ctx->varStack), NULL};
+			if (!symStackInsertVar(&ctx->varStack, symbol, param->insideName.name)) {
 				return ANALYSIS_INTERNAL_ERROR;
 			}
 		}
 		if (strcmp(param->insideName.name, param->outsideName.name) == 0) {
-			printf("parameter %s of function %s cannot have same name and id.\n", param->outsideName.name,
-				   def->name.name);
+			reportError(ctx, "parameter %s of function %s cannot have same name and id.\n", param->outsideName.name,
+						def->name.name);
 			return ANALYSIS_OTHER_ERROR;
 		}
 	}
-	ANALYSE(analyseStatementBlock(&def->body), {});
+	ANALYSE(analyseStatementBlock(ctx, &def->body), {});
 	if (def->hasReturnValue && !returnsInAllPaths(&def->body)) {
-		fputs("Function does not return in all paths.\n", stderr);
+		reportError(ctx, "Function does not return in all paths.\n");
 		return ANALYSIS_OTHER_ERROR;
 	}
-	symStackPop(&VAR_SYM_STACK);
-	CURRENT_FUNCTION = NULL;
+	symStackPop(&ctx->varStack);
+	ctx->currentFunction = NULL;
+	def->pure = !ctx->impure;  // callees are checked by propagateImpurity
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseAssignment(const astAssignment* assignment) {
-	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, assignment->variableName.name, NULL);
+static analysisResult analyseAssignment(analysisContext* ctx, astAssignment* assignment) {
+	symbolScope* scope;
+	symbolTableSlot* slot = symStackLookup(&ctx->varStack, assignment->variableName.name, &scope);
 	// check if variable exists
 	if (!slot) {
-		fprintf(stderr, "Usage of undefined variable %s\n", assignment->variableName.name);
+		reportError(ctx, "Usage of undefined variable %s\n", assignment->variableName.name);
 		return ANALYSIS_UNDEFINED_VAR;
 	}
+	noteVariableAccess(ctx, scope);
 	// check if variable is mutable
 	if (slot->variable.immutable && slot->variable.initialisedInScope) {
-		fprintf(stderr, "Modification of immutable variable %s\n", assignment->variableName.name);
+		reportError(ctx, "Modification of immutable variable %s\n", assignment->variableName.name);
 		return ANALYSIS_OTHER_ERROR;
 	}
 
 	astDataType valueType;
-	ANALYSE(analyseExpression(&assignment->value, &valueType), {});
+	ANALYSE(analyseExpression(ctx, &assignment->value, &valueType), {});
 
+	assignment->convertValue = false;
 	if (isTriviallyConvertible(slot->variable.type, valueType)) {
 		// OK
 	} else if (slot->variable.type.type == AST_TYPE_DOUBLE && valueType.type == AST_TYPE_INT &&
-			   !containsVariable(&assignment->value)) {
+			   assignment->value.isLiteral) {
 		// convert int to double, ok
+		assignment->convertValue = true;
 	} else {
-		fprintf(stderr, "Wrong type in assignment to variable %s\n", slot->name);
+		reportError(ctx, "Wrong type in assignment to variable %s\n", slot->name);
 		return ANALYSIS_WRONG_BINARY_TYPES;
 	}
 
 	if (!slot->variable.initialisedInScope) {
-		slot->variable.initialisedInScope = symStackCurrentScope(&VAR_SYM_STACK);
+		symStackInitialiseVar(&ctx->varStack, slot);
 	}
 
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseOptionalBinding(const astOptionalBinding* binding) {
+static analysisResult analyseOptionalBinding(analysisContext* ctx, const astOptionalBinding* binding) {
 	astDataType variableType;
-	ANALYSE(analyseVariableId(&binding->identifier, &variableType), {});
+	ANALYSE(analyseVariableId(ctx, &binding->identifier, &variableType), {});
 	if (!variableType.nullable) {
-		fputs("Variable used in optional binding must be nullable.\n", stderr);
+		reportError(ctx, "Variable used in optional binding must be nullable.\n");
 		return ANALYSIS_OTHER_ERROR;  // NOTE - is this correct?
 	}
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseCondition(const astCondition* condition) {
+static analysisResult analyseCondition(analysisContext* ctx, astCondition* condition) {
 	if (condition->type == AST_CONDITION_EXPRESSION) {
 		astDataType conditionType;
-		ANALYSE(analyseExpression(&condition->expression, &conditionType), {});
+		ANALYSE(analyseExpression(ctx, &condition->expression, &conditionType), {});
 		if (conditionType.type != AST_TYPE_BOOL) {
-			fputs("Condition must be of boolean type.", stderr);
+			reportError(ctx, "Condition must be of boolean type.");
 			return ANALYSIS_WRONG_BINARY_TYPES;
 		}
 		if (conditionType.nullable) {
-			fputs("Condition must not be nullable.", stderr);
+			reportError(ctx, "Condition must not be nullable.");
 			return ANALYSIS_WRONG_BINARY_TYPES;
 		}
 	} else {
-		ANALYSE(analyseOptionalBinding(&condition->optBinding), {});
+		ANALYSE(analyseOptionalBinding(ctx, &condition->optBinding), {});
 	}
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseConditional(const astConditional* conditional) {
-	ANALYSE(analyseCondition(&conditional->condition), {});
+static analysisResult analyseConditional(analysisContext* ctx, astConditional* conditional) {
+	ANALYSE(analyseCondition(ctx, &conditional->condition), {});
 
 	if (conditional->condition.type == AST_CONDITION_OPT_BINDING) {
-		symStackPush(&VAR_SYM_STACK);
+		if (!symStackPush(&ctx->varStack)) {
+			return ANALYSIS_INTERNAL_ERROR;
+		}
 		// add new variable to shadow the original one (for optional binding)
 		const char* varName = conditional->condition.optBinding.identifier.name;
-		symbolTableSlot* varSlot = symStackLookup(&VAR_SYM_STACK, varName, NULL);
+		symbolTableSlot* varSlot = symStackLookup(&ctx->varStack, varName, NULL);
 		assert(varSlot);
 		symbolVariable newVar;
 		newVar.immutable = true;
 		newVar.type = varSlot->variable.type;
 		newVar.type.nullable = false;
 		newVar.initialisedInScope = varSlot->variable.initialisedInScope;
-		if (!symTableInsertVar(symStackCurrentScope(&VAR_SYM_STACK), newVar, varName, true)) {
+		newVar.constant = NULL;
+		if (!symStackInsertVar(&ctx->varStack, newVar, varName)) {
 			return ANALYSIS_INTERNAL_ERROR;
 		}
 
-		ANALYSE(analyseStatementBlock(&conditional->body), {});
-		symStackPop(&VAR_SYM_STACK);
+		ANALYSE(analyseStatementBlock(ctx, &conditional->body), {});
+		symStackPop(&ctx->varStack);
 	} else {
-		ANALYSE(analyseStatementBlock(&conditional->body), {});
+		ANALYSE(analyseStatementBlock(ctx, &conditional->body), {});
 	}
 
 	if (conditional->hasElse) {
-		ANALYSE(analyseStatementBlock(&conditional->bodyElse), {});
+		ANALYSE(analyseStatementBlock(ctx, &conditional->bodyElse), {});
 	}
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseIteration(const astIteration* iteration) {
+static analysisResult analyseIteration(analysisContext* ctx, astIteration* iteration) {
 	astDataType conditionType;
-	ANALYSE(analyseExpression(&iteration->condition, &conditionType), {});
+	ANALYSE(analyseExpression(ctx, &iteration->condition, &conditionType), {});
 	if (conditionType.type != AST_TYPE_BOOL) {
-		fputs("Condition must be of boolean type.\n", stderr);
+		reportError(ctx, "Condition must be of boolean type.\n");
 		return ANALYSIS_WRONG_BINARY_TYPES;
 	}
 	if (conditionType.nullable) {
-		fputs("Condition must not be nullable.\n", stderr);
+		reportError(ctx, "Condition must not be nullable.\n");
 		return ANALYSIS_WRONG_BINARY_TYPES;
 	}
 
-	ANALYSE(analyseStatementBlock(&iteration->body), {});
+	ANALYSE(analyseStatementBlock(ctx, &iteration->body), {});
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseInputParameterList(const astParameterList* list, const astInputParameterList* input) {
+static analysisResult analyseInputParameterList(analysisContext* ctx, const astParameterList* list,
+												const astInputParameterList* input) {
 	if (list->count != input->count) {
-		fputs("Wrong number of parameters.\n", stderr);
+		reportError(ctx, "Wrong number of parameters.\n");
 		return ANALYSIS_WRONG_FUNC_TYPE;
 	}
 
@@ -427,24 +467,24 @@ static analysisResult analyseInputParameterList(const astParameterList* list, co
 		astInputParameter* inParam = &input->data[i];
 		if (param->requiresName) {
 			if (!inParam->hasName) {
-				fprintf(stderr, "Parameter %s requires to be called explicitely.\n", param->outsideName.name);
+				reportError(ctx, "Parameter %s requires to be called explicitely.\n", param->outsideName.name);
 				return ANALYSIS_OTHER_ERROR;  // NOTE - is this correct?
 			}
 
 			if (strcmp(param->outsideName.name, inParam->name.name) != 0) {
-				fprintf(stderr, "Parameter names %s and %s don't match.\n", param->outsideName.name,
-						inParam->name.name);
+				reportError(ctx, "Parameter names %s and %s don't match.\n", param->outsideName.name,
+							inParam->name.name);
 				return ANALYSIS_WRONG_FUNC_TYPE;
 			}
 		} else if (inParam->hasName) {
-			fputs("Parameter does not require a name in function call.\n", stderr);
+			reportError(ctx, "Parameter does not require a name in function call.\n");
 			return ANALYSIS_OTHER_ERROR;  // NOTE - is this correct?
 		}
 
 		astDataType inParamType;
-		ANALYSE(analyseTerm(&inParam->value, &inParamType), {});
+		ANALYSE(analyseTerm(ctx, &inParam->value, &inParamType), {});
 		if (!isTriviallyConvertible(param->dataType, inParamType)) {
-			fprintf(stderr, "Wrong type passed to parameter %s\n", param->outsideName.name);
+			reportError(ctx, "Wrong type passed to parameter %s\n", param->outsideName.name);
 			return ANALYSIS_WRONG_FUNC_TYPE;
 		}
 	}
@@ -452,35 +492,40 @@ static analysisResult analyseInputParameterList(const astParameterList* list, co
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseFunctionCall(const astFunctionCall* call, bool ignoreVariable) {
+static analysisResult analyseFunctionCall(analysisContext* ctx, astFunctionCall* call, bool ignoreVariable) {
 	astDataType returnType = {AST_TYPE_NIL, false};
+	call->funcId = SYM_FUNC_NONE;
 	// check if function exists
 	if (strcmp(call->funcName.name, "write") != 0) {
-		symbolTableSlot* slot = symTableLookup(FUNC_SYM_TABLE, call->funcName.name);
-		if (!slot) {
-			fprintf(stderr, "Calling undefined function %s\n", call->funcName.name);
+		call->funcId = symFuncTableFind(FUNC_SYM_TABLE, call->funcName.name);
+		if (call->funcId == SYM_FUNC_NONE) {
+			reportError(ctx, "Calling undefined function %s\n", call->funcName.name);
 			return ANALYSIS_UNDEFINED_FUNC;
 		}
-		returnType = slot->function.returnType;
+		const symbolFunc* function = symFuncTableGet(FUNC_SYM_TABLE, call->funcId);
+		returnType = function->returnType;
 
-		ANALYSE(analyseInputParameterList(slot->function.params, &call->params), {});
+		ANALYSE(analyseInputParameterList(ctx, function->params, &call->params), {});
 	}
+	noteFunctionCall(ctx, call->funcId);
 
 	// check the variable
 	if (!ignoreVariable) {
-		symbolTableSlot* varSlot = symStackLookup(&VAR_SYM_STACK, call->varName.name, NULL);
+		symbolScope* scope;
+		symbolTableSlot* varSlot = symStackLookup(&ctx->varStack, call->varName.name, &scope);
 
 		if (!varSlot) {
-			fprintf(stderr, "Usage of undefined variable %s\n", call->varName.name);
+			reportError(ctx, "Usage of undefined variable %s\n", call->varName.name);
 			return ANALYSIS_UNDEFINED_VAR;
 		}
+		noteVariableAccess(ctx, scope);
 
 		if (!varSlot->variable.initialisedInScope) {
-			varSlot->variable.initialisedInScope = symStackCurrentScope(&VAR_SYM_STACK);
+			symStackInitialiseVar(&ctx->varStack, varSlot);
 		}
 
 		if (!isTriviallyConvertible(varSlot->variable.type, returnType)) {
-			fputs("Wrong return type.\n", stderr);
+			reportError(ctx, "Wrong return type.\n");
 			return ANALYSIS_WRONG_BINARY_TYPES;
 		}
 	}
@@ -488,33 +533,36 @@ static analysisResult analyseFunctionCall(const astFunctionCall* call, bool igno
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseProcedureCall(const astProcedureCall* call) {
+static analysisResult analyseProcedureCall(analysisContext* ctx, astProcedureCall* call) {
+	call->funcId = SYM_FUNC_NONE;
 	// check if function exists
 	if (strcmp(call->procName.name, "write") != 0) {
-		symbolTableSlot* slot = symTableLookup(FUNC_SYM_TABLE, call->procName.name);
-		if (!slot) {
-			fprintf(stderr, "Calling undefined function %s\n", call->procName.name);
+		call->funcId = symFuncTableFind(FUNC_SYM_TABLE, call->procName.name);
+		if (call->funcId == SYM_FUNC_NONE) {
+			reportError(ctx, "Calling undefined function %s\n", call->procName.name);
 			return ANALYSIS_UNDEFINED_FUNC;
 		}
 
-		ANALYSE(analyseInputParameterList(slot->function.params, &call->params), {});
+		const symbolFunc* function = symFuncTableGet(FUNC_SYM_TABLE, call->funcId);
+		ANALYSE(analyseInputParameterList(ctx, function->params, &call->params), {});
 	} else {
 		// procedure write - just analyse the terms used as parameters
 		for (int i = 0; i < call->params.count; i++) {
-			ANALYSE(analyseTerm(&(call->params.data[i].value), NULL), {});
+			ANALYSE(analyseTerm(ctx, &(call->params.data[i].value), NULL), {});
 		}
 	}
+	noteFunctionCall(ctx, call->funcId);
 
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseReturn(const astReturnStatement* ret) {
+static analysisResult analyseReturn(analysisContext* ctx, astReturnStatement* ret) {
 	if (ret->hasValue) {
 		astDataType returnType;
-		ANALYSE(analyseExpression(&ret->value, &returnType), {});
+		ANALYSE(analyseExpression(ctx, &ret->value, &returnType), {});
 
-		if (!isTriviallyConvertible(CURRENT_FUNCTION->returnType, returnType)) {
-			fputs("Incompatible return type.\n", stderr);
+		if (!isTriviallyConvertible(ctx->currentFunction->returnType, returnType)) {
+			reportError(ctx, "Incompatible return type.\n");
 			return ANALYSIS_WRONG_FUNC_TYPE;
 		}
 	}
@@ -522,37 +570,42 @@ static analysisResult analyseReturn(const astReturnStatement* ret) {
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseVariableDef(const astVariableDefinition* definition) {
+static analysisResult analyseVariableDef(analysisContext* ctx, astVariableDefinition* definition) {
 	// check for variable redefinition
-	symbolTable* scopePtr;
-	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, definition->variableName.name, &scopePtr);
-	if (slot && scopePtr == symStackCurrentScope(&VAR_SYM_STACK)) {
+	symbolScope* scopePtr;
+	symbolTableSlot* slot = symStackLookup(&ctx->varStack, definition->variableName.name, &scopePtr);
+	if (slot && scopePtr == symStackCurrentScope(&ctx->varStack)) {
 		// redefined
-		fprintf(stderr, "Variable redefinition: %s\n", definition->variableName.name);
+		reportError(ctx, "Variable redefinition: %s\n", definition->variableName.name);
 		return ANALYSIS_UNDEFINED_FUNC;
 	}
 
 	astDataType variableType = definition->variableType;
 	bool initialised = false;
+	definition->convertValue = false;
+	definition->nilInit = false;
 
 	if (definition->hasInitValue) {
 		initialised = true;
 		astDataType initValueType;
 
 		if (definition->value.type == AST_VAR_INIT_EXPR) {
-			ANALYSE(analyseExpression(&definition->value.expr, &initValueType), {});
+			ANALYSE(analyseExpression(ctx, &definition->value.expr, &initValueType), {});
 		} else {
-			ANALYSE(analyseFunctionCall(&definition->value.call, true), {});
-			// find function type in symtable
-			symbolTableSlot* funcSlot = symTableLookup(FUNC_SYM_TABLE, definition->value.call.funcName.name);
-			assert(funcSlot);
+			ANALYSE(analyseFunctionCall(ctx, &definition->value.call, true), {});
+			// function type
+			if (definition->value.call.funcId == SYM_FUNC_NONE) {
+				reportError(ctx, "Cannot assign from procedure to variable %s\n", definition->variableName.name);
+				return ANALYSIS_WRONG_BINARY_TYPES;
+			}
+			const symbolFunc* function = symFuncTableGet(FUNC_SYM_TABLE, definition->value.call.funcId);
 
-			if (funcSlot->function.returnType.type == AST_TYPE_NIL) {
-				fprintf(stderr, "Cannot assign from procedure to variable %s\n", definition->variableName.name);
+			if (function->returnType.type == AST_TYPE_NIL) {
+				reportError(ctx, "Cannot assign from procedure to variable %s\n", definition->variableName.name);
 				return ANALYSIS_WRONG_BINARY_TYPES;
 			}
 
-			initValueType = funcSlot->function.returnType;
+			initValueType = function->returnType;
 		}
 
 		if (definition->hasExplicitType) {
@@ -560,89 +613,83 @@ static analysisResult analyseVariableDef(const astVariableDefinition* definition
 				// OK
 			} else if (definition->variableType.type == AST_TYPE_DOUBLE &&
 					   definition->value.type == AST_VAR_INIT_EXPR && initValueType.type == AST_TYPE_INT &&
-					   !containsVariable(&definition->value.expr)) {
+					   definition->value.expr.isLiteral) {
 				// OK - convert from int to double
+				definition->convertValue = true;
 			} else {
-				fprintf(stderr, "Wrong type in initialisation of variable %s\n", definition->variableName.name);
+				reportError(ctx, "Wrong type in initialisation of variable %s\n", definition->variableName.name);
 				return ANALYSIS_WRONG_BINARY_TYPES;
 			}
 		} else {
 			if (initValueType.type == AST_TYPE_NIL) {
-				fprintf(stderr, "Cannot deduce nil type in initialisation of variable %s\n",
-						definition->variableName.name);
+				reportError(ctx, "Cannot deduce nil type in initialisation of variable %s\n",
+							definition->variableName.name);
 				return ANALYSIS_TYPE_DEDUCTION;
 			}
 
 			variableType = initValueType;
+			definition->variableType = variableType;  // deduced type
 		}
 	} else if (variableType.nullable) {
 		initialised = true;	 // nullable variables without init value are initialised to nil
+		definition->nilInit = true;
 	}
 
 	// insert into symtable
 	symbolVariable newVar = {variableType, definition->immutable,
-							 initialised ? symStackCurrentScope(&VAR_SYM_STACK) : NULL};
-	if (!symTableInsertVar(symStackCurrentScope(&VAR_SYM_STACK), newVar, definition->variableName.name, true)) {
+							 initialised ? symStackCurrentScope(&ctx->varStack) : NULL, NULL};
+	if (!symStackInsertVar(&ctx->varStack, newVar, definition->variableName.name)) {
 		return ANALYSIS_INTERNAL_ERROR;
 	}
 
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseStatement(const astStatement* statement) {
+static analysisResult analyseStatement(analysisContext* ctx, astStatement* statement) {
 	switch (statement->type) {
 		case AST_STATEMENT_VAR_DEF:
-			ANALYSE(analyseVariableDef(&statement->variableDef), {});
+			ANALYSE(analyseVariableDef(ctx, &statement->variableDef), {});
 			break;
 		case AST_STATEMENT_ASSIGN:
-			ANALYSE(analyseAssignment(&statement->assignment), {});
+			ANALYSE(analyseAssignment(ctx, &statement->assignment), {});
 			break;
 		case AST_STATEMENT_COND:
-			ANALYSE(analyseConditional(&statement->conditional), {});
+			ANALYSE(analyseConditional(ctx, &statement->conditional), {});
 			break;
 		case AST_STATEMENT_ITER:
-			ANALYSE(analyseIteration(&statement->iteration), {});
+			ANALYSE(analyseIteration(ctx, &statement->iteration), {});
 			break;
 		case AST_STATEMENT_FUNC_CALL:
-			ANALYSE(analyseFunctionCall(&statement->functionCall, false), {});
+			ANALYSE(analyseFunctionCall(ctx, &statement->functionCall, false), {});
 			break;
 		case AST_STATEMENT_PROC_CALL:
-			ANALYSE(analyseProcedureCall(&statement->procedureCall), {});
+			ANALYSE(analyseProcedureCall(ctx, &statement->procedureCall), {});
 			break;
 		case AST_STATEMENT_RETURN:
-			ANALYSE(analyseReturn(&statement->returnStmt), {});
+			ANALYSE(analyseReturn(ctx, &statement->returnStmt), {});
 			break;
 	}
 
 	return ANALYSIS_OK;
 }
 
-static analysisResult analyseStatementBlock(const astStatementBlock* block) {
-	symStackPush(&VAR_SYM_STACK);
-	for (int i = 0; i < block->count; i++) {
-		ANALYSE(analyseStatement(&block->statements[i]), {});
+static analysisResult analyseStatementBlock(analysisContext* ctx, astStatementBlock* block) {
+	if (!symStackPush(&ctx->varStack)) {
+		return ANALYSIS_INTERNAL_ERROR;
 	}
-
-	// uninitialise variables initialised in this scope
-	symbolTable* scope = symStackCurrentScope(&VAR_SYM_STACK);
-	for (int t = 0; t < VAR_SYM_STACK.count; t++) {
-		for (int i = 0; i < SYM_TABLE_CAPACITY; i++) {
-			symbolTableSlot* slot = &VAR_SYM_STACK.tables[t].data[i];
-			if (slot->taken && slot->variable.initialisedInScope == scope) {
-				slot->variable.initialisedInScope = NULL;
-			}
-		}
+	for (int i = 0; i < block->count; i++) {
+		ANALYSE(analyseStatement(ctx, &block->statements[i]), {});
 	}
 
-	symStackPop(&VAR_SYM_STACK);
+	// also uninitialises variables initialised in this scope
+	symStackPop(&ctx->varStack);
 	return ANALYSIS_OK;
 }
 
 // tries to register the function to the function symtable
 static analysisResult registerFunction(const astFunctionDefinition* def) {
 	// check if function of same name is defined
-	symbolTableSlot* slot = symTableLookup(FUNC_SYM_TABLE, def->name.name);
-	if (slot) {
+	if (symFuncTableFind(FUNC_SYM_TABLE, def->name.name) != SYM_FUNC_NONE) {
 		fprintf(stderr, "Redefinition of function %s\n", def->name.name);
 		return ANALYSIS_UNDEFINED_FUNC;
 	}
@@ -650,206 +697,340 @@ static analysisResult registerFunction(const astFunctionDefinition* def) {
 	// add function to symbol table
 	astDataType nullType = {AST_TYPE_NIL, false};
 	symbolFunc newSymbol = {&def->params, def->hasReturnValue ? def->returnType : nullType};
-	if (!symTableInsertFunc(FUNC_SYM_TABLE, newSymbol, def->name.name)) {
+	if (symFuncTableInsert(FUNC_SYM_TABLE, newSymbol, def->name.name) == SYM_FUNC_NONE) {
 		return ANALYSIS_INTERNAL_ERROR;
 	}
 	return ANALYSIS_OK;
 }
 
-// BUILTIN FUNCTIONS
-
-static bool registerReadString() {
-	astDataType returnType = {AST_TYPE_STRING, true};
-	symbolFunc symbol = {&EMPTY_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "readString");
+static bool registerBuiltinFunctions() {
+	for (int i = 0; i < BUILTIN_COUNT; i++) {
+		symbolFunc symbol = {&BUILTINS[i].params, BUILTINS[i].returnType};
+		// builtins are registered first, so their function ids are the same as builtin ids
+		if (symFuncTableInsert(FUNC_SYM_TABLE, symbol, BUILTINS[i].name) != i) {
+			return false;
+		}
+	}
+	return true;
 }
 
-static bool registerReadInt() {
-	astDataType returnType = {AST_TYPE_INT, true};
-	symbolFunc symbol = {&EMPTY_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "readInt");
+// PARALLEL ANALYSIS OF FUNCTION BODIES
+
+// state of a global variable as seen by function bodies defined after it
+// the snapshots form a list shared by all jobs, newer entries shadow older ones of the same name
+typedef struct analysisGlobal {
+	const char* name;
+	symbolVariable variable;  // initialisedInScope is only used as a flag
+	struct analysisGlobal* next;
+} analysisGlobal;
+
+// analysis of one function body
+typedef struct {
+	astFunctionDefinition* def;
+	const analysisGlobal* globals;	// global variables visible at the definition
+	analysisResult result;
+	char error[ANALYSIS_ERROR_LENGTH];
+} analysisJob;
+
+typedef struct {
+	analysisJob* jobs;	// in source order
+	int count;
+	int next;		  // first job not taken by any worker
+	int firstFailed;  // jobs after the first failed one don't have to be analysed
+	pthread_mutex_t lock;
+} analysisQueue;
+
+// returns the variable which may be defined or initialised by given statement
+static const char* assignedVariable(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			return statement->variableDef.variableName.name;
+		case AST_STATEMENT_ASSIGN:
+			return statement->assignment.variableName.name;
+		case AST_STATEMENT_FUNC_CALL:
+			return statement->functionCall.varName.name;
+		default:
+			return NULL;
+	}
 }
 
-static bool registerReadDouble() {
-	astDataType returnType = {AST_TYPE_DOUBLE, true};
-	symbolFunc symbol = {&EMPTY_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "readDouble");
-}
+// analyses statement of the global code and records new global variables and their initialisation
+// nested blocks don't change the global scope after they end, so only top level statements are interesting
+static analysisResult analyseGlobalStatement(analysisContext* ctx, astStatement* statement,
+											 analysisGlobal** globals) {
+	const char* name = assignedVariable(statement);
+	symbolTableSlot* slot = name ? symStackLookup(&ctx->varStack, name, NULL) : NULL;
+	bool wasInitialised = slot && slot->variable.initialisedInScope;
 
-static bool registerInt2Double() {
-	astParameterListCreate(&INT2DOUBLE_PARAMS);
-	astParameter term;
-	term.dataType.type = AST_TYPE_INT;
-	term.dataType.nullable = false;
-	term.requiresName = false;
-	term.outsideName.name = NULL;
-	term.insideName.name = NULL;
-	term.used = true;
-	if (astParameterListAdd(&INT2DOUBLE_PARAMS, term)) {
-		return false;
-	}
+	ANALYSE(analyseStatement(ctx, statement), {});
 
-	astDataType returnType = {AST_TYPE_DOUBLE, false};
-	symbolFunc symbol = {&INT2DOUBLE_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "Int2Double");
+	if (!name) {
+		return ANALYSIS_OK;
+	}
+	symbolScope* scope;
+	slot = symStackLookup(&ctx->varStack, name, &scope);
+	assert(slot);
+	if (scope != symStackGlobalScope(&ctx->varStack)) {
+		return ANALYSIS_OK;
+	}
+	if (statement->type == AST_STATEMENT_VAR_DEF || (!wasInitialised && slot->variable.initialisedInScope)) {
+		analysisGlobal* global = malloc(sizeof(analysisGlobal));
+		if (!global) {
+			return ANALYSIS_INTERNAL_ERROR;
+		}
+		global->name = name;
+		global->variable = slot->variable;
+		global->next = *globals;
+		*globals = global;
+	}
+	return ANALYSIS_OK;
 }
 
-static bool registerDouble2Int() {
-	astParameterListCreate(&DOUBLE2INT_PARAMS);
-	astParameter term;
-	term.dataType.type = AST_TYPE_DOUBLE;
-	term.dataType.nullable = false;
-	term.requiresName = false;
-	term.outsideName.name = NULL;
-	term.insideName.name = NULL;
-	term.used = true;
-	if (astParameterListAdd(&DOUBLE2INT_PARAMS, term)) {
+// pushes the global scope with variables from the snapshot
+static bool loadGlobals(analysisContext* ctx, const analysisGlobal* globals) {
+	if (!symStackPush(&ctx->varStack)) {
 		return false;
 	}
-
-	astDataType returnType = {AST_TYPE_INT, false};
-	symbolFunc symbol = {&DOUBLE2INT_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "Double2Int");
+	symbolScope* globalScope = symStackCurrentScope(&ctx->varStack);
+	for (; globals; globals = globals->next) {
+		if (symStackLookup(&ctx->varStack, globals->name, NULL)) {
+			continue;  // newer snapshot already loaded
+		}
+		symbolVariable variable = globals->variable;
+		variable.initialisedInScope = variable.initialisedInScope ? globalScope : NULL;
+		if (!symStackInsertVar(&ctx->varStack, variable, globals->name)) {
+			return false;
+		}
+	}
+	return true;
 }
 
-static bool registerLength() {
-	astParameterListCreate(&LENGTH_PARAMS);
-	astParameter s;
-	s.dataType.type = AST_TYPE_STRING;
-	s.dataType.nullable = false;
-	s.requiresName = false;
-	s.outsideName.name = NULL;
-	s.insideName.name = NULL;
-	s.used = true;
-	if (astParameterListAdd(&LENGTH_PARAMS, s)) {
-		return false;
+static void runJob(analysisContext* ctx, analysisJob* job) {
+	ctx->error[0] = '\0';
+	if (loadGlobals(ctx, job->globals)) {
+		job->result = analyseFunctionDef(ctx, job->def);
+	} else {
+		job->result = ANALYSIS_INTERNAL_ERROR;
 	}
+	memcpy(job->error, ctx->error, ANALYSIS_ERROR_LENGTH);
 
-	astDataType returnType = {AST_TYPE_INT, false};
-	symbolFunc symbol = {&LENGTH_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "length");
+	// failed analysis leaves its scopes on the stack
+	while (ctx->varStack.count > 0) {
+		symStackPop(&ctx->varStack);
+	}
 }
 
-static bool registerSubstring() {
-	astParameterListCreate(&SUBSTRING_PARAMS);
+static void processJobs(analysisContext* ctx, analysisQueue* queue) {
+	while (true) {
+		pthread_mutex_lock(&queue->lock);
+		int index = queue->next++;
+		bool done = index >= queue->count || index > queue->firstFailed;
+		pthread_mutex_unlock(&queue->lock);
+		if (done) {
+			return;
+		}
 
-	astParameter of;
-	of.dataType.type = AST_TYPE_STRING;
-	of.dataType.nullable = false;
-	of.requiresName = true;
-	of.outsideName.name = "of";
-	of.insideName.name = NULL;
-	of.used = true;
-	if (astParameterListAdd(&SUBSTRING_PARAMS, of)) {
-		return false;
+		runJob(ctx, &queue->jobs[index]);
+		if (queue->jobs[index].result != ANALYSIS_OK) {
+			pthread_mutex_lock(&queue->lock);
+			if (index < queue->firstFailed) {
+				queue->firstFailed = index;
+			}
+			pthread_mutex_unlock(&queue->lock);
+		}
 	}
+}
 
-	astParameter startingAt;
-	startingAt.dataType.type = AST_TYPE_INT;
-	startingAt.dataType.nullable = false;
-	startingAt.requiresName = true;
-	startingAt.outsideName.name = "startingAt";
-	startingAt.insideName.name = NULL;
-	startingAt.used = true;
-	if (astParameterListAdd(&SUBSTRING_PARAMS, startingAt)) {
-		return false;
+static void* analysisWorker(void* queue) {
+	analysisContext ctx;
+	if (!symStackCreate(&ctx.varStack)) {
+		return NULL;  // the remaining workers take the jobs
 	}
+	ctx.currentFunction = NULL;
+	ctx.impure = false;
+	processJobs(&ctx, queue);
+	symStackDestroy(&ctx.varStack);
+	return NULL;
+}
 
-	astParameter endingBefore;
-	endingBefore.dataType.type = AST_TYPE_INT;
-	endingBefore.dataType.nullable = false;
-	endingBefore.requiresName = true;
-	endingBefore.outsideName.name = "endingBefore";
-	endingBefore.insideName.name = NULL;
-	endingBefore.used = true;
-	if (astParameterListAdd(&SUBSTRING_PARAMS, endingBefore)) {
-		return false;
+static int analysisThreadCount(int jobCount) {
+	int threads = jobCount / ANALYSIS_JOBS_PER_THREAD;
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads > cores) {
+		threads = cores;
 	}
-
-	astDataType returnType = {AST_TYPE_STRING, true};
-	symbolFunc symbol = {&SUBSTRING_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "substring");
+	if (threads > ANALYSIS_MAX_THREADS) {
+		threads = ANALYSIS_MAX_THREADS;
+	}
+	return threads < 1 ? 1 : threads;
 }
 
-static bool registerOrd() {
-	astParameterListCreate(&ORD_PARAMS);
-	astParameter c;
-	c.dataType.type = AST_TYPE_STRING;
-	c.dataType.nullable = false;
-	c.requiresName = false;
-	c.outsideName.name = NULL;
-	c.insideName.name = NULL;
-	c.used = true;
-	if (astParameterListAdd(&ORD_PARAMS, c)) {
-		return false;
+// analyses all function bodies, the calling thread takes part with its own context
+// returns index of the first failed job or count if all of them passed
+static int analyseFunctionBodies(analysisContext* ctx, analysisJob* jobs, int count) {
+	analysisQueue queue = {jobs, count, 0, count, PTHREAD_MUTEX_INITIALIZER};
+	pthread_t threads[ANALYSIS_MAX_THREADS];
+	int threadCount = 0;
+	int wantedThreads = analysisThreadCount(count);
+	// if some thread cannot be started, the others do its work
+	while (threadCount < wantedThreads - 1 &&
+		   pthread_create(&threads[threadCount], NULL, analysisWorker, &queue) == 0) {
+		threadCount++;
 	}
 
-	astDataType returnType = {AST_TYPE_INT, false};
-	symbolFunc symbol = {&ORD_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "ord");
+	processJobs(ctx, &queue);
+	for (int i = 0; i < threadCount; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&queue.lock);
+	return queue.firstFailed;
 }
 
-static analysisResult registerChr() {
-	astParameterListCreate(&CHR_PARAMS);
-	astParameter i;
-	i.dataType.type = AST_TYPE_INT;
-	i.dataType.nullable = false;
-	i.requiresName = false;
-	i.outsideName.name = NULL;
-	i.insideName.name = NULL;
-	i.used = true;
-	if (astParameterListAdd(&CHR_PARAMS, i)) {
-		return false;
+static void freeGlobals(analysisGlobal* globals) {
+	while (globals) {
+		analysisGlobal* next = globals->next;
+		free(globals);
+		globals = next;
 	}
+}
+
+// PURITY
+
+static bool callsImpureInBlock(astFunctionDefinition* const*, const astStatementBlock*);
 
-	astDataType returnType = {AST_TYPE_STRING, false};
-	symbolFunc symbol = {&CHR_PARAMS, returnType};
-	return symTableInsertFunc(FUNC_SYM_TABLE, symbol, "chr");
+static bool isImpureCall(astFunctionDefinition* const* definitions, int funcId) {
+	// builtins and write are already checked during the analysis of the body
+	return !isBuiltinFunction(funcId) && funcId != SYM_FUNC_NONE && !definitions[funcId]->pure;
 }
 
-static bool registerBuiltinFunctions() {
-	astParameterListCreate(&EMPTY_PARAMS);
+static bool callsImpure(astFunctionDefinition* const* definitions, const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			return statement->variableDef.hasInitValue && statement->variableDef.value.type == AST_VAR_INIT_FUNC &&
+				   isImpureCall(definitions, statement->variableDef.value.call.funcId);
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			return callsImpureInBlock(definitions, &conditional->body) ||
+				   (conditional->hasElse && callsImpureInBlock(definitions, &conditional->bodyElse));
+		}
+		case AST_STATEMENT_ITER:
+			return callsImpureInBlock(definitions, &statement->iteration.body);
+		case AST_STATEMENT_FUNC_CALL:
+			return isImpureCall(definitions, statement->functionCall.funcId);
+		case AST_STATEMENT_PROC_CALL:
+			return isImpureCall(definitions, statement->procedureCall.funcId);
+		default:
+			return false;
+	}
+}
 
-	return (registerReadString() && registerReadDouble() && registerReadInt() && registerInt2Double() &&
-			registerDouble2Int() && registerLength() && registerSubstring() && registerOrd() && registerChr());
+static bool callsImpureInBlock(astFunctionDefinition* const* definitions, const astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		if (callsImpure(definitions, &block->statements[i])) {
+			return true;
+		}
+	}
+	return false;
 }
 
-static void cleanUpBuiltinFunctions() {
-	astParameterListDestroyNoRecurse(&EMPTY_PARAMS);
-	astParameterListDestroyNoRecurse(&INT2DOUBLE_PARAMS);
-	astParameterListDestroyNoRecurse(&DOUBLE2INT_PARAMS);
-	astParameterListDestroyNoRecurse(&LENGTH_PARAMS);
-	astParameterListDestroyNoRecurse(&SUBSTRING_PARAMS);
-	astParameterListDestroyNoRecurse(&ORD_PARAMS);
-	astParameterListDestroyNoRecurse(&CHR_PARAMS);
+// functions calling impure functions are impure too, repeated until a fixpoint is reached
+static bool propagateImpurity(astProgram* program) {
+	astFunctionDefinition** definitions = calloc(FUNC_SYM_TABLE->count, sizeof(astFunctionDefinition*));
+	if (!definitions) {
+		return false;
+	}
+	for (int i = 0; i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_FUNCTION) {
+			astFunctionDefinition* def = &program->statements[i].functionDef;
+			definitions[symFuncTableFind(FUNC_SYM_TABLE, def->name.name)] = def;
+		}
+	}
+
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = 0; i < program->count; i++) {
+			astFunctionDefinition* def = &program->statements[i].functionDef;
+			if (program->statements[i].type == AST_TOP_FUNCTION && def->pure &&
+				callsImpureInBlock(definitions, &def->body)) {
+				def->pure = false;
+				changed = true;
+			}
+		}
+	}
+
+	free(definitions);
+	return true;
 }
 
-analysisResult analyseProgram(const astProgram* program, symbolTable* functionTable) {
+analysisResult analyseProgram(astProgram* program, symbolFuncTable* functionTable) {
 	FUNC_SYM_TABLE = functionTable;
 	if (!registerBuiltinFunctions()) {
 		return ANALYSIS_INTERNAL_ERROR;
 	}
-	symStackCreate(&VAR_SYM_STACK);
-	symStackPush(&VAR_SYM_STACK);  // global scope
+	analysisContext ctx;
+	ctx.currentFunction = NULL;
+	ctx.impure = false;
+	ctx.error[0] = '\0';
+	if (!symStackCreate(&ctx.varStack)) {
+		return ANALYSIS_INTERNAL_ERROR;
+	}
+	if (!symStackPush(&ctx.varStack)) {	 // global scope
+		symStackDestroy(&ctx.varStack);
+		return ANALYSIS_INTERNAL_ERROR;
+	}
 	// first pass - register all functions
+	int functionCount = 0;
 	for (int i = 0; i < program->count; i++) {
 		const astTopLevelStatement* topStatement = &program->statements[i];
 		if (topStatement->type == AST_TOP_FUNCTION) {
-			ANALYSE(registerFunction(&topStatement->functionDef), { cleanUpBuiltinFunctions(); });
+			ANALYSE(registerFunction(&topStatement->functionDef), { symStackDestroy(&ctx.varStack); });
+			functionCount++;
 		}
 	}
 
-	// second pass - analyse statements and function bodies
-	for (int i = 0; i < program->count; i++) {
-		const astTopLevelStatement* topStatement = &program->statements[i];
+	// no more functions can be added, call sites are resolved against the frozen table
+	analysisJob* jobs = malloc(functionCount * sizeof(analysisJob));
+	if (!symFuncTableFreeze(FUNC_SYM_TABLE) || (functionCount > 0 && !jobs)) {
+		free(jobs);
+		symStackDestroy(&ctx.varStack);
+		return ANALYSIS_INTERNAL_ERROR;
+	}
+
+	// second pass - analyse global code in order, function bodies see only globals defined before them
+	analysisGlobal* globals = NULL;
+	analysisResult result = ANALYSIS_OK;
+	int jobCount = 0;
+	for (int i = 0; i < program->count && result == ANALYSIS_OK; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
 		if (topStatement->type == AST_TOP_STATEMENT) {
-			ANALYSE(analyseStatement(&topStatement->statement), { cleanUpBuiltinFunctions(); });
+			result = analyseGlobalStatement(&ctx, &topStatement->statement, &globals);
 		} else {
-			ANALYSE(analyseFunctionDef(&topStatement->functionDef), { cleanUpBuiltinFunctions(); });
+			analysisJob job = {&topStatement->functionDef, globals, ANALYSIS_OK, ""};
+			jobs[jobCount++] = job;
 		}
 	}
 
-	cleanUpBuiltinFunctions();
+	// function bodies are independent of each other, analyse them in parallel
+	// all of them precede the failed global statement (if any), so their errors are reported first
+	char globalError[ANALYSIS_ERROR_LENGTH];
+	memcpy(globalError, ctx.error, ANALYSIS_ERROR_LENGTH);
+	while (ctx.varStack.count > 0) {
+		symStackPop(&ctx.varStack);
+	}
+	int failedJob = analyseFunctionBodies(&ctx, jobs, jobCount);
+	if (failedJob < jobCount) {
+		result = jobs[failedJob].result;
+		fputs(jobs[failedJob].error, stderr);
+	} else if (result != ANALYSIS_OK) {
+		fputs(globalError, stderr);
+	} else if (!propagateImpurity(program)) {
+		result = ANALYSIS_INTERNAL_ERROR;
+	}
+
+	freeGlobals(globals);
+	free(jobs);
+	symStackDestroy(&ctx.varStack);
 
-	return ANALYSIS_OK;
+	return result;
 }
@@ -26,6 +26,6 @@ typedef enum {
 	ANALYSIS_INTERNAL_ERROR
 } analysisResult;
 
-analysisResult analyseProgram(const astProgram*, symbolTable* functionTable);
+analysisResult analyseProgram(astProgram*, symbolFuncTable* functionTable);
 
 #endif
@@ -59,6 +59,8 @@ int astBinaryExprCreate(astExpression* expr, astExpression lhs, astExpression rh
 	*(expr->binary.lhs) = lhs;
 	*(expr->binary.rhs) = rhs;
 	expr->binary.op = op;
+	expr->binary.convertLhs = false;
+	expr->binary.convertRhs = false;
 	return 0;
 }
 
@@ -82,6 +84,20 @@ int astStatementBlockAdd(astStatementBlock* block, astStatement statement) {
 	return 0;
 }
 
+void astScopeCreate(astStatement* statement, astStatementBlock body) {
+	statement->type = AST_STATEMENT_COND;
+	astConditional* conditional = &statement->conditional;
+	conditional->condition.type = AST_CONDITION_EXPRESSION;
+	astExpression* condition = &conditional->condition.expression;
+	condition->type = AST_EXPR_TERM;
+	condition->term.type = AST_TERM_BOOL;
+	condition->term.boolean.value = true;
+	condition->dataType = (astDataType){AST_TYPE_BOOL, false};
+	condition->isLiteral = true;
+	conditional->body = body;
+	conditional->hasElse = false;
+}
+
 void astParameterListCreate(astParameterList* list) {
 	list->data = NULL;
 	list->count = 0;
@@ -122,12 +138,23 @@ int astInputParameterListAdd(astInputParameterList* list, astInputParameter para
 	return 0;
 }
 
+int astIdentCreate(astIdentifier* identifier, const char* str) {
+	identifier->name = malloc(strlen(str) + 1);
+	if (!identifier->name) {
+		return 1;
+	}
+	strcpy(identifier->name, str);
+	return 0;
+}
+
 static void astIdentifierDestroy(astIdentifier* identifier) {
 	free(identifier->name);
 	identifier->name = NULL;
 }
 
-static void astTermDestroy(astTerm* term) {
+void astIdentDestroy(astIdentifier* identifier) { astIdentifierDestroy(identifier); }
+
+void astTermDestroy(astTerm* term) {
 	if (term->type == AST_TERM_ID) {
 		astIdentifierDestroy(&term->identifier);
 	} else if (term->type == AST_TERM_STRING) {
@@ -136,7 +163,7 @@ static void astTermDestroy(astTerm* term) {
 	}
 }
 
-static void astExpressionDestroy(astExpression* expr) {
+void astExpressionDestroy(astExpression* expr) {
 	switch (expr->type) {
 		case AST_EXPR_TERM:
 			astTermDestroy(&expr->term);
@@ -189,7 +216,7 @@ static void astInputParameterListDestroy(astInputParameterList* list) {
 	}
 }
 
-static void astFunctionCallDestroy(astFunctionCall* call) {
+void astFunctionCallDestroy(astFunctionCall* call) {
 	astIdentifierDestroy(&call->varName);
 	astIdentifierDestroy(&call->funcName);
 	astInputParameterListDestroy(&call->params);
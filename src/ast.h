@@ -16,6 +16,19 @@
 typedef struct astStatement astStatement;	 // fwd
 typedef struct astExpression astExpression;	 // fwd
 
+typedef enum {
+	AST_TYPE_INT,
+	AST_TYPE_DOUBLE,
+	AST_TYPE_STRING,
+	AST_TYPE_NIL,
+	AST_TYPE_BOOL,
+} astBasicDataType;
+
+typedef struct {
+	astBasicDataType type;
+	bool nullable;
+} astDataType;
+
 typedef struct {
 	char* name;
 } astIdentifier;
@@ -32,12 +45,17 @@ typedef struct {
 	char* content;
 } astStringLiteral;
 
+typedef struct {
+	bool value;
+} astBoolLiteral;
+
 typedef enum {
 	AST_TERM_ID,
 	AST_TERM_INT,
 	AST_TERM_DECIMAL,
 	AST_TERM_STRING,
 	AST_TERM_NIL,
+	AST_TERM_BOOL,	// only created by optimiser, the language has no bool literals
 } astTermType;
 
 typedef struct {
@@ -47,6 +65,7 @@ typedef struct {
 		astIntLiteral integer;
 		astDecimalLiteral decimal;
 		astStringLiteral string;
+		astBoolLiteral boolean;
 	};
 } astTerm;
 
@@ -68,6 +87,9 @@ typedef struct {
 	astBinaryOperator op;
 	astExpression* lhs;
 	astExpression* rhs;
+	// implicit int to double conversions of operands, filled by analyser
+	bool convertLhs;
+	bool convertRhs;
 } astBinaryExpression;
 
 typedef struct {
@@ -83,6 +105,8 @@ struct astExpression {
 		astBinaryExpression binary;
 		astUnwrapExpression unwrap;
 	};
+	astDataType dataType;  // result type, filled by analyser
+	bool isLiteral;		   // contains no variables, filled by analyser
 };
 
 typedef enum {
@@ -95,22 +119,10 @@ typedef enum {
 	AST_STATEMENT_RETURN,
 } astStatementType;
 
-typedef enum {
-	AST_TYPE_INT,
-	AST_TYPE_DOUBLE,
-	AST_TYPE_STRING,
-	AST_TYPE_NIL,
-	AST_TYPE_BOOL,
-} astBasicDataType;
-
-typedef struct {
-	astBasicDataType type;
-	bool nullable;
-} astDataType;
-
 typedef struct {
 	astIdentifier variableName;
 	astExpression value;
+	bool convertValue;	// implicit int to double conversion, filled by analyser
 } astAssignment;
 
 typedef struct {
@@ -162,11 +174,13 @@ typedef struct {
 	astIdentifier varName;
 	astIdentifier funcName;
 	astInputParameterList params;
+	int funcId;	 // resolved by analyser
 } astFunctionCall;
 
 typedef struct {
 	astIdentifier procName;
 	astInputParameterList params;
+	int funcId;	 // resolved by analyser
 } astProcedureCall;
 
 typedef struct {
@@ -186,11 +200,13 @@ typedef struct {
 
 typedef struct {
 	astIdentifier variableName;
-	astDataType variableType;
+	astDataType variableType;  // deduced by analyser if there is no explicit type
 	bool hasExplicitType;
 	bool hasInitValue;
 	astVariableInitialiser value;
 	bool immutable;
+	bool convertValue;	// implicit int to double conversion of the initialiser, filled by analyser
+	bool nilInit;		// implicit nil initialisation, filled by analyser, cleared by optimiser if never read
 } astVariableDefinition;
 
 struct astStatement {
@@ -225,6 +241,7 @@ typedef struct {
 	bool hasReturnValue;
 	astDataType returnType;
 	astStatementBlock body;
+	bool pure;	// no input, output or global variables, filled by analyser
 } astFunctionDefinition;
 
 typedef enum { AST_TOP_FUNCTION, AST_TOP_STATEMENT } astTopLevelStatementType;
@@ -262,8 +279,13 @@ void astStringDestroy(astStringLiteral*);
 void astStatementBlockCreate(astStatementBlock*);
 // Returns 0 on success
 int astStatementBlockAdd(astStatementBlock*, astStatement);
+// Conditional decided to be true by optimiser, gives the statements of the body their own scope
+void astScopeCreate(astStatement*, astStatementBlock body);
 void astStatementBlockDestroy(astStatementBlock*);
 void astStatementDestroy(astStatement* statement);
+void astExpressionDestroy(astExpression* expr);
+void astTermDestroy(astTerm* term);
+void astFunctionCallDestroy(astFunctionCall* call);
 void astFunctionDefinitionDestroy(astFunctionDefinition* def);
 
 // void astParameterDestroy();
@@ -0,0 +1,37 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "builtins.h"
+
+#include <stddef.h>
+
+// parameter lists are never modified, they are not const only because astParameterList points to mutable data
+static astParameter INT_PARAM[] = {{false, true, {NULL}, {NULL}, {AST_TYPE_INT, false}}};
+static astParameter DOUBLE_PARAM[] = {{false, true, {NULL}, {NULL}, {AST_TYPE_DOUBLE, false}}};
+static astParameter STRING_PARAM[] = {{false, true, {NULL}, {NULL}, {AST_TYPE_STRING, false}}};
+static astParameter SUBSTRING_PARAMS[] = {
+	{true, true, {"of"}, {NULL}, {AST_TYPE_STRING, false}},
+	{true, true, {"startingAt"}, {NULL}, {AST_TYPE_INT, false}},
+	{true, true, {"endingBefore"}, {NULL}, {AST_TYPE_INT, false}},
+};
+
+const builtinDescriptor BUILTINS[BUILTIN_COUNT] = {
+	[BUILTIN_READ_STRING] = {"readString", {NULL, 0}, {AST_TYPE_STRING, true}, false},
+	[BUILTIN_READ_INT] = {"readInt", {NULL, 0}, {AST_TYPE_INT, true}, false},
+	[BUILTIN_READ_DOUBLE] = {"readDouble", {NULL, 0}, {AST_TYPE_DOUBLE, true}, false},
+	[BUILTIN_INT2DOUBLE] = {"Int2Double", {INT_PARAM, 1}, {AST_TYPE_DOUBLE, false}, true},
+	[BUILTIN_DOUBLE2INT] = {"Double2Int", {DOUBLE_PARAM, 1}, {AST_TYPE_INT, false}, true},
+	[BUILTIN_LENGTH] = {"length", {STRING_PARAM, 1}, {AST_TYPE_INT, false}, true},
+	[BUILTIN_SUBSTRING] = {"substring", {SUBSTRING_PARAMS, 3}, {AST_TYPE_STRING, true}, true},
+	[BUILTIN_ORD] = {"ord", {STRING_PARAM, 1}, {AST_TYPE_INT, false}, true},
+	[BUILTIN_CHR] = {"chr", {INT_PARAM, 1}, {AST_TYPE_STRING, false}, true},
+};
+
+bool isBuiltinFunction(int funcId) { return funcId >= 0 && funcId < BUILTIN_COUNT; }
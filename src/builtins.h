@@ -0,0 +1,41 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef BUILTINS_H
+#define BUILTINS_H
+
+#include "ast.h"
+
+// Builtin functions. They are registered to the function table first, so their function ids equal these ids.
+typedef enum {
+	BUILTIN_READ_STRING,
+	BUILTIN_READ_INT,
+	BUILTIN_READ_DOUBLE,
+	BUILTIN_INT2DOUBLE,
+	BUILTIN_DOUBLE2INT,
+	BUILTIN_LENGTH,
+	BUILTIN_SUBSTRING,
+	BUILTIN_ORD,
+	BUILTIN_CHR,
+	BUILTIN_COUNT
+} builtinFunction;
+
+typedef struct {
+	const char* name;
+	astParameterList params;
+	astDataType returnType;
+	bool pure;	// no side effects, result depends only on arguments
+} builtinDescriptor;
+
+extern const builtinDescriptor BUILTINS[BUILTIN_COUNT];
+
+bool isBuiltinFunction(int funcId);
+
+#endif
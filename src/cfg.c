@@ -0,0 +1,365 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "cfg.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Basic blocks start at labels and after jumps, returns and exits. The code is entered at its first block and at
+// function labels (by CALL) and left by falling through its last block. Blocks linked by falling through form chains
+// which are never split, so the layout only reorders whole chains: the entry chain stays first, the chain falling off
+// the end stays last and a chain ending with a jump is followed by the chain it jumps to where possible.
+
+// the simplification is repeated while it changes something, usually the second round finds nothing
+#define CFG_MAX_ROUNDS 4
+
+typedef struct {
+	int start;	// first instruction, labels of the block come first
+	int end;	// behind the last instruction
+	bool reachable;
+	bool placed;
+} cfgBlock;
+
+typedef struct {
+	irInstruction* code;
+	cfgBlock* blocks;
+	int blockCount;
+	int* labelBlocks;  // numbered label - firstLabel -> block defining it, -1 if not defined in the code
+	int firstLabel;
+	int labelCount;
+} cfgGraph;
+
+static struct {
+	long threadedJumps;
+	long unreachableBlocks;
+	long removedJumps;
+	long invertedBranches;
+	long removedLabels;
+} STATISTICS;
+
+// the code generation cannot fail gracefully, running out of memory is fatal
+static void* allocate(size_t size) {
+	void* memory = malloc(size ? size : 1);
+	if (!memory) {
+		fputs("Out of memory.\n", stderr);
+		exit(99);
+	}
+	return memory;
+}
+
+static bool isJump(irOpcode opcode) {
+	return opcode == IR_JUMP || opcode == IR_JUMPIFEQ || opcode == IR_JUMPIFNEQ || opcode == IR_JUMPIFEQS ||
+		   opcode == IR_JUMPIFNEQS;
+}
+
+static bool endsBlock(irOpcode opcode) { return isJump(opcode) || opcode == IR_RETURN || opcode == IR_EXIT; }
+
+static bool isNumberedLabel(const irOperand* label) { return label->type == IR_OPERAND_LABEL && !label->name; }
+
+static irOpcode lastOpcode(const cfgGraph* graph, int block) {
+	return graph->code[graph->blocks[block].end - 1].opcode;
+}
+
+static bool fallsThrough(const cfgGraph* graph, int block) {
+	irOpcode opcode = lastOpcode(graph, block);
+	return opcode != IR_JUMP && opcode != IR_RETURN && opcode != IR_EXIT;
+}
+
+// block defining the label, -1 for function labels and labels defined elsewhere
+static int targetBlock(const cfgGraph* graph, const irOperand* label) {
+	if (!isNumberedLabel(label)) {
+		return -1;
+	}
+	int index = label->number - graph->firstLabel;
+	return index >= 0 && index < graph->labelCount ? graph->labelBlocks[index] : -1;
+}
+
+// the block is entered only by jumps to its labels
+static bool isChainHead(const cfgGraph* graph, int block) {
+	return block == 0 || !graph->blocks[block - 1].reachable || !fallsThrough(graph, block - 1);
+}
+
+// next block of the chain, -1 at its end
+static int chainNext(const cfgGraph* graph, int block) {
+	return fallsThrough(graph, block) && block + 1 < graph->blockCount ? block + 1 : -1;
+}
+
+static void buildGraph(cfgGraph* graph, irCode* code) {
+	graph->code = code->data;
+	graph->blocks = allocate(code->count * sizeof(cfgBlock));
+	graph->blockCount = 0;
+	int minLabel = 0;
+	int maxLabel = -1;
+	for (int i = 0; i < code->count; i++) {
+		const irInstruction* instruction = &code->data[i];
+		bool leader = i == 0 || endsBlock(code->data[i - 1].opcode) ||
+					  (instruction->opcode == IR_LABEL && code->data[i - 1].opcode != IR_LABEL);
+		if (leader) {
+			graph->blocks[graph->blockCount++] = (cfgBlock){i, i, false, false};
+		}
+		graph->blocks[graph->blockCount - 1].end = i + 1;
+
+		if (instruction->opcode == IR_LABEL && isNumberedLabel(&instruction->operands[0])) {
+			int number = instruction->operands[0].number;
+			minLabel = maxLabel < minLabel || number < minLabel ? number : minLabel;
+			maxLabel = number > maxLabel ? number : maxLabel;
+		}
+	}
+
+	graph->firstLabel = minLabel;
+	graph->labelCount = maxLabel - minLabel + 1;
+	graph->labelBlocks = allocate(graph->labelCount * sizeof(int));
+	for (int i = 0; i < graph->labelCount; i++) {
+		graph->labelBlocks[i] = -1;
+	}
+	for (int block = 0; block < graph->blockCount; block++) {
+		for (int i = graph->blocks[block].start; i < graph->blocks[block].end; i++) {
+			const irOperand* label = &graph->code[i].operands[0];
+			if (graph->code[i].opcode == IR_LABEL && isNumberedLabel(label)) {
+				graph->labelBlocks[label->number - minLabel] = block;
+			}
+		}
+	}
+}
+
+static void destroyGraph(cfgGraph* graph) {
+	free(graph->blocks);
+	free(graph->labelBlocks);
+}
+
+// first instruction after the labels of the block, NULL if it has only labels
+static const irInstruction* firstInstruction(const cfgGraph* graph, int block) {
+	for (int i = graph->blocks[block].start; i < graph->blocks[block].end; i++) {
+		if (graph->code[i].opcode != IR_LABEL) {
+			return &graph->code[i];
+		}
+	}
+	return NULL;
+}
+
+// jumps to a block consisting of a single JUMP go straight to its target, returns whether any was changed
+static bool threadJumps(cfgGraph* graph) {
+	bool changed = false;
+	for (int block = 0; block < graph->blockCount; block++) {
+		irInstruction* jump = &graph->code[graph->blocks[block].end - 1];
+		if (!isJump(jump->opcode)) {
+			continue;
+		}
+		int target = targetBlock(graph, &jump->operands[0]);
+		// the number of steps is limited, as jumps may form a cycle
+		for (int steps = 0; target >= 0 && steps < graph->blockCount; steps++) {
+			const irInstruction* first = firstInstruction(graph, target);
+			if (!first || first->opcode != IR_JUMP || targetBlock(graph, &first->operands[0]) < 0) {
+				break;
+			}
+			jump->operands[0] = first->operands[0];
+			target = targetBlock(graph, &first->operands[0]);
+			STATISTICS.threadedJumps++;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+// marks blocks reachable from the entry and from function labels, returns whether any block is unreachable
+static bool markReachable(cfgGraph* graph) {
+	int* stack = allocate(graph->blockCount * sizeof(int));
+	int top = 0;
+	for (int block = 0; block < graph->blockCount; block++) {
+		const irInstruction* first = &graph->code[graph->blocks[block].start];
+		if (block == 0 || (first->opcode == IR_LABEL && !isNumberedLabel(&first->operands[0]))) {
+			graph->blocks[block].reachable = true;
+			stack[top++] = block;
+		}
+	}
+
+	while (top > 0) {
+		int block = stack[--top];
+		int successors[2] = {chainNext(graph, block), -1};
+		if (isJump(lastOpcode(graph, block))) {
+			successors[1] = targetBlock(graph, &graph->code[graph->blocks[block].end - 1].operands[0]);
+		}
+		for (int i = 0; i < 2; i++) {
+			if (successors[i] >= 0 && !graph->blocks[successors[i]].reachable) {
+				graph->blocks[successors[i]].reachable = true;
+				stack[top++] = successors[i];
+			}
+		}
+	}
+	free(stack);
+
+	bool removed = false;
+	for (int block = 0; block < graph->blockCount; block++) {
+		if (!graph->blocks[block].reachable) {
+			STATISTICS.unreachableBlocks++;
+			removed = true;
+		}
+	}
+	return removed;
+}
+
+// appends the chain starting at the block to the order, returns its last block
+static int placeChain(cfgGraph* graph, int block, int* order, int* count) {
+	int last = block;
+	for (; block >= 0; block = chainNext(graph, block)) {
+		graph->blocks[block].placed = true;
+		order[(*count)++] = block;
+		last = block;
+	}
+	return last;
+}
+
+// orders reachable blocks, returns their count
+static int layoutBlocks(cfgGraph* graph, int* order) {
+	int count = 0;
+	int lastBlock = graph->blockCount - 1;
+	int exitChain = -1;
+	if (graph->blocks[lastBlock].reachable && fallsThrough(graph, lastBlock)) {
+		for (exitChain = lastBlock; !isChainHead(graph, exitChain); exitChain--) {
+		}
+	}
+
+	for (int head = 0; head < graph->blockCount; head++) {
+		int block = head;
+		while (block >= 0 && graph->blocks[block].reachable && !graph->blocks[block].placed && block != exitChain &&
+			   isChainHead(graph, block)) {
+			int last = placeChain(graph, block, order, &count);
+			// the chain jumped to can follow, if nothing falls through into it
+			block = lastOpcode(graph, last) == IR_JUMP
+						? targetBlock(graph, &graph->code[graph->blocks[last].end - 1].operands[0])
+						: -1;
+		}
+	}
+	if (exitChain >= 0) {
+		placeChain(graph, exitChain, order, &count);
+	}
+	return count;
+}
+
+static irOpcode invertedJump(irOpcode opcode) {
+	switch (opcode) {
+		case IR_JUMPIFEQ:
+			return IR_JUMPIFNEQ;
+		case IR_JUMPIFNEQ:
+			return IR_JUMPIFEQ;
+		case IR_JUMPIFEQS:
+			return IR_JUMPIFNEQS;
+		default:
+			return IR_JUMPIFEQS;
+	}
+}
+
+// block with a single JUMP and no labels, only the preceding block falls through into it
+static bool isLoneJump(const cfgGraph* graph, int block) {
+	const cfgBlock* data = &graph->blocks[block];
+	return data->end - data->start == 1 && graph->code[data->start].opcode == IR_JUMP;
+}
+
+// writes the blocks in the order to the output, leaving out jumps to the following block, returns whether any jump
+// was removed
+static bool writeBlocks(const cfgGraph* graph, const int* order, int count, irCode* output) {
+	bool changed = false;
+	for (int i = 0; i < count; i++) {
+		const cfgBlock* block = &graph->blocks[order[i]];
+		int next = i + 1 < count ? order[i + 1] : -1;
+		memcpy(output->data + output->count, graph->code + block->start,
+			   (block->end - block->start) * sizeof(irInstruction));
+		output->count += block->end - block->start;
+
+		irInstruction* last = &output->data[output->count - 1];
+		int target = isJump(last->opcode) ? targetBlock(graph, &last->operands[0]) : -1;
+		if (last->opcode == IR_JUMP && target >= 0 && target == next) {
+			output->count--;
+			STATISTICS.removedJumps++;
+			changed = true;
+		} else if (last->opcode != IR_JUMP && target >= 0 && next >= 0 && isLoneJump(graph, next) && i + 2 < count &&
+				   order[i + 2] == target) {
+			// JUMPIFEQ l a b; JUMP m; LABEL l -> JUMPIFNEQ m a b; LABEL l
+			last->opcode = invertedJump(last->opcode);
+			last->operands[0] = graph->code[graph->blocks[next].start].operands[0];
+			i++;
+			STATISTICS.invertedBranches++;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+// removes numbered labels which are not jumped to, returns whether any was removed
+static bool removeUnusedLabels(irCode* code, int firstLabel, int labelCount) {
+	bool* used = allocate(labelCount * sizeof(bool));
+	memset(used, 0, labelCount * sizeof(bool));
+	for (int i = 0; i < code->count; i++) {
+		const irOperand* label = &code->data[i].operands[0];
+		int index = label->number - firstLabel;
+		if (isJump(code->data[i].opcode) && isNumberedLabel(label) && index >= 0 && index < labelCount) {
+			used[index] = true;
+		}
+	}
+
+	int count = 0;
+	for (int i = 0; i < code->count; i++) {
+		const irOperand* label = &code->data[i].operands[0];
+		if (code->data[i].opcode == IR_LABEL && isNumberedLabel(label) && !used[label->number - firstLabel]) {
+			STATISTICS.removedLabels++;
+			continue;
+		}
+		code->data[count++] = code->data[i];
+	}
+	free(used);
+
+	bool changed = count != code->count;
+	code->count = count;
+	return changed;
+}
+
+// one round of the simplification, returns whether the code was changed
+static bool simplify(irCode* code) {
+	cfgGraph graph;
+	buildGraph(&graph, code);
+	bool changed = threadJumps(&graph);
+	changed = markReachable(&graph) || changed;
+
+	int* order = allocate(graph.blockCount * sizeof(int));
+	int count = layoutBlocks(&graph, order);
+	irCode output = {allocate(code->count * sizeof(irInstruction)), 0, code->count};
+	changed = writeBlocks(&graph, order, count, &output) || changed;
+	for (int i = 0; i < count && !changed; i++) {
+		changed = order[i] != i;
+	}
+	free(order);
+
+	changed = removeUnusedLabels(&output, graph.firstLabel, graph.labelCount) || changed;
+	destroyGraph(&graph);
+	// the output replaces the code, it is never longer
+	memcpy(code->data, output.data, output.count * sizeof(irInstruction));
+	code->count = output.count;
+	free(output.data);
+	return changed;
+}
+
+void cfgOptimise(irCode* code) {
+	// straight-line code without jumps has nothing to simplify
+	bool hasJumps = false;
+	for (int i = 0; i < code->count && !hasJumps; i++) {
+		hasJumps = endsBlock(code->data[i].opcode);
+	}
+	for (int round = 0; hasJumps && round < CFG_MAX_ROUNDS && simplify(code); round++) {
+	}
+}
+
+void cfgPrintStatistics(FILE* output) {
+	fprintf(output, "cfg threaded jumps: %ld\n", STATISTICS.threadedJumps);
+	fprintf(output, "cfg unreachable blocks: %ld\n", STATISTICS.unreachableBlocks);
+	fprintf(output, "cfg removed jumps: %ld\n", STATISTICS.removedJumps);
+	fprintf(output, "cfg inverted branches: %ld\n", STATISTICS.invertedBranches);
+	fprintf(output, "cfg removed labels: %ld\n", STATISTICS.removedLabels);
+}
@@ -0,0 +1,26 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef CFG_H
+#define CFG_H
+
+#include <stdio.h>
+
+#include "ir.h"
+
+// Builds the control-flow graph of a piece of generated code (a function or a top-level statement) and simplifies
+// its jumps in place: jumps to jumps are threaded, unreachable blocks removed, blocks laid out so that jumps become
+// fall-through and labels which are not jumped to removed. Numbered labels must be used only inside the piece.
+void cfgOptimise(irCode* code);
+
+// prints how many jumps, labels and blocks were removed
+void cfgPrintStatistics(FILE* output);
+
+#endif
@@ -11,23 +11,54 @@
 #include "compiler.h"
 
 #include <assert.h>
-#include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "ast.h"
+#include "builtins.h"
 #include "symtable.h"
 
 static symbolTableStack VAR_SYM_STACK;
-static const symbolTable* FUNC_SYM_TABLE;
+static const symbolFuncTable* FUNC_SYM_TABLE;
+static irCode CODE;
 
-#define PUSH_FRAME()     \
-	puts("CREATEFRAME"); \
-	puts("PUSHFRAME");   \
-	symStackPush(&VAR_SYM_STACK);
+// codegen cannot fail gracefully, running out of memory is fatal
+static void outOfMemory() {
+	fputs("Out of memory.\n", stderr);
+	exit(99);
+}
+
+static void pushScope() {
+	if (!symStackPush(&VAR_SYM_STACK)) {
+		outOfMemory();
+	}
+}
+
+static void emit0(irOpcode opcode) { irAppend(&CODE, opcode); }
+
+static void emit1(irOpcode opcode, irOperand first) { irAppend(&CODE, opcode)->operands[0] = first; }
+
+static void emit2(irOpcode opcode, irOperand first, irOperand second) {
+	irInstruction* instruction = irAppend(&CODE, opcode);
+	instruction->operands[0] = first;
+	instruction->operands[1] = second;
+}
 
-#define POP_FRAME()   \
-	puts("POPFRAME"); \
+static void emit3(irOpcode opcode, irOperand first, irOperand second, irOperand third) {
+	irInstruction* instruction = irAppend(&CODE, opcode);
+	instruction->operands[0] = first;
+	instruction->operands[1] = second;
+	instruction->operands[2] = third;
+}
+
+#define PUSH_FRAME()       \
+	emit0(IR_CREATEFRAME); \
+	emit0(IR_PUSHFRAME);   \
+	pushScope();
+
+#define POP_FRAME()     \
+	emit0(IR_POPFRAME); \
 	symStackPop(&VAR_SYM_STACK);
 
 // used for compiler-generated labes (in conditionals etc)
@@ -36,442 +67,821 @@ static int LAST_LABEL_NAME = 0;
 // returns a new, unique id for a label
 static int newLabelName() { return LAST_LABEL_NAME++; }
 
+// variable of the temporary frame used inside code of a single statement
+static irOperand temporaryFrameVariable(const char* name) { return irVariableOperand(IR_FRAME_TEMPORARY, 0, 0, name); }
+
+// for removing rubbish from stack, also holds relations compared by a branch right after them
+static irOperand rubbishVariable() { return irVariableOperand(IR_FRAME_GLOBAL, 0, 0, "$rubbish"); }
+
 // forward decl
-static astDataType compileExpression(const astExpression*);
-static void compileStatement(const astStatement*, bool noDeclareVars);
-static void compileVariableDef(const astVariableDefinition* def, bool assignmentOnly, bool predefine);
+static void compileExpression(const astExpression*);
+static void compileStatement(const astStatement*, bool inLoop);
+static void compileVariableDef(const astVariableDefinition* def);
 
-// adds correct frame and decorates name to avoid collisions (assumes that the variable IS NOT in symtable yet)
-static void emitNewVariableId(const astIdentifier* var) {
-	symbolTable* currentScope = symStackCurrentScope(&VAR_SYM_STACK);
-	if (currentScope == symStackGlobalScope(&VAR_SYM_STACK)) {
-		printf("GF@%s", var->name);
-	} else {
-		printf("LF@v%d%s", currentScope->id, var->name);
+// GF@name for global variables, LF@v<scope>name for local ones
+static irOperand frameVariable(const symbolScope* scope, const char* name) {
+	if (scope == symStackGlobalScope(&VAR_SYM_STACK)) {
+		return irVariableOperand(IR_FRAME_GLOBAL, 0, 0, name);
 	}
+	return irVariableOperand(IR_FRAME_LOCAL, 'v', scope->id, name);
+}
+
+// adds correct frame and decorates name to avoid collisions (assumes that the variable IS NOT in symtable yet)
+static irOperand newVariableId(const astIdentifier* var) {
+	return frameVariable(symStackCurrentScope(&VAR_SYM_STACK), var->name);
 }
 
 // adds correct frame and decorates name to avoid collisions (assumes that the variable IS in symtable)
-static void emitVariableId(const astIdentifier* var) {
-	symbolTable* scope = NULL;
+static irOperand variableId(const astIdentifier* var) {
+	symbolScope* scope = NULL;
 	symStackLookup(&VAR_SYM_STACK, var->name, &scope);
 	assert(scope);
-	if (scope == symStackGlobalScope(&VAR_SYM_STACK)) {
-		printf("GF@%s", var->name);
-	} else {
-		printf("LF@v%d%s", scope->id, var->name);
-	}
+	return frameVariable(scope, var->name);
 }
 
-// result will be on top of stack
-static astDataType compileTerm(const astTerm* term) {
-	astDataType dataType;
-	dataType.nullable = false;
-
+// variable or literal as an instruction operand
+static irOperand termOperand(const astTerm* term) {
 	switch (term->type) {
-		case AST_TERM_ID: {
-			printf("PUSHS ");
-			emitVariableId(&term->identifier);
-			puts("");
-			symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, term->identifier.name, NULL);
-			dataType = slot->variable.type;
-			break;
-		}
+		case AST_TERM_ID:
+			return variableId(&term->identifier);
 		case AST_TERM_INT:
-			printf("PUSHS int@%d\n", term->integer.value);
-			dataType.type = AST_TYPE_INT;
-			break;
+			return irInt(term->integer.value);
 		case AST_TERM_DECIMAL:
-			printf("PUSHS float@%a\n", term->decimal.value);
-			dataType.type = AST_TYPE_DOUBLE;
-			break;
+			return irFloat(term->decimal.value);
 		case AST_TERM_STRING:
-			printf("PUSHS string@");
-			for (size_t i = 0; i < strlen(term->string.content); i++) {
-				char c = term->string.content[i];
-				if (isspace(c) || !isprint(c) || c == '#' || c == '\\') {
-					printf("\\%03d", (int)*((unsigned char*)(&c)));
-				} else {
-					putchar(c);
-				}
-			}
-			puts("");
-			dataType.type = AST_TYPE_STRING;
-			break;
+			return irString(term->string.content);
+		case AST_TERM_BOOL:
+			return irBool(term->boolean.value);
 		case AST_TERM_NIL:
-			puts("PUSHS nil@nil");
-			dataType.type = AST_TYPE_NIL;
 			break;
 	}
-
-	return dataType;
+	return irNil();
 }
 
 // result will be on top of stack
-static astDataType compileBinaryExpression(const astBinaryExpression* expr) {
-	astDataType lhsType = compileExpression(expr->lhs);
-	astDataType rhsType = compileExpression(expr->rhs);
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@res");
-	puts("DEFVAR TF@lhs");
-	puts("DEFVAR TF@rhs");
-	puts("POPS TF@rhs");
-	puts("POPS TF@lhs");
-
-	astDataType resultType;
-	resultType.nullable = false;
-
-	if (expr->op != AST_BINARY_NIL_COAL) {
-		// perform implicit conversion
-		if (lhsType.type == rhsType.type) {
-			// do nothing
-		} else if (lhsType.nullable && rhsType.type == AST_TYPE_NIL) {
-			// do nothing (for equality comparisons)
-		} else if (rhsType.nullable && lhsType.type == AST_TYPE_NIL) {
-			// do nothing (for equality comparisons)
-		} else if (lhsType.type == AST_TYPE_INT) {
-			puts("INT2FLOAT TF@lhs TF@lhs");
-			lhsType.type = AST_TYPE_DOUBLE;
-		} else if (rhsType.type == AST_TYPE_INT) {
-			puts("INT2FLOAT TF@rhs TF@rhs");
-			rhsType.type = AST_TYPE_DOUBLE;
-		}
+static void compileTerm(const astTerm* term) { emit1(IR_PUSHS, termOperand(term)); }
+
+// result will be on top of stack, converted from int to double if convert is set
+// int literals are pushed as float literals, so only computed values are converted at run time
+static void compileConvertedExpression(const astExpression* expr, bool convert) {
+	if (!convert) {
+		compileExpression(expr);
+	} else if (expr->type == AST_EXPR_TERM && expr->term.type == AST_TERM_INT) {
+		emit1(IR_PUSHS, irFloat(expr->term.integer.value));
+	} else {
+		compileExpression(expr);
+		emit0(IR_INT2FLOATS);
 	}
+}
+
+// result will be on top of stack
+// types and implicit conversions were decided by analyser and are read from the AST
+// stack instructions are used where they exist, operands are popped to temporaries only for CONCAT and ??
+static void compileBinaryExpression(const astBinaryExpression* expr, astDataType resultType) {
+	// operands have no side effects, so lhs can be converted before rhs is pushed above it
+	compileConvertedExpression(expr->lhs, expr->convertLhs);
+	compileConvertedExpression(expr->rhs, expr->convertRhs);
 
 	switch (expr->op) {
 		case AST_BINARY_MUL:
-			puts("MUL TF@res TF@lhs TF@rhs");
-			resultType.type = lhsType.type;
+			emit0(IR_MULS);
 			break;
 		case AST_BINARY_DIV:
-			if (lhsType.type == AST_TYPE_INT) {
-				puts("IDIV TF@res TF@lhs TF@rhs");
-			} else {
-				puts("DIV TF@res TF@lhs TF@rhs");
-			}
-			resultType.type = lhsType.type;
+			emit0(resultType.type == AST_TYPE_INT ? IR_IDIVS : IR_DIVS);
 			break;
 		case AST_BINARY_PLUS:
-			if (lhsType.type == AST_TYPE_STRING) {
-				puts("CONCAT TF@res TF@lhs TF@rhs");
+			if (resultType.type == AST_TYPE_STRING) {
+				irOperand lhs = temporaryFrameVariable("lhs");
+				irOperand rhs = temporaryFrameVariable("rhs");
+				emit0(IR_CREATEFRAME);
+				emit1(IR_DEFVAR, lhs);
+				emit1(IR_DEFVAR, rhs);
+				emit1(IR_POPS, rhs);
+				emit1(IR_POPS, lhs);
+				emit3(IR_CONCAT, lhs, lhs, rhs);
+				emit1(IR_PUSHS, lhs);
 			} else {
-				puts("ADD TF@res TF@lhs TF@rhs");
+				emit0(IR_ADDS);
 			}
-			resultType.type = lhsType.type;
 			break;
 		case AST_BINARY_MINUS:
-			puts("SUB TF@res TF@lhs TF@rhs");
-			resultType.type = lhsType.type;
+			emit0(IR_SUBS);
 			break;
 		case AST_BINARY_EQ:
-			puts("EQ TF@res TF@lhs TF@rhs");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_EQS);
 			break;
 		case AST_BINARY_NEQ:
-			puts("EQ TF@res TF@lhs TF@rhs");
-			puts("NOT TF@res TF@res");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_EQS);
+			emit0(IR_NOTS);
 			break;
 		case AST_BINARY_LESS:
-			puts("LT TF@res TF@lhs TF@rhs");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_LTS);
 			break;
 		case AST_BINARY_GREATER:
-			puts("GT TF@res TF@lhs TF@rhs");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_GTS);
 			break;
 		case AST_BINARY_LESS_EQ:
-			puts("GT TF@res TF@lhs TF@rhs");
-			puts("NOT TF@res TF@res");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_GTS);
+			emit0(IR_NOTS);
 			break;
 		case AST_BINARY_GREATER_EQ:
-			puts("LT TF@res TF@lhs TF@rhs");
-			puts("NOT TF@res TF@res");
-			resultType.type = AST_TYPE_BOOL;
+			emit0(IR_LTS);
+			emit0(IR_NOTS);
 			break;
 		case AST_BINARY_NIL_COAL: {
 			int coalLabel = newLabelName();
-			puts("MOVE TF@res TF@lhs");
-			printf("JUMPIFNEQ l%d TF@res nil@nil\n", coalLabel);
-			puts("MOVE TF@res TF@rhs");
-			printf("LABEL l%d\n", coalLabel);
-			resultType.type = rhsType.type;
+			irOperand result = temporaryFrameVariable("res");
+			irOperand rhs = temporaryFrameVariable("rhs");
+			emit0(IR_CREATEFRAME);
+			emit1(IR_DEFVAR, result);
+			emit1(IR_DEFVAR, rhs);
+			emit1(IR_POPS, rhs);
+			emit1(IR_POPS, result);
+			emit3(IR_JUMPIFNEQ, irLabelOperand(coalLabel), result, irNil());
+			emit2(IR_MOVE, result, rhs);
+			emit1(IR_LABEL, irLabelOperand(coalLabel));
+			emit1(IR_PUSHS, result);
 			break;
 		}
 	}
-	puts("PUSHS TF@res");
-	return resultType;
 }
 
-static astDataType compileUnwrapExpression(const astUnwrapExpression* expr) {
-	return compileExpression(expr->innerExpr);
-}
+static void compileUnwrapExpression(const astUnwrapExpression* expr) { compileExpression(expr->innerExpr); }
 
-static astDataType compileExpression(const astExpression* expr) {
+static void compileExpression(const astExpression* expr) {
 	switch (expr->type) {
 		case AST_EXPR_TERM:
-			return compileTerm(&expr->term);
+			compileTerm(&expr->term);
+			break;
 		case AST_EXPR_BINARY:
-			return compileBinaryExpression(&expr->binary);
+			compileBinaryExpression(&expr->binary, expr->dataType);
+			break;
 		case AST_EXPR_UNWRAP:
-			return compileUnwrapExpression(&expr->unwrap);
+			compileUnwrapExpression(&expr->unwrap);
+			break;
 	}
-	assert(false);
 }
 
-static void compileAssignment(const astAssignment* assignment) {
-	astDataType exprType = compileExpression(&assignment->value);
+// THREE-ADDRESS CODE
+// In this mode expressions are evaluated into numbered temporaries LF@t<n> of the current frame instead of the data
+// stack, so variables and literals are used directly as instruction operands. Temporaries are allocated in the order
+// of evaluation and each one is released right after its only use, the lowest free number is taken first. A function
+// thus needs as many of them as its deepest expression and they are declared once at the function entry.
+
+static bool USE_TEMPORARIES = false;
+
+typedef struct {
+	bool* busy;
+	int count;	// number of temporaries declared by the function being compiled
+	int capacity;
+} temporaryAllocator;
+
+static temporaryAllocator TEMPORARIES;
+
+static int allocateTemporary() {
+	for (int i = 0; i < TEMPORARIES.count; i++) {
+		if (!TEMPORARIES.busy[i]) {
+			TEMPORARIES.busy[i] = true;
+			return i;
+		}
+	}
+
+	if (TEMPORARIES.count == TEMPORARIES.capacity) {
+		int capacity = TEMPORARIES.capacity ? TEMPORARIES.capacity * 2 : 8;
+		bool* busy = realloc(TEMPORARIES.busy, capacity * sizeof(bool));
+		if (!busy) {
+			outOfMemory();
+		}
+		TEMPORARIES.busy = busy;
+		TEMPORARIES.capacity = capacity;
+	}
+	TEMPORARIES.busy[TEMPORARIES.count] = true;
+	return TEMPORARIES.count++;
+}
+
+static irOperand temporaryOperand(int number) { return irVariableOperand(IR_FRAME_LOCAL, 't', number, NULL); }
+
+static bool isTemporary(const irOperand* value) {
+	return value->type == IR_OPERAND_VARIABLE && value->frame == IR_FRAME_LOCAL && value->prefix == 't';
+}
+
+static void releaseOperand(const irOperand* value) {
+	if (isTemporary(value)) {
+		TEMPORARIES.busy[value->number] = false;
+	}
+}
 
-	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, assignment->variableName.name, NULL);
-	assert(slot);
-	if (exprType.type == AST_TYPE_INT && slot->variable.type.type == AST_TYPE_DOUBLE) {
-		// implicit conversion
-		puts("INT2FLOATS");
+static irOperand compileOperand(const astExpression* expr);
+
+// implicit int to double conversion, literals are converted right away
+static irOperand convertOperand(irOperand value) {
+	if (value.type == IR_OPERAND_INT) {
+		return irFloat(value.integer);
 	}
 
-	printf("POPS ");
-	emitVariableId(&assignment->variableName);
-	puts("");
+	releaseOperand(&value);
+	irOperand result = temporaryOperand(allocateTemporary());
+	emit2(IR_INT2FLOAT, result, value);
+	return result;
 }
 
-// noDeclareVars = turn variable declarations into assignments
-static void compileStatementBlock(const astStatementBlock* block, bool noDeclareVars) {
-	symStackPush(&VAR_SYM_STACK);
+// destination = variable for the result, a new temporary is used if NULL
+static irOperand compileBinaryOperation(const astBinaryExpression* expr, astDataType resultType,
+										const irOperand* destination) {
+	irOperand lhs = compileOperand(expr->lhs);
+	if (expr->convertLhs) {
+		lhs = convertOperand(lhs);
+	}
+	irOperand rhs = compileOperand(expr->rhs);
+	if (expr->convertRhs) {
+		rhs = convertOperand(rhs);
+	}
+	// all operands are read before the result is written, so their temporaries can hold it
+	releaseOperand(&lhs);
+	releaseOperand(&rhs);
+	irOperand result = destination ? *destination : temporaryOperand(allocateTemporary());
+
+	switch (expr->op) {
+		case AST_BINARY_MUL:
+			emit3(IR_MUL, result, lhs, rhs);
+			break;
+		case AST_BINARY_DIV:
+			emit3(resultType.type == AST_TYPE_INT ? IR_IDIV : IR_DIV, result, lhs, rhs);
+			break;
+		case AST_BINARY_PLUS:
+			emit3(resultType.type == AST_TYPE_STRING ? IR_CONCAT : IR_ADD, result, lhs, rhs);
+			break;
+		case AST_BINARY_MINUS:
+			emit3(IR_SUB, result, lhs, rhs);
+			break;
+		case AST_BINARY_EQ:
+			emit3(IR_EQ, result, lhs, rhs);
+			break;
+		case AST_BINARY_NEQ:
+			emit3(IR_EQ, result, lhs, rhs);
+			emit2(IR_NOT, result, result);
+			break;
+		case AST_BINARY_LESS:
+			emit3(IR_LT, result, lhs, rhs);
+			break;
+		case AST_BINARY_GREATER:
+			emit3(IR_GT, result, lhs, rhs);
+			break;
+		case AST_BINARY_LESS_EQ:
+			emit3(IR_GT, result, lhs, rhs);
+			emit2(IR_NOT, result, result);
+			break;
+		case AST_BINARY_GREATER_EQ:
+			emit3(IR_LT, result, lhs, rhs);
+			emit2(IR_NOT, result, result);
+			break;
+		case AST_BINARY_NIL_COAL: {
+			// the result may share a temporary with either operand, but only one of them is read on each path
+			int nilLabel = newLabelName();
+			int endLabel = newLabelName();
+			emit3(IR_JUMPIFEQ, irLabelOperand(nilLabel), lhs, irNil());
+			emit2(IR_MOVE, result, lhs);
+			emit1(IR_JUMP, irLabelOperand(endLabel));
+			emit1(IR_LABEL, irLabelOperand(nilLabel));
+			emit2(IR_MOVE, result, rhs);
+			emit1(IR_LABEL, irLabelOperand(endLabel));
+			break;
+		}
+	}
+	return result;
+}
+
+// variable or literal of the expression, or the temporary it was evaluated to
+static irOperand compileOperand(const astExpression* expr) {
+	if (expr->type == AST_EXPR_TERM) {
+		return termOperand(&expr->term);
+	} else if (expr->type == AST_EXPR_UNWRAP) {
+		return compileOperand(expr->unwrap.innerExpr);
+	}
+	return compileBinaryOperation(&expr->binary, expr->dataType, NULL);
+}
+
+// evaluates the value straight into the destination variable
+static void compileValueInto(const astExpression* value, bool convert, irOperand destination) {
+	if (value->type == AST_EXPR_BINARY && !convert) {
+		compileBinaryOperation(&value->binary, value->dataType, &destination);
+		return;
+	}
+
+	irOperand result = compileOperand(value);
+	if (convert) {
+		result = convertOperand(result);
+	}
+	emit2(IR_MOVE, destination, result);
+	releaseOperand(&result);
+}
+
+// starts a new set of temporaries for the code following the frame entry
+static temporaryAllocator beginTemporaries() {
+	temporaryAllocator outer = TEMPORARIES;
+	TEMPORARIES = (temporaryAllocator){NULL, 0, 0};
+	return outer;
+}
+
+// declares temporaries from the first one on at the entry of the code
+static void declareTemporaries(int entry, int first) {
+	int start = CODE.count;
+	for (int i = first; i < TEMPORARIES.count; i++) {
+		emit1(IR_DEFVAR, temporaryOperand(i));
+	}
+	irMoveBack(&CODE, entry, start);
+}
+
+// declares the temporaries at the frame entry and restores the outer set
+static void endTemporaries(int entry, temporaryAllocator outer) {
+	declareTemporaries(entry, 0);
+	free(TEMPORARIES.busy);
+	TEMPORARIES = outer;
+}
+
+static void compileAssignment(const astAssignment* assignment) {
+	if (USE_TEMPORARIES) {
+		compileValueInto(&assignment->value, assignment->convertValue, variableId(&assignment->variableName));
+		return;
+	}
+
+	compileConvertedExpression(&assignment->value, assignment->convertValue);
+	emit1(IR_POPS, variableId(&assignment->variableName));
+}
+
+// TAIL CALLS
+// A call of the compiled function itself right before its return would only pass the result back, so it does not
+// grow the call stack. Its arguments are pushed, the frame of the function is dropped and the code jumps back to where
+// the frame is created, the parameters are then popped by the entry code again.
+
+static const char* CURRENT_FUNCTION = NULL;  // name of the compiled function
+static int CURRENT_ENTRY;					  // label before the frame of the function is created
+// return executed right after the compiled statement, NULL if there is none, returns with a value are kept only for
+// the statement right before them
+static const astReturnStatement* CONTINUATION = NULL;
+static const astReturnStatement FUNCTION_END = {false};	 // end of a function without return value
+
+// inLoop = the block is inside a loop, see compileIteration
+static void compileStatementBlock(const astStatementBlock* block, bool inLoop) {
+	pushScope();
+	const astReturnStatement* outer = CONTINUATION;
 	for (int i = 0; i < block->count; i++) {
-		compileStatement(&block->statements[i], noDeclareVars);
+		if (i + 1 < block->count) {
+			const astStatement* next = &block->statements[i + 1];
+			CONTINUATION = next->type == AST_STATEMENT_RETURN ? &next->returnStmt : NULL;
+		} else {
+			CONTINUATION = outer && !outer->hasValue ? outer : NULL;
+		}
+		compileStatement(&block->statements[i], inLoop);
 	}
+	CONTINUATION = outer;
 	symStackPop(&VAR_SYM_STACK);
 }
 
-static void compileOptionalBinding(const astOptionalBinding* binding) {
-	printf("PUSHS ");
-	emitVariableId(&binding->identifier);
-	puts("");
-	puts("PUSHS nil@nil");
-	puts("EQS");
-	puts("NOTS");
+// BRANCHES
+// Conditions are compiled straight into conditional jumps, no bool is computed for them. == and != compare the
+// operands by the jump itself. Other comparisons compute LT or GT, as IFJcode23 has no jumps for them, and compare it
+// with a literal of the sense needed: a <= b holds when a > b is false and a >= b holds when a < b is false.
+
+static bool isComparison(astBinaryOperator op) {
+	return op == AST_BINARY_EQ || op == AST_BINARY_NEQ || op == AST_BINARY_LESS || op == AST_BINARY_GREATER ||
+		   op == AST_BINARY_LESS_EQ || op == AST_BINARY_GREATER_EQ;
 }
 
-// noDeclareVars = turn variable declarations into assignments
-static void compileConditional(const astConditional* conditional, bool noDeclareVars) {
-	astConditionType conditionType = conditional->condition.type;
-	if (conditionType == AST_CONDITION_EXPRESSION) {
-		compileExpression(&conditional->condition.expression);
+// LT or GT computed for the relation, holds = value of the relation when it is true
+static irOpcode relationOpcode(astBinaryOperator op, bool* holds) {
+	*holds = op == AST_BINARY_LESS || op == AST_BINARY_GREATER;
+	return op == AST_BINARY_LESS || op == AST_BINARY_GREATER_EQ ? IR_LT : IR_GT;
+}
+
+// jumps by comparing the operands, relation = variable for the result of LT or GT
+static void emitComparisonBranch(astBinaryOperator op, bool jumpIf, irOperand label, irOperand lhs, irOperand rhs,
+								 irOperand relation) {
+	if (op == AST_BINARY_EQ || op == AST_BINARY_NEQ) {
+		emit3(jumpIf == (op == AST_BINARY_EQ) ? IR_JUMPIFEQ : IR_JUMPIFNEQ, label, lhs, rhs);
+		return;
+	}
+	bool holds;
+	emit3(relationOpcode(op, &holds), relation, lhs, rhs);
+	emit3(IR_JUMPIFEQ, label, relation, irBool(holds == jumpIf));
+}
+
+// variable or literal usable as an operand without evaluation, int literals are converted right away
+static bool simpleOperand(const astExpression* expr, bool convert, irOperand* value) {
+	while (expr->type == AST_EXPR_UNWRAP) {
+		expr = expr->unwrap.innerExpr;
+	}
+	if (expr->type != AST_EXPR_TERM || (convert && expr->term.type != AST_TERM_INT)) {
+		return false;
+	}
+	*value = convert ? irFloat(expr->term.integer.value) : termOperand(&expr->term);
+	return true;
+}
+
+// stack variant of compileBranch, operands which need evaluation are compared on the stack
+static void compileStackComparisonBranch(const astBinaryExpression* expr, bool jumpIf, irOperand label) {
+	irOperand lhs;
+	irOperand rhs;
+	if (simpleOperand(expr->lhs, expr->convertLhs, &lhs) && simpleOperand(expr->rhs, expr->convertRhs, &rhs)) {
+		emitComparisonBranch(expr->op, jumpIf, label, lhs, rhs, rubbishVariable());
+		return;
+	}
+
+	compileConvertedExpression(expr->lhs, expr->convertLhs);
+	compileConvertedExpression(expr->rhs, expr->convertRhs);
+
+	if (expr->op == AST_BINARY_EQ || expr->op == AST_BINARY_NEQ) {
+		emit1(jumpIf == (expr->op == AST_BINARY_EQ) ? IR_JUMPIFEQS : IR_JUMPIFNEQS, label);
+		return;
+	}
+	bool holds;
+	emit0(relationOpcode(expr->op, &holds) == IR_LT ? IR_LTS : IR_GTS);
+	emit1(IR_PUSHS, irBool(holds == jumpIf));
+	emit1(IR_JUMPIFEQS, label);
+}
+
+// three-address variant of compileBranch
+static void compileComparisonBranch(const astBinaryExpression* expr, bool jumpIf, irOperand label) {
+	irOperand lhs = compileOperand(expr->lhs);
+	if (expr->convertLhs) {
+		lhs = convertOperand(lhs);
+	}
+	irOperand rhs = compileOperand(expr->rhs);
+	if (expr->convertRhs) {
+		rhs = convertOperand(rhs);
+	}
+	releaseOperand(&lhs);
+	releaseOperand(&rhs);
+	// the relation is used only by the jump right after it, so its temporary is free again
+	irOperand relation = temporaryOperand(allocateTemporary());
+	releaseOperand(&relation);
+	emitComparisonBranch(expr->op, jumpIf, label, lhs, rhs, relation);
+}
+
+// jumps to the label when the bool condition evaluates to jumpIf
+static void compileBranch(const astExpression* condition, bool jumpIf, irOperand label) {
+	if (condition->type == AST_EXPR_TERM && condition->term.type == AST_TERM_BOOL) {
+		if (condition->term.boolean.value == jumpIf) {
+			emit1(IR_JUMP, label);
+		}
+	} else if (condition->type == AST_EXPR_BINARY && isComparison(condition->binary.op)) {
+		if (USE_TEMPORARIES) {
+			compileComparisonBranch(&condition->binary, jumpIf, label);
+		} else {
+			compileStackComparisonBranch(&condition->binary, jumpIf, label);
+		}
+	} else if (USE_TEMPORARIES) {
+		irOperand value = compileOperand(condition);
+		releaseOperand(&value);
+		emit3(IR_JUMPIFEQ, label, value, irBool(jumpIf));
 	} else {
-		compileOptionalBinding(&conditional->condition.optBinding);
+		compileExpression(condition);
+		emit1(IR_PUSHS, irBool(jumpIf));
+		emit1(IR_JUMPIFEQS, label);
+	}
+}
+
+// jumps to the label when the condition does not hold, an optional binding does not hold for nil
+static void compileConditionJump(const astCondition* condition, irOperand label) {
+	if (condition->type == AST_CONDITION_EXPRESSION) {
+		compileBranch(&condition->expression, false, label);
+	} else {
+		emit3(IR_JUMPIFEQ, label, variableId(&condition->optBinding.identifier), irNil());
+	}
+}
+
+// inLoop = the statement is inside a loop, see compileIteration
+static void compileConditional(const astConditional* conditional, bool inLoop) {
+	astConditionType conditionType = conditional->condition.type;
+	const astExpression* condition = &conditional->condition.expression;
+	if (conditionType == AST_CONDITION_EXPRESSION && condition->type == AST_EXPR_TERM &&
+		condition->term.type == AST_TERM_BOOL) {
+		// branch decided by optimiser, only the taken one is left in body
+		assert(condition->term.boolean.value && !conditional->hasElse);
+		compileStatementBlock(&conditional->body, inLoop);
+		return;
 	}
 
 	int label1 = newLabelName();
-	puts("PUSHS bool@true");
-	printf("JUMPIFNEQS l%d\n", label1);
+	compileConditionJump(&conditional->condition, irLabelOperand(label1));
 
-	compileStatementBlock(&conditional->body, noDeclareVars);
+	compileStatementBlock(&conditional->body, inLoop);
 
 	if (!conditional->hasElse) {
-		printf("LABEL l%d\n", label1);
-		puts("CLEARS");
+		emit1(IR_LABEL, irLabelOperand(label1));
+		if (!USE_TEMPORARIES) {
+			emit0(IR_CLEARS);
+		}
 		return;
 	}
 
 	int label2 = newLabelName();
-	printf("JUMP l%d\n", label2);
-	printf("LABEL l%d\n", label1);
+	emit1(IR_JUMP, irLabelOperand(label2));
+	emit1(IR_LABEL, irLabelOperand(label1));
 
-	compileStatementBlock(&conditional->bodyElse, noDeclareVars);
+	compileStatementBlock(&conditional->bodyElse, inLoop);
 
-	printf("LABEL l%d\n", label2);
-	puts("CLEARS");
+	emit1(IR_LABEL, irLabelOperand(label2));
+	if (!USE_TEMPORARIES) {
+		emit0(IR_CLEARS);
+	}
 }
 
-// Recursively goes through the AST.
-// All variables declared inside while-loops will be created in the current scope to avoid redefinition.
-static void precompileVariableDefs(const astStatementBlock* block) {
-	for (int i = 0; i < block->count; i++) {
-		const astStatement* statement = &block->statements[i];
-		switch (statement->type) {
-			case AST_STATEMENT_VAR_DEF: {
-				compileVariableDef(&statement->variableDef, false, true);
-				break;
-			}
-
-			case AST_STATEMENT_COND:
-				precompileVariableDefs(&statement->conditional.body);
-				if (statement->conditional.hasElse) {
-					precompileVariableDefs(&statement->conditional.bodyElse);
-				}
-				break;
-
-			case AST_STATEMENT_ITER:
-				precompileVariableDefs(&statement->iteration.body);
-				break;
+// declaration of a variable of the source program, temporaries and frames of the runtime routines are not moved
+static bool isLocalDeclaration(const irInstruction* instruction) {
+	const irOperand* variable = &instruction->operands[0];
+	return instruction->opcode == IR_DEFVAR && variable->frame == IR_FRAME_LOCAL && variable->prefix == 'v';
+}
 
-			default:
-				// nothing
-				break;
+// moves the declarations of the variables in a loop since position before it, as a variable must be declared once
+static void hoistDeclarations(int position) {
+	int declared = position;
+	for (int i = position; i < CODE.count; i++) {
+		if (isLocalDeclaration(&CODE.data[i])) {
+			irInstruction declaration = CODE.data[i];
+			memmove(&CODE.data[declared + 1], &CODE.data[declared], (i - declared) * sizeof(irInstruction));
+			CODE.data[declared++] = declaration;
 		}
 	}
 }
 
-// noDeclareVars = turn variable declarations into assignments
-static void compileIteration(const astIteration* iteration, bool noDeclareVars) {
-	symStackPush(&VAR_SYM_STACK);  // used for predefined variables
-	if (!noDeclareVars) {
-		precompileVariableDefs(&iteration->body);
-	}
+// inLoop = the statement is inside another loop, which moves the declarations of both before itself
+static void compileIteration(const astIteration* iteration, bool inLoop) {
+	int position = CODE.count;
 	int startLabel = newLabelName();
 	int condLabel = newLabelName();
-	printf("JUMP l%d\n", condLabel);
-	printf("LABEL l%d\n", startLabel);
-	// body
+	emit1(IR_JUMP, irLabelOperand(condLabel));
+	emit1(IR_LABEL, irLabelOperand(startLabel));
+	// body, the condition follows it
+	const astReturnStatement* continuation = CONTINUATION;
+	CONTINUATION = NULL;
 	compileStatementBlock(&iteration->body, true);
+	CONTINUATION = continuation;
 	// condition
-	symStackPop(&VAR_SYM_STACK);  // used for predefined variables
-	printf("LABEL l%d\n", condLabel);
-	compileExpression(&iteration->condition);
-	puts("PUSHS bool@true");
-	printf("JUMPIFEQS l%d\n", startLabel);
-	puts("CLEARS");
+	emit1(IR_LABEL, irLabelOperand(condLabel));
+	compileBranch(&iteration->condition, true, irLabelOperand(startLabel));
+	if (!USE_TEMPORARIES) {
+		emit0(IR_CLEARS);
+	}
+	emit0(IR_CLEARS);
+	if (!inLoop) {
+		hoistDeclarations(position);
+	}
 }
 
 static void compileReturn(const astReturnStatement* statement) {
-	if (statement->hasValue) {
+	if (statement->hasValue && USE_TEMPORARIES) {
+		irOperand value = compileOperand(&statement->value);
+		releaseOperand(&value);
+		emit1(IR_PUSHS, value);
+	} else if (statement->hasValue) {
 		compileExpression(&statement->value);
 	}
-	puts("POPFRAME");
-	puts("RETURN");
+	emit0(IR_POPFRAME);
+	emit0(IR_RETURN);
 }
 
-static void compileBuiltInReadString() {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@temp");
-	puts("READ TF@temp string");
-	puts("PUSHS TF@temp");
+static void compileBuiltInRead(const char* type) {
+	irOperand temp = temporaryFrameVariable("temp");
+	emit0(IR_CREATEFRAME);
+	emit1(IR_DEFVAR, temp);
+	emit2(IR_READ, temp, irType(type));
+	emit1(IR_PUSHS, temp);
 }
 
-static void compileBuiltInReadInt() {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@temp");
-	puts("READ TF@temp int");
-	puts("PUSHS TF@temp");
-}
+static void compileBuiltInReadString() { compileBuiltInRead("string"); }
 
-static void compileBuiltInReadDouble() {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@temp");
-	puts("READ TF@temp float");
-	puts("PUSHS TF@temp");
-}
+static void compileBuiltInReadInt() { compileBuiltInRead("int"); }
+
+static void compileBuiltInReadDouble() { compileBuiltInRead("float"); }
 
 static void compileBuiltInWrite(int parameterCount) {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@temp");
+	irOperand temp = temporaryFrameVariable("temp");
+	emit0(IR_CREATEFRAME);
+	emit1(IR_DEFVAR, temp);
 	for (int i = 0; i < parameterCount; i++) {
-		puts("POPS TF@temp");
-		puts("WRITE TF@temp");
+		emit1(IR_POPS, temp);
+		emit1(IR_WRITE, temp);
 	}
 }
 
-static void compileBuiltInInt2Double() { puts("INT2FLOATS"); }
+static void compileBuiltInInt2Double() { emit0(IR_INT2FLOATS); }
 
-static void compileBuiltInDouble2Int() { puts("FLOAT2INTS"); }
+static void compileBuiltInDouble2Int() { emit0(IR_FLOAT2INTS); }
 
 static void compileBuiltInLength() {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@temp");
-	puts("POPS TF@temp");
-	puts("STRLEN TF@temp TF@temp");
-	puts("PUSHS TF@temp");
+	irOperand temp = temporaryFrameVariable("temp");
+	emit0(IR_CREATEFRAME);
+	emit1(IR_DEFVAR, temp);
+	emit1(IR_POPS, temp);
+	emit2(IR_STRLEN, temp, temp);
+	emit1(IR_PUSHS, temp);
 }
 
-static void compileBuiltInSubstring() {
-	puts("CREATEFRAME");
+// RUNTIME LIBRARY
+// Builtins with longer bodies are either inlined at their call sites, or compiled once into a subroutine after the
+// main body if the program calls them from more places than is worth the growth of the code. The bodies take their
+// arguments from the stack, work in the temporary frame and push the result, so calls differ only in the CALL.
+
+// how many instructions inlining one builtin at all its call sites may add to the program
+#define RUNTIME_MAX_GROWTH 24
+
+typedef struct {
+	const char* label;
+	// exit = label jumped to after the result is pushed (RETURN if none), the last path falls through the end instead
+	void (*compileBody)(irOperand exit);
+} runtimeRoutine;
+
+static void leaveRoutine(irOperand exit) {
+	if (exit.type == IR_OPERAND_NONE) {
+		emit0(IR_RETURN);
+	} else {
+		emit1(IR_JUMP, exit);
+	}
+}
+
+// nil unless 0 <= start < length and start <= end <= length
+static void compileSubstringBody(irOperand exit) {
+	irOperand str = temporaryFrameVariable("str");
+	irOperand start = temporaryFrameVariable("start");	// also index of the next copied character
+	irOperand end = temporaryFrameVariable("end");
+	irOperand len = temporaryFrameVariable("len");
+	irOperand condition = temporaryFrameVariable("cond");
+	irOperand result = temporaryFrameVariable("result");
+	irOperand character = temporaryFrameVariable("char");
+	emit0(IR_CREATEFRAME);
 	// parameters
-	puts("DEFVAR TF@str");
-	puts("POPS TF@str");
-	puts("DEFVAR TF@start");
-	puts("POPS TF@start");
-	puts("DEFVAR TF@end");
-	puts("POPS TF@end");
-
-	// parameter errors
-	int errorLabel = newLabelName();
-	puts("DEFVAR TF@error_temp");
-	puts("DEFVAR TF@len");
-	puts("STRLEN TF@len TF@str");
-	// start < 0
-	puts("LT TF@error_temp TF@start int@0");
-	printf("JUMPIFEQ l%d TF@error_temp bool@true\n", errorLabel);
-	// end < 0
-	puts("LT TF@error_temp TF@end int@0");
-	printf("JUMPIFEQ l%d TF@error_temp bool@true\n", errorLabel);
-	// start > end
-	puts("GT TF@error_temp TF@start TF@end");
-	printf("JUMPIFEQ l%d TF@error_temp bool@true\n", errorLabel);
-	// start >= length
-	puts("LT TF@error_temp TF@start TF@len");  // !(start < length)
-	printf("JUMPIFEQ l%d TF@error_temp bool@false\n", errorLabel);
-	// end > length
-	puts("GT TF@error_temp TF@end TF@len");
-	printf("JUMPIFEQ l%d TF@error_temp bool@true\n", errorLabel);
-
-	// create string
-	puts("DEFVAR TF@result");
-	puts("MOVE TF@result string@");
-	puts("DEFVAR TF@index");
-	puts("MOVE TF@index TF@start");
-	puts("DEFVAR TF@char");
-	// loop
-	int loop0 = newLabelName();
-	int loop1 = newLabelName();
-	printf("JUMP l%d\n", loop0);
-	printf("LABEL l%d\n", loop1);
-	puts("GETCHAR TF@char TF@str TF@index");
-	puts("CONCAT TF@result TF@result TF@char");
-	puts("ADD TF@index TF@index int@1");
-	printf("LABEL l%d\n", loop0);
-	printf("JUMPIFNEQ l%d TF@index TF@end\n", loop1);
-
-	// return value
-	puts("PUSHS TF@result");
-	int noErrorLabel = newLabelName();
-	printf("JUMP l%d\n", noErrorLabel);
+	emit1(IR_DEFVAR, str);
+	emit1(IR_POPS, str);
+	emit1(IR_DEFVAR, start);
+	emit1(IR_POPS, start);
+	emit1(IR_DEFVAR, end);
+	emit1(IR_POPS, end);
+
+	// parameter errors, end < 0 follows from the others
+	irOperand errorLabel = irLabelOperand(newLabelName());
+	emit1(IR_DEFVAR, len);
+	emit2(IR_STRLEN, len, str);
+	emit1(IR_DEFVAR, condition);
+	emit3(IR_LT, condition, start, irInt(0));
+	emit3(IR_JUMPIFEQ, errorLabel, condition, irBool(true));
+	emit3(IR_GT, condition, start, end);
+	emit3(IR_JUMPIFEQ, errorLabel, condition, irBool(true));
+	emit3(IR_GT, condition, end, len);
+	emit3(IR_JUMPIFEQ, errorLabel, condition, irBool(true));
+	// start <= end <= length, so start >= length only if they are equal
+	emit3(IR_JUMPIFEQ, errorLabel, start, len);
+
+	// the first character starts the result, the rest are appended to it
+	irOperand emptyLabel = irLabelOperand(newLabelName());
+	irOperand loopLabel = irLabelOperand(newLabelName());
+	irOperand doneLabel = irLabelOperand(newLabelName());
+	emit3(IR_JUMPIFEQ, emptyLabel, start, end);
+	emit1(IR_DEFVAR, result);
+	emit3(IR_GETCHAR, result, str, start);
+	emit3(IR_ADD, start, start, irInt(1));
+	emit3(IR_JUMPIFEQ, doneLabel, start, end);
+	emit1(IR_DEFVAR, character);
+	emit1(IR_LABEL, loopLabel);
+	emit3(IR_GETCHAR, character, str, start);
+	emit3(IR_CONCAT, result, result, character);
+	emit3(IR_ADD, start, start, irInt(1));
+	emit3(IR_JUMPIFNEQ, loopLabel, start, end);
+	emit1(IR_LABEL, doneLabel);
+	emit1(IR_PUSHS, result);
+	leaveRoutine(exit);
+
+	emit1(IR_LABEL, emptyLabel);
+	emit1(IR_PUSHS, irString(""));
+	leaveRoutine(exit);
 
 	// return nil on error
-	printf("LABEL l%d\n", errorLabel);
-	puts("PUSHS nil@nil");
+	emit1(IR_LABEL, errorLabel);
+	emit1(IR_PUSHS, irNil());
+}
+
+// 0 for the empty string
+static void compileOrdBody(irOperand exit) {
+	irOperand str = temporaryFrameVariable("str");
+	irOperand emptyLabel = irLabelOperand(newLabelName());
+	emit0(IR_CREATEFRAME);
+	emit1(IR_DEFVAR, str);
+	emit1(IR_POPS, str);
+	emit3(IR_JUMPIFEQ, emptyLabel, str, irString(""));
+	emit1(IR_PUSHS, str);
+	emit1(IR_PUSHS, irInt(0));
+	emit0(IR_STRI2INTS);
+	leaveRoutine(exit);
+
+	emit1(IR_LABEL, emptyLabel);
+	emit1(IR_PUSHS, irInt(0));
+}
+
+static const runtimeRoutine RUNTIME_ROUTINES[BUILTIN_COUNT] = {
+	[BUILTIN_SUBSTRING] = {"$substring", compileSubstringBody},
+	[BUILTIN_ORD] = {"$ord", compileOrdBody},
+};
+
+static int RUNTIME_CALLS[BUILTIN_COUNT];  // call sites of the routines in the program
+static int RUNTIME_SIZES[BUILTIN_COUNT];  // instructions of the bodies
+
+static bool isRuntimeRoutine(int funcId) { return isBuiltinFunction(funcId) && RUNTIME_ROUTINES[funcId].compileBody; }
+
+static bool inlineRuntimeRoutine(builtinFunction builtin) {
+	return (RUNTIME_CALLS[builtin] - 1) * RUNTIME_SIZES[builtin] <= RUNTIME_MAX_GROWTH;
+}
 
-	printf("LABEL l%d\n", noErrorLabel);
+// compiles each body once and throws the code away, the labels it took are given back
+static void measureRuntimeRoutines() {
+	int lastLabelName = LAST_LABEL_NAME;
+	for (int i = 0; i < BUILTIN_COUNT; i++) {
+		if (isRuntimeRoutine(i)) {
+			int start = CODE.count;
+			RUNTIME_ROUTINES[i].compileBody(irNone());
+			RUNTIME_SIZES[i] = CODE.count - start;
+			CODE.count = start;
+		}
+	}
+	LAST_LABEL_NAME = lastLabelName;
 }
 
-static void compileBuiltInOrd() {
-	puts("CREATEFRAME");
-	puts("DEFVAR TF@res");
-	puts("DEFVAR TF@str");
-	puts("POPS TF@str");
-	puts("DEFVAR TF@len");
-	puts("STRLEN TF@len TF@str");
+static void compileRuntimeCall(builtinFunction builtin) {
+	const runtimeRoutine* routine = &RUNTIME_ROUTINES[builtin];
+	if (!inlineRuntimeRoutine(builtin)) {
+		emit1(IR_CALL, irFunctionLabel(routine->label));
+		return;
+	}
+	irOperand exit = irLabelOperand(newLabelName());
+	routine->compileBody(exit);
+	emit1(IR_LABEL, exit);
+}
 
-	int errorLabel = newLabelName();
-	int endLabel = newLabelName();
+static void countRuntimeCall(int funcId) {
+	if (isRuntimeRoutine(funcId)) {
+		RUNTIME_CALLS[funcId]++;
+	}
+}
 
-	// error check
-	printf("JUMPIFEQ l%d TF@len int@0\n", errorLabel);
+static void countRuntimeCalls(const astStatementBlock* block);
 
-	// normal path
-	puts("STRI2INT TF@res TF@str int@0");
-	printf("JUMP l%d\n", endLabel);
+static void countStatementRuntimeCalls(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			if (statement->variableDef.hasInitValue && statement->variableDef.value.type == AST_VAR_INIT_FUNC) {
+				countRuntimeCall(statement->variableDef.value.call.funcId);
+			}
+			break;
+		case AST_STATEMENT_FUNC_CALL:
+			countRuntimeCall(statement->functionCall.funcId);
+			break;
+		case AST_STATEMENT_PROC_CALL:
+			countRuntimeCall(statement->procedureCall.funcId);
+			break;
+		case AST_STATEMENT_COND:
+			countRuntimeCalls(&statement->conditional.body);
+			if (statement->conditional.hasElse) {
+				countRuntimeCalls(&statement->conditional.bodyElse);
+			}
+			break;
+		case AST_STATEMENT_ITER:
+			countRuntimeCalls(&statement->iteration.body);
+			break;
+		default:
+			break;
+	}
+}
 
-	// error path
-	printf("LABEL l%d\n", errorLabel);
-	puts("MOVE TF@res int@0");
+static void countRuntimeCalls(const astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		countStatementRuntimeCalls(&block->statements[i]);
+	}
+}
 
-	// common path
-	printf("LABEL l%d\n", endLabel);
-	puts("PUSHS TF@res");
+// subroutines of the routines which are called and not inlined, jumped over by the main body
+static void compileRuntimeLibrary() {
+	int endLabel = -1;
+	for (int i = 0; i < BUILTIN_COUNT; i++) {
+		if (!isRuntimeRoutine(i) || !RUNTIME_CALLS[i] || inlineRuntimeRoutine(i)) {
+			continue;
+		}
+		if (endLabel < 0) {
+			endLabel = newLabelName();
+			emit1(IR_JUMP, irLabelOperand(endLabel));
+		}
+		emit1(IR_LABEL, irFunctionLabel(RUNTIME_ROUTINES[i].label));
+		RUNTIME_ROUTINES[i].compileBody(irNone());
+		emit0(IR_RETURN);
+	}
+	if (endLabel >= 0) {
+		emit1(IR_LABEL, irLabelOperand(endLabel));
+	}
 }
 
-static void compileBuiltInChr() { puts("INT2CHARS"); }
+static void compileBuiltInSubstring() { compileRuntimeCall(BUILTIN_SUBSTRING); }
+
+static void compileBuiltInOrd() { compileRuntimeCall(BUILTIN_ORD); }
+
+static void compileBuiltInChr() { emit0(IR_INT2CHARS); }
 
 static void compileInputParamList(const astInputParameterList* list) {
 	// parameters are pushed to the stack right to left
@@ -480,135 +890,128 @@ static void compileInputParamList(const astInputParameterList* list) {
 	}
 }
 
+// code generators of builtin functions, arguments are on the stack and result is pushed to it
+static void (*const BUILTIN_COMPILERS[BUILTIN_COUNT])() = {
+	[BUILTIN_READ_STRING] = compileBuiltInReadString,
+	[BUILTIN_READ_INT] = compileBuiltInReadInt,
+	[BUILTIN_READ_DOUBLE] = compileBuiltInReadDouble,
+	[BUILTIN_INT2DOUBLE] = compileBuiltInInt2Double,
+	[BUILTIN_DOUBLE2INT] = compileBuiltInDouble2Int,
+	[BUILTIN_LENGTH] = compileBuiltInLength,
+	[BUILTIN_SUBSTRING] = compileBuiltInSubstring,
+	[BUILTIN_ORD] = compileBuiltInOrd,
+	[BUILTIN_CHR] = compileBuiltInChr,
+};
+
+// result = variable receiving the result of the call, NULL if it is thrown away
+static bool isTailCall(const astIdentifier* function, const astIdentifier* result) {
+	if (!CURRENT_FUNCTION || !CONTINUATION || strcmp(function->name, CURRENT_FUNCTION) != 0) {
+		return false;
+	}
+	if (!result) {
+		return !CONTINUATION->hasValue;
+	}
+	const astExpression* value = &CONTINUATION->value;
+	return CONTINUATION->hasValue && value->type == AST_EXPR_TERM && value->term.type == AST_TERM_ID &&
+		   strcmp(value->term.identifier.name, result->name) == 0;
+}
+
+static void compileTailCall(const astInputParameterList* params) {
+	compileInputParamList(params);
+	emit0(IR_POPFRAME);
+	emit1(IR_JUMP, irLabelOperand(CURRENT_ENTRY));
+}
+
 static void compileProcedureCall(const astProcedureCall* call) {
+	if (isTailCall(&call->procName, NULL)) {
+		compileTailCall(&call->params);
+		return;
+	}
 	compileInputParamList(&call->params);
 
-	if (strcmp(call->procName.name, "write") == 0) {
+	if (call->funcId == SYM_FUNC_NONE) {
+		// analyser leaves only write unresolved
 		compileBuiltInWrite(call->params.count);
+	} else if (isBuiltinFunction(call->funcId)) {
+		BUILTIN_COMPILERS[call->funcId]();	// result is thrown away by CLEARS
 	} else {
-		printf("CALL l%s\n", call->procName.name);
+		emit1(IR_CALL, irFunctionLabel(call->procName.name));
 	}
 
-	puts("CLEARS");
+	emit0(IR_CLEARS);
 }
 
 // newVariable = function call is used inside variable declaration, so the variable hasn't been added to the symtable
 // yet.
 static void compileFunctionCall(const astFunctionCall* call, bool newVariable) {
-	compileInputParamList(&call->params);
-
-	if (strcmp(call->funcName.name, "readString") == 0) {
-		compileBuiltInReadString();
-	} else if (strcmp(call->funcName.name, "readInt") == 0) {
-		compileBuiltInReadInt();
-	} else if (strcmp(call->funcName.name, "readDouble") == 0) {
-		compileBuiltInReadDouble();
-	} else if (strcmp(call->funcName.name, "Int2Double") == 0) {
-		compileBuiltInInt2Double();
-	} else if (strcmp(call->funcName.name, "Double2Int") == 0) {
-		compileBuiltInDouble2Int();
-	} else if (strcmp(call->funcName.name, "length") == 0) {
-		compileBuiltInLength();
-	} else if (strcmp(call->funcName.name, "substring") == 0) {
-		compileBuiltInSubstring();
-	} else if (strcmp(call->funcName.name, "ord") == 0) {
-		compileBuiltInOrd();
-	} else if (strcmp(call->funcName.name, "chr") == 0) {
-		compileBuiltInChr();
-	} else {
-		printf("CALL l%s\n", call->funcName.name);
+	symbolScope* scope = NULL;
+	// assignments of global variables are seen by the caller
+	bool local = newVariable || (symStackLookup(&VAR_SYM_STACK, call->varName.name, &scope) &&
+								 scope != symStackGlobalScope(&VAR_SYM_STACK));
+	if (local && isTailCall(&call->funcName, &call->varName)) {
+		compileTailCall(&call->params);
+		return;
 	}
+	compileInputParamList(&call->params);
 
-	printf("POPS ");
-
-	if (newVariable) {
-		emitNewVariableId(&call->varName);
+	if (isBuiltinFunction(call->funcId)) {
+		BUILTIN_COMPILERS[call->funcId]();
 	} else {
-		emitVariableId(&call->varName);
+		emit1(IR_CALL, irFunctionLabel(call->funcName.name));
 	}
 
-	puts("");
-	puts("CLEARS");
+	emit1(IR_POPS, newVariable ? newVariableId(&call->varName) : variableId(&call->varName));
+	emit0(IR_CLEARS);
 }
 
-// assignmentOnly = compile variable declaration as assignment
-// predefine = this declaration is a part of while-loop variable predifinition
-static void compileVariableDef(const astVariableDefinition* def, bool assignmentOnly, bool predefine) {
-	if (!assignmentOnly) {
-		printf("DEFVAR ");
-		emitNewVariableId(&def->variableName);
-		puts("");
-	} else {
-		// assignment only - validate in symtable
-		symStackValidate(&VAR_SYM_STACK, def->variableName.name);
+static void compileVariableDef(const astVariableDefinition* def) {
+	// a tail call leaves the function before the variable would be assigned
+	bool tailCall = def->hasInitValue && def->value.type == AST_VAR_INIT_FUNC &&
+					isTailCall(&def->value.call.funcName, &def->variableName);
+	if (!tailCall) {
+		emit1(IR_DEFVAR, newVariableId(&def->variableName));
 	}
 
-	astDataType variableType = def->variableType;
 	if (def->hasInitValue) {
-		if (!predefine) {
-			if (def->value.type == AST_VAR_INIT_EXPR) {
-				// compile initialiser
-				astDataType expressionType = compileExpression(&def->value.expr);
-				if (!def->hasExplicitType) {
-					if (assignmentOnly) {
-						symStackSetVarType(&VAR_SYM_STACK, def->variableName.name, expressionType);
-					} else {
-						variableType = expressionType;
-					}
-				}
-				// convert int to double if needed
-				if (def->hasExplicitType && def->variableType.type == AST_TYPE_DOUBLE &&
-					expressionType.type == AST_TYPE_INT) {
-					puts("INT2FLOATS");
-				}
-				printf("POPS ");
-				if (assignmentOnly) {
-					emitVariableId(&def->variableName);
-				} else {
-					emitNewVariableId(&def->variableName);
-				}
-				puts("");
+		if (def->value.type == AST_VAR_INIT_EXPR) {
+			irOperand variable = newVariableId(&def->variableName);
+			if (USE_TEMPORARIES) {
+				compileValueInto(&def->value.expr, def->convertValue, variable);
 			} else {
-				// copmpile initialiser
-				const symbolTableSlot* funcSlot =
-					symTableLookup((symbolTable*)FUNC_SYM_TABLE, def->value.call.funcName.name);
-				assert(funcSlot);
-				if (assignmentOnly) {
-					symStackSetVarType(&VAR_SYM_STACK, def->variableName.name, funcSlot->function.returnType);
-				} else {
-					variableType = funcSlot->function.returnType;
-				}
-				compileFunctionCall(&def->value.call, !assignmentOnly);
+				// compile initialiser, int to double conversion if needed
+				compileConvertedExpression(&def->value.expr, def->convertValue);
+				emit1(IR_POPS, variable);
 			}
+		} else {
+			// copmpile initialiser
+			compileFunctionCall(&def->value.call, true);
 		}
-	} else if (def->variableType.nullable) {
-		// default nil init
-		printf("MOVE ");
-		emitNewVariableId(&def->variableName);
-		puts(" nil@nil");
+	} else if (def->nilInit) {
+		// default nil init, repeated in every iteration of a loop
+		emit2(IR_MOVE, newVariableId(&def->variableName), irNil());
 	}
 
-	if (!assignmentOnly) {
-		// insert into symtable
-		symbolVariable newVar = {variableType, def->immutable, NULL};
-		assert(symTableInsertVar(symStackCurrentScope(&VAR_SYM_STACK), newVar, def->variableName.name, !predefine));
+	// insert into symtable
+	symbolVariable newVar = {def->variableType, def->immutable, NULL, NULL};
+	if (!symStackInsertVar(&VAR_SYM_STACK, newVar, def->variableName.name)) {
+		outOfMemory();	// every block has a scope of its own, so the analyser has rejected all redefinitions
 	}
 }
 
-// noDeclareVars = turn variable declarations into assignments
-static void compileStatement(const astStatement* statement, bool noDeclareVars) {
+// inLoop = the statement is inside a loop, see compileIteration
+static void compileStatement(const astStatement* statement, bool inLoop) {
 	switch (statement->type) {
 		case AST_STATEMENT_VAR_DEF:
-			compileVariableDef(&statement->variableDef, noDeclareVars, false);
+			compileVariableDef(&statement->variableDef);
 			break;
 		case AST_STATEMENT_ASSIGN:
 			compileAssignment(&statement->assignment);
 			break;
 		case AST_STATEMENT_COND:
-			compileConditional(&statement->conditional, noDeclareVars);
+			compileConditional(&statement->conditional, inLoop);
 			break;
 		case AST_STATEMENT_ITER:
-			compileIteration(&statement->iteration, noDeclareVars);
+			compileIteration(&statement->iteration, inLoop);
 			break;
 		case AST_STATEMENT_FUNC_CALL:
 			compileFunctionCall(&statement->functionCall, false);
@@ -624,50 +1027,88 @@ static void compileStatement(const astStatement* statement, bool noDeclareVars)
 
 void compileFunctionDef(const astFunctionDefinition* def) {
 	int funcEndLabel = newLabelName();
-	printf("JUMP l%d\n", funcEndLabel);
-	printf("LABEL l%s\n", def->name.name);
+	emit1(IR_JUMP, irLabelOperand(funcEndLabel));
+	emit1(IR_LABEL, irFunctionLabel(def->name.name));
+	CURRENT_FUNCTION = def->name.name;
+	CURRENT_ENTRY = newLabelName();
+	emit1(IR_LABEL, irLabelOperand(CURRENT_ENTRY));
 	PUSH_FRAME();
 	// add params to symtable
 	for (int i = 0; i < def->params.count; i++) {
 		astParameter* param = &def->params.data[i];
-		symbolVariable symbol = {param->dataType, true, symStackCurrentScope(&VAR_SYM_STACK)};
-		assert(symTableInsertVar(symStackCurrentScope(&VAR_SYM_STACK), symbol, param->insideName.name, true));
+		symbolVariable symbol = {param->dataType, true, symStackCurrentScope(&VAR_SYM_STACK), NULL};
+		if (!symStackInsertVar(&VAR_SYM_STACK, symbol, param->insideName.name)) {
+			outOfMemory();
+		}
 	}
-	symStackPush(&VAR_SYM_STACK);  // create new symtable scope so variables can shadow params
+	pushScope();  // create new symtable scope so variables can shadow params
 	// parameters are read left to right
 	for (int i = 0; i < def->params.count; i++) {
 		astParameter* param = &def->params.data[i];
 		if (param->used) {
-			printf("DEFVAR ");
-			emitVariableId(&(param->insideName));
-			puts("");
-			printf("POPS ");
-			emitVariableId(&(param->insideName));
-			puts("");
+			emit1(IR_DEFVAR, variableId(&(param->insideName)));
+			emit1(IR_POPS, variableId(&(param->insideName)));
 		} else {
-			puts("POPS GF@$rubbish");
+			emit1(IR_POPS, rubbishVariable());
 		}
 	}
+	int entry = CODE.count;
+	temporaryAllocator outer = beginTemporaries();
+	CONTINUATION = def->hasReturnValue ? NULL : &FUNCTION_END;
 	compileStatementBlock(&def->body, false);
+	CONTINUATION = NULL;
+	CURRENT_FUNCTION = NULL;
+	endTemporaries(entry, outer);
 	symStackPop(&VAR_SYM_STACK);
 	POP_FRAME();
-	puts("RETURN");
-	printf("LABEL l%d\n", funcEndLabel);
+	emit0(IR_RETURN);
+	emit1(IR_LABEL, irLabelOperand(funcEndLabel));
 }
 
-void compileProgram(const astProgram* program, const symbolTable* functionTable) {
+void compileProgram(const astProgram* program, const symbolFuncTable* functionTable, bool useTemporaries,
+					codeConsumer consumer) {
 	FUNC_SYM_TABLE = functionTable;
-	symStackCreate(&VAR_SYM_STACK);
-	puts(".IFJcode23");
-	puts("DEFVAR GF@$rubbish");	 // for removing rubbish from stack
-	PUSH_FRAME();				 // global scope + frame for local variables that are not in functions
+	USE_TEMPORARIES = useTemporaries;
+	irCodeCreate(&CODE);
+	if (!symStackCreate(&VAR_SYM_STACK)) {
+		outOfMemory();
+	}
+	measureRuntimeRoutines();
+	memset(RUNTIME_CALLS, 0, sizeof(RUNTIME_CALLS));
+	for (int i = 0; i < program->count; i++) {
+		const astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_STATEMENT) {
+			countStatementRuntimeCalls(&topStatement->statement);
+		} else {
+			countRuntimeCalls(&topStatement->functionDef.body);
+		}
+	}
+	emit1(IR_DEFVAR, rubbishVariable());
+	PUSH_FRAME();  // global scope + frame for local variables that are not in functions
+	consumer(&CODE);
+
+	// global code runs once from top to bottom, so each statement declares the temporaries it needs first
+	temporaryAllocator outer = beginTemporaries();
+	int declared = 0;
 	for (int i = 0; i < program->count; i++) {
+		CODE.count = 0;
 		const astTopLevelStatement* topStatement = &program->statements[i];
 		if (topStatement->type == AST_TOP_STATEMENT) {
 			compileStatement(&topStatement->statement, false);
+			declareTemporaries(0, declared);
+			declared = TEMPORARIES.count;
 		} else {
 			compileFunctionDef(&topStatement->functionDef);
 		}
+		consumer(&CODE);
 	}
+	free(TEMPORARIES.busy);
+	TEMPORARIES = outer;
+
+	CODE.count = 0;
 	POP_FRAME();
+	compileRuntimeLibrary();
+	consumer(&CODE);
+	irCodeDestroy(&CODE);
+	symStackDestroy(&VAR_SYM_STACK);
 }
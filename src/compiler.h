@@ -12,8 +12,15 @@
 #define COMPILER_H
 
 #include "ast.h"
+#include "ir.h"
 #include "symtable.h"
 
-void compileProgram(const astProgram*, const symbolTable* functionTable);
+// Receives the generated code piece by piece (each top-level statement and function separately), so the whole
+// program never has to be kept in memory. The code may be modified, it is cleared after the call.
+typedef void (*codeConsumer)(irCode* code);
+
+// useTemporaries = evaluate expressions into frame temporaries (three-address code) instead of the data stack
+void compileProgram(const astProgram*, const symbolFuncTable* functionTable, bool useTemporaries,
+					codeConsumer consumer);
 
 #endif
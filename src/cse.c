@@ -0,0 +1,606 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "cse.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "builtins.h"
+#include "optimiser.h"
+
+// Statements
+//     let x = a * b + a * b
+//     let l1 = length(s)
+//     let y = a * b
+//     let l2 = length(s)
+// become
+//     let $cse1 = a * b
+//     let x = $cse1 + $cse1
+//     let l1 = length(s)
+//     let y = $cse1
+//     let l2 = l1
+// Values are numbered within a run of statements up to the next loop or conditional. Every assignment of a variable
+// gives it a new version and the key of a value names the versions of its variables, so a value computed before the
+// assignment is never taken for one computed after it. A value is reused from the variable it was assigned to while
+// that variable is not assigned again. Values occurring more than once are otherwise computed into a new variable
+// before the statement, which is only done for operations which cannot fail, since the statement may fail earlier.
+// Calls of user functions which may change global variables start a new numbering.
+
+typedef struct {
+	char* data;
+	int length;
+	int capacity;
+} keyBuffer;
+
+typedef struct {
+	char* key;
+	int count;			 // occurrences found by the counting walk
+	int remaining;		 // occurrences not yet reached by the rewriting walk
+	const char* holder;	 // variable holding the value, non-owning, NULL if none
+	int holderVersion;
+} valueEntry;
+
+typedef struct {
+	const char* name;  // non-owning
+	int version;
+} variableVersion;
+
+typedef struct {
+	int index;	// of the statement the definition is placed before
+	astStatement definition;
+} insertion;
+
+typedef struct {
+	bool rewrite;  // false while counting the occurrences
+	int epoch;	   // part of every key, changed by calls which may assign global variables
+	int statementIndex;
+	valueEntry* values;
+	int valueCount;
+	int valueCapacity;
+	variableVersion* versions;
+	int versionCount;
+	int versionCapacity;
+	insertion* insertions;
+	int insertionCount;
+	int insertionCapacity;
+} numbering;
+
+static astFunctionDefinition** FUNCTIONS;  // indexed by function id
+static long REUSED_VALUES;
+static long TEMPORARIES;
+static int TEMPORARY_VARIABLES;	 // numbers the new variables
+
+static bool grow(void** data, int count, int* capacity, size_t size) {
+	if (count < *capacity) {
+		return true;
+	}
+	int newCapacity = *capacity ? *capacity * 2 : 8;
+	void* newData = realloc(*data, newCapacity * size);
+	if (!newData) {
+		return false;
+	}
+	*data = newData;
+	*capacity = newCapacity;
+	return true;
+}
+
+// KEYS
+
+static bool keyAppend(keyBuffer* key, const char* format, ...) {
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(NULL, 0, format, args);
+	va_end(args);
+	if (key->length + length + 1 > key->capacity) {
+		int capacity = (key->length + length + 1) * 2;
+		char* data = realloc(key->data, capacity);
+		if (!data) {
+			return false;
+		}
+		key->data = data;
+		key->capacity = capacity;
+	}
+	va_start(args, format);
+	vsnprintf(key->data + key->length, key->capacity - key->length, format, args);
+	va_end(args);
+	key->length += length;
+	return true;
+}
+
+// 0 for variables not assigned in the run
+static int versionOf(const numbering* n, const char* name) {
+	for (int i = 0; i < n->versionCount; i++) {
+		if (strcmp(n->versions[i].name, name) == 0) {
+			return n->versions[i].version;
+		}
+	}
+	return 0;
+}
+
+static bool assignVariable(numbering* n, const char* name) {
+	for (int i = 0; i < n->versionCount; i++) {
+		if (strcmp(n->versions[i].name, name) == 0) {
+			n->versions[i].version++;
+			return true;
+		}
+	}
+	OPTIMISE(grow((void**)&n->versions, n->versionCount, &n->versionCapacity, sizeof(variableVersion)));
+	n->versions[n->versionCount++] = (variableVersion){name, 1};
+	return true;
+}
+
+static bool appendTerm(const numbering* n, keyBuffer* key, const astTerm* term) {
+	switch (term->type) {
+		case AST_TERM_ID:
+			return keyAppend(key, "%s#%d", term->identifier.name, versionOf(n, term->identifier.name));
+		case AST_TERM_INT:
+			return keyAppend(key, "i%d", term->integer.value);
+		case AST_TERM_DECIMAL:
+			return keyAppend(key, "d%a", term->decimal.value);
+		case AST_TERM_STRING:
+			return keyAppend(key, "s%zu:%s", strlen(term->string.content), term->string.content);
+		case AST_TERM_NIL:
+			return keyAppend(key, "n");
+		case AST_TERM_BOOL:
+			return keyAppend(key, "b%d", term->boolean.value);
+	}
+	return true;
+}
+
+static bool appendExpression(const numbering* n, keyBuffer* key, const astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return appendTerm(n, key, &expr->term);
+		case AST_EXPR_BINARY: {
+			const astBinaryExpression* binary = &expr->binary;
+			return keyAppend(key, "(%d%d%d ", binary->op, binary->convertLhs, binary->convertRhs) &&
+				   appendExpression(n, key, binary->lhs) && keyAppend(key, " ") &&
+				   appendExpression(n, key, binary->rhs) && keyAppend(key, ")");
+		}
+		case AST_EXPR_UNWRAP:
+			return keyAppend(key, "!") && appendExpression(n, key, expr->unwrap.innerExpr);
+	}
+	return true;
+}
+
+// *index of the entry with the key, which is created if missing and takes the buffer
+static bool findValue(numbering* n, keyBuffer* key, int* index) {
+	for (int i = 0; i < n->valueCount; i++) {
+		if (strcmp(n->values[i].key, key->data) == 0) {
+			free(key->data);
+			*index = i;
+			return true;
+		}
+	}
+	if (!grow((void**)&n->values, n->valueCount, &n->valueCapacity, sizeof(valueEntry))) {
+		free(key->data);
+		return false;
+	}
+	n->values[n->valueCount] = (valueEntry){key->data, 0, 0, NULL, 0};
+	*index = n->valueCount++;
+	return true;
+}
+
+static bool findExpression(numbering* n, const astExpression* expr, int* index) {
+	keyBuffer key = {NULL, 0, 0};
+	if (!keyAppend(&key, "%d|", n->epoch) || !appendExpression(n, &key, expr)) {
+		free(key.data);
+		return false;
+	}
+	return findValue(n, &key, index);
+}
+
+static bool findCall(numbering* n, const astFunctionCall* call, int* index) {
+	keyBuffer key = {NULL, 0, 0};
+	bool result = keyAppend(&key, "%d|%d(", n->epoch, call->funcId);
+	for (int i = 0; result && i < call->params.count; i++) {
+		result = appendTerm(n, &key, &call->params.data[i].value) && keyAppend(&key, ",");
+	}
+	if (!result || !keyAppend(&key, ")")) {
+		free(key.data);
+		return false;
+	}
+	return findValue(n, &key, index);
+}
+
+static bool isHeld(const numbering* n, const valueEntry* entry) {
+	return entry->holder && versionOf(n, entry->holder) == entry->holderVersion;
+}
+
+// REWRITING
+
+static bool isPureCall(int funcId) {
+	if (funcId == SYM_FUNC_NONE) {
+		return false;
+	}
+	return isBuiltinFunction(funcId) ? BUILTINS[funcId].pure : FUNCTIONS[funcId]->pure;
+}
+
+// user function which may assign global variables
+static bool isImpureCall(int funcId) {
+	return funcId != SYM_FUNC_NONE && !isBuiltinFunction(funcId) && !FUNCTIONS[funcId]->pure;
+}
+
+// the type of the expression is kept
+static bool replaceByVariable(astExpression* expr, const char* name) {
+	astIdentifier identifier;
+	OPTIMISE(astIdentCreate(&identifier, name) == 0);
+	astExpressionDestroy(expr);
+	expr->type = AST_EXPR_TERM;
+	expr->term.type = AST_TERM_ID;
+	expr->term.identifier = identifier;
+	expr->isLiteral = false;
+	return true;
+}
+
+// the value is computed into a new variable before the current statement, *expr becomes the variable
+static bool defineTemporary(numbering* n, astExpression* expr, int index) {
+	astStatement statement = {.type = AST_STATEMENT_VAR_DEF};
+	astVariableDefinition* def = &statement.variableDef;
+	OPTIMISE(createTemporaryName(&def->variableName, "cse", ++TEMPORARY_VARIABLES));
+	def->variableType = expr->dataType;
+	def->hasExplicitType = true;
+	def->hasInitValue = true;
+	def->immutable = true;
+	def->convertValue = false;
+	def->nilInit = false;
+	def->value.type = AST_VAR_INIT_EXPR;
+	def->value.expr = *expr;
+	if (!grow((void**)&n->insertions, n->insertionCount, &n->insertionCapacity, sizeof(insertion))) {
+		free(def->variableName.name);
+		return false;
+	}
+	n->insertions[n->insertionCount++] = (insertion){n->statementIndex, statement};
+
+	expr->type = AST_EXPR_TERM;
+	expr->term.type = AST_TERM_ID;
+	expr->isLiteral = false;
+	OPTIMISE(astIdentCreate(&expr->term.identifier, def->variableName.name) == 0);
+	n->values[index].holder = def->variableName.name;
+	n->values[index].holderVersion = 0;
+	TEMPORARIES++;
+	return true;
+}
+
+static bool visitExpression(numbering* n, astExpression* expr);
+
+static bool visitOperands(numbering* n, astExpression* expr) {
+	return visitExpression(n, expr->binary.lhs) && visitExpression(n, expr->binary.rhs);
+}
+
+// The counting walk does not enter values found before, the rewriting walk replaces them. The key is made before the
+// operands are rewritten.
+static bool visitExpression(numbering* n, astExpression* expr) {
+	if (expr->type == AST_EXPR_UNWRAP) {
+		return visitExpression(n, expr->unwrap.innerExpr);
+	}
+	if (expr->type != AST_EXPR_BINARY || expr->isLiteral) {
+		return true;
+	}
+	int index;
+	OPTIMISE(findExpression(n, expr, &index));
+	if (!n->rewrite) {
+		return ++n->values[index].count > 1 || visitOperands(n, expr);
+	}
+	n->values[index].remaining--;
+	if (isHeld(n, &n->values[index])) {
+		REUSED_VALUES++;
+		return replaceByVariable(expr, n->values[index].holder);
+	}
+	OPTIMISE(visitOperands(n, expr));
+	if (n->values[index].remaining > 0 && !expressionCanFail(expr)) {
+		return defineTemporary(n, expr, index);
+	}
+	return true;
+}
+
+// comparisons are left in conditions, where they are compiled into the jumps
+static bool visitCondition(numbering* n, astExpression* condition) {
+	if (condition->type == AST_EXPR_BINARY && condition->binary.op >= AST_BINARY_EQ &&
+		condition->binary.op <= AST_BINARY_GREATER_EQ) {
+		return visitOperands(n, condition);
+	}
+	return visitExpression(n, condition);
+}
+
+// the variable assigned the value becomes its holder unless the value is converted
+static bool visitAssignedValue(numbering* n, astExpression* value, bool convert, const char* target) {
+	if (value->type != AST_EXPR_BINARY || value->isLiteral) {
+		OPTIMISE(visitExpression(n, value));
+		return assignVariable(n, target);
+	}
+	int index;
+	bool held = false;
+	OPTIMISE(findExpression(n, value, &index));
+	if (!n->rewrite) {
+		if (++n->values[index].count == 1) {
+			OPTIMISE(visitOperands(n, value));
+		}
+	} else {
+		n->values[index].remaining--;
+		held = isHeld(n, &n->values[index]);
+		if (held) {
+			REUSED_VALUES++;
+			OPTIMISE(replaceByVariable(value, n->values[index].holder));
+		} else {
+			OPTIMISE(visitOperands(n, value));
+		}
+	}
+	OPTIMISE(assignVariable(n, target));
+	if (n->rewrite && !held && !convert) {
+		n->values[index].holder = target;
+		n->values[index].holderVersion = versionOf(n, target);
+	}
+	return true;
+}
+
+// *holder is set to the variable holding the result of the same call made before
+static bool visitCall(numbering* n, const astFunctionCall* call, const char* target, const char** holder) {
+	*holder = NULL;
+	if (!isPureCall(call->funcId)) {
+		if (isImpureCall(call->funcId)) {
+			n->epoch++;
+		}
+		return assignVariable(n, target);
+	}
+	int index;
+	OPTIMISE(findCall(n, call, &index));
+	if (n->rewrite && isHeld(n, &n->values[index])) {
+		*holder = n->values[index].holder;
+		REUSED_VALUES++;
+	}
+	OPTIMISE(assignVariable(n, target));
+	if (n->rewrite && !*holder) {
+		n->values[index].holder = target;
+		n->values[index].holderVersion = versionOf(n, target);
+	}
+	return true;
+}
+
+// the value of the call being replaced, which is destroyed
+static bool callValue(astFunctionCall* call, const char* holder, astExpression* value) {
+	value->type = AST_EXPR_TERM;
+	value->term.type = AST_TERM_ID;
+	value->isLiteral = false;
+	value->dataType = isBuiltinFunction(call->funcId) ? BUILTINS[call->funcId].returnType
+													   : FUNCTIONS[call->funcId]->returnType;
+	OPTIMISE(astIdentCreate(&value->term.identifier, holder) == 0);
+	astFunctionCallDestroy(call);
+	return true;
+}
+
+// a conditional ends the run, only its condition is evaluated before the statements of the run following it
+static bool numberStatement(numbering* n, astStatement* statement) {
+	const char* holder;
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			astVariableDefinition* def = &statement->variableDef;
+			if (!def->hasInitValue) {
+				return assignVariable(n, def->variableName.name);
+			}
+			if (def->value.type == AST_VAR_INIT_EXPR) {
+				return visitAssignedValue(n, &def->value.expr, def->convertValue, def->variableName.name);
+			}
+			OPTIMISE(visitCall(n, &def->value.call, def->variableName.name, &holder));
+			if (holder) {
+				astExpression value;
+				OPTIMISE(callValue(&def->value.call, holder, &value));
+				def->value.type = AST_VAR_INIT_EXPR;
+				def->value.expr = value;
+			}
+			return true;
+		}
+		case AST_STATEMENT_ASSIGN: {
+			astAssignment* assignment = &statement->assignment;
+			return visitAssignedValue(n, &assignment->value, assignment->convertValue, assignment->variableName.name);
+		}
+		case AST_STATEMENT_FUNC_CALL: {
+			astFunctionCall* call = &statement->functionCall;
+			OPTIMISE(visitCall(n, call, call->varName.name, &holder));
+			if (holder) {
+				astIdentifier target = call->varName;
+				astExpression value;
+				call->varName.name = NULL;
+				OPTIMISE(callValue(call, holder, &value));
+				statement->type = AST_STATEMENT_ASSIGN;
+				statement->assignment.variableName = target;
+				statement->assignment.value = value;
+				statement->assignment.convertValue = false;
+			}
+			return true;
+		}
+		case AST_STATEMENT_PROC_CALL:
+			if (isImpureCall(statement->procedureCall.funcId)) {
+				n->epoch++;
+			}
+			return true;
+		case AST_STATEMENT_RETURN:
+			return !statement->returnStmt.hasValue || visitExpression(n, &statement->returnStmt.value);
+		case AST_STATEMENT_COND:
+			if (statement->conditional.condition.type == AST_CONDITION_EXPRESSION) {
+				return visitCondition(n, &statement->conditional.condition.expression);
+			}
+			return true;
+		case AST_STATEMENT_ITER:
+			return true;
+	}
+	return true;
+}
+
+static void clearValues(numbering* n) {
+	for (int i = 0; i < n->valueCount; i++) {
+		free(n->values[i].key);
+	}
+	n->valueCount = 0;
+}
+
+// counts the occurrences of the values of the run, then rewrites it
+static bool numberRun(numbering* n, astStatement** statements, int start, int end) {
+	for (int pass = 0; pass < 2; pass++) {
+		n->rewrite = pass == 1;
+		n->epoch = 0;
+		n->versionCount = 0;
+		for (int i = 0; i < n->valueCount; i++) {
+			n->values[i].remaining = n->values[i].count;
+		}
+		for (int i = start; i < end; i++) {
+			n->statementIndex = i;
+			OPTIMISE(numberStatement(n, statements[i]));
+		}
+	}
+	clearValues(n);
+	return true;
+}
+
+// splits the statements into runs ending before loops and after conditionals
+static bool numberStatements(numbering* n, astStatement** statements, int count) {
+	int start = 0;
+	while (start < count) {
+		int end = start;
+		while (end < count && statements[end]->type != AST_STATEMENT_ITER &&
+			   statements[end]->type != AST_STATEMENT_COND) {
+			end++;
+		}
+		if (end < count && statements[end]->type == AST_STATEMENT_COND) {
+			end++;
+		}
+		OPTIMISE(numberRun(n, statements, start, end));
+		start = end == start ? end + 1 : end;
+	}
+	return true;
+}
+
+static void numberingDestroy(numbering* n) {
+	clearValues(n);
+	free(n->values);
+	free(n->versions);
+	free(n->insertions);
+}
+
+static bool numberBlock(astStatementBlock* block);
+
+static bool numberNested(astStatement* statement) {
+	if (statement->type == AST_STATEMENT_COND) {
+		OPTIMISE(numberBlock(&statement->conditional.body));
+		return !statement->conditional.hasElse || numberBlock(&statement->conditional.bodyElse);
+	}
+	if (statement->type == AST_STATEMENT_ITER) {
+		return numberBlock(&statement->iteration.body);
+	}
+	return true;
+}
+
+static bool numberBlock(astStatementBlock* block) {
+	if (block->count == 0) {
+		return true;
+	}
+	astStatement** statements = malloc(block->count * sizeof(astStatement*));
+	if (!statements) {
+		return false;
+	}
+	bool result = true;
+	for (int i = 0; result && i < block->count; i++) {
+		statements[i] = &block->statements[i];
+		result = numberNested(statements[i]);
+	}
+	numbering n = {0};
+	result = result && numberStatements(&n, statements, block->count);
+	free(statements);
+
+	if (result && n.insertionCount > 0) {
+		astStatementBlock rebuilt;
+		astStatementBlockCreate(&rebuilt);
+		int next = 0;
+		for (int i = 0; result && i < block->count; i++) {
+			for (; result && next < n.insertionCount && n.insertions[next].index == i; next++) {
+				result = !astStatementBlockAdd(&rebuilt, n.insertions[next].definition);
+			}
+			result = result && !astStatementBlockAdd(&rebuilt, block->statements[i]);
+		}
+		if (result) {
+			free(block->statements);
+			*block = rebuilt;
+		}
+	}
+	numberingDestroy(&n);
+	return result;
+}
+
+// function definitions between the statements of global code do not end the runs
+static bool numberGlobalCode(astProgram* program) {
+	int count = 0;
+	for (int i = 0; i < program->count; i++) {
+		count += program->statements[i].type == AST_TOP_STATEMENT;
+	}
+	if (count == 0) {
+		return true;
+	}
+	astStatement** statements = malloc(count * sizeof(astStatement*));
+	if (!statements) {
+		return false;
+	}
+	bool result = true;
+	for (int i = 0, k = 0; result && i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_STATEMENT) {
+			statements[k] = &program->statements[i].statement;
+			result = numberNested(statements[k++]);
+		}
+	}
+	numbering n = {0};
+	result = result && numberStatements(&n, statements, count);
+	free(statements);
+
+	if (result && n.insertionCount > 0) {
+		astProgram rebuilt;
+		astProgramCreate(&rebuilt);
+		int next = 0;
+		for (int i = 0, k = 0; result && i < program->count; i++) {
+			if (program->statements[i].type == AST_TOP_STATEMENT) {
+				for (; result && next < n.insertionCount && n.insertions[next].index == k; next++) {
+					astTopLevelStatement definition = {.type = AST_TOP_STATEMENT,
+													   .statement = n.insertions[next].definition};
+					result = !astProgramAdd(&rebuilt, definition);
+				}
+				k++;
+			}
+			result = result && !astProgramAdd(&rebuilt, program->statements[i]);
+		}
+		if (result) {
+			free(program->statements);
+			*program = rebuilt;
+		}
+	}
+	numberingDestroy(&n);
+	return result;
+}
+
+bool eliminateCommonSubexpressions(astProgram* program, const symbolFuncTable* functionTable) {
+	FUNCTIONS = findFunctionDefinitions(program, functionTable);
+	if (!FUNCTIONS) {
+		return false;
+	}
+
+	bool result = true;
+	for (int i = 0; result && i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_FUNCTION) {
+			result = numberBlock(&program->statements[i].functionDef.body);
+		}
+	}
+	result = result && numberGlobalCode(program);
+	free(FUNCTIONS);
+	return result;
+}
+
+void csePrintStatistics(FILE* output) {
+	fprintf(output, "cse reused values: %ld\n", REUSED_VALUES);
+	fprintf(output, "cse temporaries: %ld\n", TEMPORARIES);
+}
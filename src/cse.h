@@ -0,0 +1,26 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef CSE_H
+#define CSE_H
+
+#include <stdio.h>
+
+#include "ast.h"
+#include "symtable.h"
+
+// Reuses values of expressions and pure calls computed earlier in the same straight-line sequence of statements.
+// Returns false when out of memory.
+bool eliminateCommonSubexpressions(astProgram*, const symbolFuncTable* functionTable);
+
+// prints how many values were reused and how many variables were introduced to hold them
+void csePrintStatistics(FILE* output);
+
+#endif
@@ -0,0 +1,213 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "emitter.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define EMITTER_INITIAL_CAPACITY (64 * 1024)
+#define EMITTER_NUMBER_LENGTH 64  // enough for any int or double
+
+static struct {
+	char* data;
+	size_t length;
+	size_t capacity;
+} OUTPUT;
+
+// returns pointer to the end of the buffer with room for at least count more characters
+static char* reserve(size_t count) {
+	if (OUTPUT.length + count > OUTPUT.capacity) {
+		size_t capacity = OUTPUT.capacity ? OUTPUT.capacity : EMITTER_INITIAL_CAPACITY;
+		while (OUTPUT.length + count > capacity) {
+			capacity *= 2;
+		}
+		char* data = realloc(OUTPUT.data, capacity);
+		if (!data) {
+			fputs("Out of memory.\n", stderr);
+			exit(99);
+		}
+		OUTPUT.data = data;
+		OUTPUT.capacity = capacity;
+	}
+	return OUTPUT.data + OUTPUT.length;
+}
+
+void emitText(const char* text) {
+	size_t length = strlen(text);
+	memcpy(reserve(length), text, length);
+	OUTPUT.length += length;
+}
+
+void emitLine(const char* text) {
+	emitText(text);
+	*reserve(1) = '\n';
+	OUTPUT.length++;
+}
+
+// Instructions are written straight to the buffer. Room for the longest possible text of the whole instruction is
+// reserved first, the write functions return the end of the written text.
+
+// writes length characters of text and moves out past them, a macro as it is called for nearly every operand
+#define WRITE_TEXT(out, text, length) (memcpy(out, text, length), out += (length))
+
+static char* writeInt(char* out, int value) {
+	char digits[EMITTER_NUMBER_LENGTH];
+	int count = 0;
+	// INT_MIN has no positive counterpart, so the magnitude is computed unsigned
+	unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+	do {
+		digits[count++] = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	if (value < 0) {
+		*out++ = '-';
+	}
+	while (count > 0) {
+		*out++ = digits[--count];
+	}
+	return out;
+}
+
+// string@ literal with escaped whitespace, control characters, # and backslash
+static char* writeStringLiteral(char* out, const char* content) {
+	WRITE_TEXT(out, "string@", 7);
+	for (; *content; content++) {
+		unsigned char c = *content;
+		// whitespace and everything that is not printable ASCII (same as isspace and isprint in the C locale)
+		if (c <= ' ' || c > '~' || c == '#' || c == '\\') {
+			// decimal escape \ddd
+			out[0] = '\\';
+			out[1] = '0' + c / 100;
+			out[2] = '0' + c / 10 % 10;
+			out[3] = '0' + c % 10;
+			out += 4;
+		} else {
+			*out++ = c;
+		}
+	}
+	return out;
+}
+
+static const char* const FRAME_NAMES[] = {
+	[IR_FRAME_GLOBAL] = "GF@",
+	[IR_FRAME_LOCAL] = "LF@",
+	[IR_FRAME_TEMPORARY] = "TF@",
+};
+
+// upper bound of the operand text length
+static size_t operandLength(const irOperand* operand) {
+	switch ((irOperandType)operand->type) {
+		case IR_OPERAND_VARIABLE:
+		case IR_OPERAND_LABEL:
+			return EMITTER_NUMBER_LENGTH + (operand->name ? strlen(operand->name) : 0);
+		case IR_OPERAND_STRING:
+			return EMITTER_NUMBER_LENGTH + 4 * strlen(operand->string);
+		case IR_OPERAND_TYPE:
+			return strlen(operand->typeName);
+		default:
+			return EMITTER_NUMBER_LENGTH;
+	}
+}
+
+static char* writeOperand(char* out, const irOperand* operand) {
+	switch ((irOperandType)operand->type) {
+		case IR_OPERAND_NONE:
+			break;
+		case IR_OPERAND_VARIABLE:
+			WRITE_TEXT(out, FRAME_NAMES[operand->frame], 3);
+			if (operand->prefix) {
+				*out++ = operand->prefix;
+				out = writeInt(out, operand->number);
+			}
+			if (operand->name) {
+				WRITE_TEXT(out, operand->name, strlen(operand->name));
+			}
+			break;
+		case IR_OPERAND_INT:
+			WRITE_TEXT(out, "int@", 4);
+			out = writeInt(out, operand->integer);
+			break;
+		case IR_OPERAND_FLOAT:
+			// hexadecimal notation used by float@ literals
+			WRITE_TEXT(out, "float@", 6);
+			out += snprintf(out, EMITTER_NUMBER_LENGTH, "%a", operand->decimal);
+			break;
+		case IR_OPERAND_STRING:
+			out = writeStringLiteral(out, operand->string);
+			break;
+		case IR_OPERAND_BOOL:
+			if (operand->boolean) {
+				WRITE_TEXT(out, "bool@true", 9);
+			} else {
+				WRITE_TEXT(out, "bool@false", 10);
+			}
+			break;
+		case IR_OPERAND_NIL:
+			WRITE_TEXT(out, "nil@nil", 7);
+			break;
+		case IR_OPERAND_LABEL:
+			*out++ = 'l';
+			if (operand->name) {
+				WRITE_TEXT(out, operand->name, strlen(operand->name));
+			} else {
+				out = writeInt(out, operand->number);
+			}
+			break;
+		case IR_OPERAND_TYPE:
+			WRITE_TEXT(out, operand->typeName, strlen(operand->typeName));
+			break;
+	}
+	return out;
+}
+
+void emitCode(const irCode* code) {
+	for (int i = 0; i < code->count; i++) {
+		const irInstruction* instruction = &code->data[i];
+		const irOpcodeDescriptor* descriptor = &IR_OPCODES[instruction->opcode];
+		size_t length = EMITTER_NUMBER_LENGTH;	// name, spaces and newline
+		for (int j = 0; j < descriptor->operandCount; j++) {
+			length += operandLength(&instruction->operands[j]);
+		}
+
+		char* start = reserve(length);
+		char* out = start;
+		WRITE_TEXT(out, descriptor->name, strlen(descriptor->name));
+		for (int j = 0; j < descriptor->operandCount; j++) {
+			*out++ = ' ';
+			out = writeOperand(out, &instruction->operands[j]);
+		}
+		*out++ = '\n';
+		OUTPUT.length += out - start;
+	}
+}
+
+bool emitterFlush(int fd) {
+	bool result = true;
+	size_t written = 0;
+	while (written < OUTPUT.length) {
+		ssize_t count = write(fd, OUTPUT.data + written, OUTPUT.length - written);
+		if (count < 0 && errno != EINTR) {
+			result = false;
+			break;
+		}
+		written += count > 0 ? count : 0;
+	}
+
+	free(OUTPUT.data);
+	OUTPUT.data = NULL;
+	OUTPUT.length = 0;
+	OUTPUT.capacity = 0;
+	return result;
+}
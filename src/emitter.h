@@ -0,0 +1,30 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef EMITTER_H
+#define EMITTER_H
+
+#include <stdbool.h>
+
+#include "ir.h"
+
+// Generated code is collected in one growable buffer and written out at once by emitterFlush.
+// Running out of memory is fatal, same as in the rest of the code generation.
+
+void emitText(const char* text);
+// text followed by a newline
+void emitLine(const char* text);
+// prints the instructions as IFJcode23 text, one per line
+void emitCode(const irCode* code);
+
+// Writes the collected code to the file descriptor and empties the buffer. Returns false on write error.
+bool emitterFlush(int fd);
+
+#endif
@@ -0,0 +1,635 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "evaluator.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "builtins.h"
+#include "symtable.h"
+
+// limits of one compile time evaluation, longer computations are left to the runtime
+#define EVALUATION_CALL_FUEL 100000	// evaluated statements and expressions
+#define EVALUATION_MAX_DEPTH 64		// nested calls
+#define EVALUATION_MAX_STRING 256	// longer strings would only bloat the generated code
+
+typedef enum {
+	EVALUATION_OK,
+	EVALUATION_RETURN,	 // return statement was executed, the value is in returnValue
+	EVALUATION_GIVE_UP,	 // the value cannot be computed at compile time
+	EVALUATION_NO_MEMORY,
+} evaluationStatus;
+
+#define EVALUATE(func)                          \
+	do {                                        \
+		evaluationStatus evaluateStatus = func; \
+		if (evaluateStatus != EVALUATION_OK) {  \
+			return evaluateStatus;              \
+		}                                       \
+	} while (0)
+
+typedef struct {
+	const char* name;
+	bool initialised;
+	astTerm value;	// owned
+} evaluationVariable;
+
+typedef struct {
+	astFunctionDefinition* const* definitions;
+	evaluationVariable* variables;	// variables of all active calls, the innermost scope is at the end
+	int count;
+	int capacity;
+	int frameStart;	 // first variable of the current call
+	int fuel;
+	int depth;
+	astTerm returnValue;
+} evaluation;
+
+bool copyTerm(astTerm* dst, const astTerm* src) {
+	*dst = *src;
+	if (src->type == AST_TERM_STRING) {
+		dst->string.content = malloc(strlen(src->string.content) + 1);
+		if (!dst->string.content) {
+			return false;
+		}
+		strcpy(dst->string.content, src->string.content);
+	} else if (src->type == AST_TERM_ID) {
+		return astIdentCreate(&dst->identifier, src->identifier.name) == 0;
+	}
+	return true;
+}
+
+void makeDecimal(astTerm* term) {
+	if (term->type == AST_TERM_INT) {
+		double value = term->integer.value;
+		term->type = AST_TERM_DECIMAL;
+		term->decimal.value = value;
+	}
+}
+
+// BINARY OPERATIONS
+
+// three-way comparison of literals of the same type
+static int compareTerms(const astTerm* lhs, const astTerm* rhs) {
+	switch (lhs->type) {
+		case AST_TERM_INT:
+			return (lhs->integer.value > rhs->integer.value) - (lhs->integer.value < rhs->integer.value);
+		case AST_TERM_DECIMAL:
+			return (lhs->decimal.value > rhs->decimal.value) - (lhs->decimal.value < rhs->decimal.value);
+		case AST_TERM_STRING:
+			return strcmp(lhs->string.content, rhs->string.content);
+		case AST_TERM_BOOL:
+			return lhs->boolean.value - rhs->boolean.value;
+		case AST_TERM_NIL:
+			return 0;
+		case AST_TERM_ID:
+			break;
+	}
+	assert(false);
+	return 0;
+}
+
+static bool foldIntArithmetic(astBinaryOperator op, long long lhs, long long rhs, astTerm* result) {
+	long long value;
+	switch (op) {
+		case AST_BINARY_PLUS:
+			value = lhs + rhs;
+			break;
+		case AST_BINARY_MINUS:
+			value = lhs - rhs;
+			break;
+		case AST_BINARY_MUL:
+			value = lhs * rhs;
+			break;
+		case AST_BINARY_DIV:
+			// division by zero is a runtime error, rounding of negative numbers is left to the interpreter
+			if (rhs == 0 || lhs < 0 || rhs < 0) {
+				return false;
+			}
+			value = lhs / rhs;
+			break;
+		default:
+			return false;
+	}
+	if (value < INT_MIN || value > INT_MAX) {
+		return false;  // does not fit into the literal
+	}
+	result->type = AST_TERM_INT;
+	result->integer.value = value;
+	return true;
+}
+
+static bool foldDecimalArithmetic(astBinaryOperator op, double lhs, double rhs, astTerm* result) {
+	double value;
+	switch (op) {
+		case AST_BINARY_PLUS:
+			value = lhs + rhs;
+			break;
+		case AST_BINARY_MINUS:
+			value = lhs - rhs;
+			break;
+		case AST_BINARY_MUL:
+			value = lhs * rhs;
+			break;
+		case AST_BINARY_DIV:
+			if (rhs == 0) {
+				return false;  // runtime error
+			}
+			value = lhs / rhs;
+			break;
+		default:
+			return false;
+	}
+	if (!isfinite(value)) {
+		return false;  // has no literal
+	}
+	result->type = AST_TERM_DECIMAL;
+	result->decimal.value = value;
+	return true;
+}
+
+static bool foldComparison(astBinaryOperator op, const astTerm* lhs, const astTerm* rhs, astTerm* result) {
+	bool value;
+	if (op == AST_BINARY_EQ || op == AST_BINARY_NEQ) {
+		if (lhs->type == AST_TERM_NIL || rhs->type == AST_TERM_NIL) {
+			value = lhs->type == rhs->type;
+		} else if (lhs->type == rhs->type) {
+			value = compareTerms(lhs, rhs) == 0;
+		} else {
+			return false;
+		}
+		value = (op == AST_BINARY_EQ) ? value : !value;
+	} else {
+		if (lhs->type != rhs->type || lhs->type == AST_TERM_NIL || lhs->type == AST_TERM_BOOL) {
+			return false;
+		}
+		int order = compareTerms(lhs, rhs);
+		switch (op) {
+			case AST_BINARY_LESS:
+				value = order < 0;
+				break;
+			case AST_BINARY_GREATER:
+				value = order > 0;
+				break;
+			case AST_BINARY_LESS_EQ:
+				value = order <= 0;
+				break;
+			case AST_BINARY_GREATER_EQ:
+				value = order >= 0;
+				break;
+			default:
+				return false;
+		}
+	}
+	result->type = AST_TERM_BOOL;
+	result->boolean.value = value;
+	return true;
+}
+
+bool evaluateBinary(const astBinaryExpression* binary, const astTerm* lhsTerm, const astTerm* rhsTerm,
+					astTerm* result, bool* computed) {
+	// operands are borrowed, only the result owns its memory
+	astTerm lhs = *lhsTerm;
+	astTerm rhs = *rhsTerm;
+	if (binary->convertLhs) {
+		makeDecimal(&lhs);
+	}
+	if (binary->convertRhs) {
+		makeDecimal(&rhs);
+	}
+
+	*computed = false;
+	switch (binary->op) {
+		case AST_BINARY_NIL_COAL:
+			*computed = true;
+			return copyTerm(result, lhs.type == AST_TERM_NIL ? &rhs : &lhs);
+		case AST_BINARY_PLUS:
+			if (lhs.type == AST_TERM_STRING && rhs.type == AST_TERM_STRING) {
+				size_t lhsLength = strlen(lhs.string.content);
+				result->type = AST_TERM_STRING;
+				result->string.content = malloc(lhsLength + strlen(rhs.string.content) + 1);
+				if (!result->string.content) {
+					return false;
+				}
+				strcpy(result->string.content, lhs.string.content);
+				strcpy(result->string.content + lhsLength, rhs.string.content);
+				*computed = true;
+				return true;
+			}
+			__attribute__((fallthrough));
+		case AST_BINARY_MINUS:
+		case AST_BINARY_MUL:
+		case AST_BINARY_DIV:
+			if (lhs.type == AST_TERM_INT && rhs.type == AST_TERM_INT) {
+				*computed = foldIntArithmetic(binary->op, lhs.integer.value, rhs.integer.value, result);
+			} else if (lhs.type == AST_TERM_DECIMAL && rhs.type == AST_TERM_DECIMAL) {
+				*computed = foldDecimalArithmetic(binary->op, lhs.decimal.value, rhs.decimal.value, result);
+			}
+			return true;
+		default:
+			*computed = foldComparison(binary->op, &lhs, &rhs, result);
+			return true;
+	}
+}
+
+// VARIABLES
+
+static evaluationVariable* findVariable(evaluation* ev, const char* name) {
+	for (int i = ev->count - 1; i >= ev->frameStart; i--) {
+		if (strcmp(ev->variables[i].name, name) == 0) {
+			return &ev->variables[i];
+		}
+	}
+	return NULL;  // global variable
+}
+
+// takes ownership of the value
+static evaluationStatus pushVariable(evaluation* ev, const char* name, astTerm value, bool initialised) {
+	if (ev->count == ev->capacity) {
+		int newCapacity = ev->capacity ? ev->capacity * 2 : 16;
+		evaluationVariable* variables = realloc(ev->variables, newCapacity * sizeof(evaluationVariable));
+		if (!variables) {
+			astTermDestroy(&value);
+			return EVALUATION_NO_MEMORY;
+		}
+		ev->variables = variables;
+		ev->capacity = newCapacity;
+	}
+	evaluationVariable variable = {name, initialised, value};
+	ev->variables[ev->count++] = variable;
+	return EVALUATION_OK;
+}
+
+static void popVariables(evaluation* ev, int count) {
+	while (ev->count > count) {
+		astTermDestroy(&ev->variables[--ev->count].value);
+	}
+}
+
+// takes ownership of the value
+static evaluationStatus storeVariable(evaluation* ev, const char* name, astTerm value) {
+	evaluationVariable* variable = findVariable(ev, name);
+	if (!variable) {
+		astTermDestroy(&value);
+		return EVALUATION_GIVE_UP;
+	}
+	astTermDestroy(&variable->value);
+	variable->value = value;
+	variable->initialised = true;
+	return EVALUATION_OK;
+}
+
+// EXPRESSIONS
+
+static evaluationStatus useFuel(evaluation* ev) { return --ev->fuel < 0 ? EVALUATION_GIVE_UP : EVALUATION_OK; }
+
+static evaluationStatus evaluateTerm(evaluation* ev, const astTerm* term, astTerm* result) {
+	if (term->type == AST_TERM_ID) {
+		const evaluationVariable* variable = findVariable(ev, term->identifier.name);
+		if (!variable || !variable->initialised) {
+			return EVALUATION_GIVE_UP;
+		}
+		term = &variable->value;
+	}
+	return copyTerm(result, term) ? EVALUATION_OK : EVALUATION_NO_MEMORY;
+}
+
+static evaluationStatus evaluateExpression(evaluation* ev, const astExpression* expr, astTerm* result) {
+	EVALUATE(useFuel(ev));
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return evaluateTerm(ev, &expr->term, result);
+		case AST_EXPR_UNWRAP:
+			EVALUATE(evaluateExpression(ev, expr->unwrap.innerExpr, result));
+			return result->type == AST_TERM_NIL ? EVALUATION_GIVE_UP : EVALUATION_OK;
+		case AST_EXPR_BINARY:
+			break;
+	}
+
+	astTerm lhs;
+	astTerm rhs;
+	EVALUATE(evaluateExpression(ev, expr->binary.lhs, &lhs));
+	evaluationStatus status = evaluateExpression(ev, expr->binary.rhs, &rhs);
+	if (status != EVALUATION_OK) {
+		astTermDestroy(&lhs);
+		return status;
+	}
+	bool computed;
+	bool enoughMemory = evaluateBinary(&expr->binary, &lhs, &rhs, result, &computed);
+	astTermDestroy(&lhs);
+	astTermDestroy(&rhs);
+	if (!enoughMemory) {
+		return EVALUATION_NO_MEMORY;
+	} else if (!computed) {
+		return EVALUATION_GIVE_UP;
+	} else if (result->type == AST_TERM_STRING && strlen(result->string.content) > EVALUATION_MAX_STRING) {
+		astTermDestroy(result);
+		return EVALUATION_GIVE_UP;
+	}
+	return EVALUATION_OK;
+}
+
+// evaluates condition of the conditional or iteration
+static evaluationStatus evaluateCondition(evaluation* ev, const astExpression* condition, bool* value) {
+	astTerm result;
+	EVALUATE(evaluateExpression(ev, condition, &result));
+	assert(result.type == AST_TERM_BOOL);
+	*value = result.boolean.value;
+	return EVALUATION_OK;
+}
+
+// CALLS
+
+// length and positions of characters are defined on code points by the interpreter, only ASCII is safe
+static bool isAscii(const char* str) {
+	for (; *str; str++) {
+		if ((unsigned char)*str >= 128) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static evaluationStatus makeString(const char* content, size_t length, astTerm* result) {
+	result->type = AST_TERM_STRING;
+	result->string.content = malloc(length + 1);
+	if (!result->string.content) {
+		return EVALUATION_NO_MEMORY;
+	}
+	memcpy(result->string.content, content, length);
+	result->string.content[length] = '\0';
+	return EVALUATION_OK;
+}
+
+// nil or an argument converted at runtime is left to the generated code
+static bool matchesParameters(builtinFunction builtin, const astTerm* args) {
+	const astParameterList* params = &BUILTINS[builtin].params;
+	for (int i = 0; i < params->count; i++) {
+		astTermType expected;
+		switch (params->data[i].dataType.type) {
+			case AST_TYPE_INT:
+				expected = AST_TERM_INT;
+				break;
+			case AST_TYPE_DOUBLE:
+				expected = AST_TERM_DECIMAL;
+				break;
+			case AST_TYPE_STRING:
+				expected = AST_TERM_STRING;
+				break;
+			default:
+				return false;
+		}
+		if (args[i].type != expected) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// same semantics as the code generated by compiler
+static evaluationStatus evaluateBuiltin(builtinFunction builtin, const astTerm* args, astTerm* result) {
+	if (!matchesParameters(builtin, args)) {
+		return EVALUATION_GIVE_UP;
+	}
+	switch (builtin) {
+		case BUILTIN_INT2DOUBLE:
+			*result = args[0];
+			makeDecimal(result);
+			return EVALUATION_OK;
+		case BUILTIN_DOUBLE2INT: {
+			double value = args[0].decimal.value;
+			if (!(value > INT_MIN - 1.0 && value < INT_MAX + 1.0)) {
+				return EVALUATION_GIVE_UP;
+			}
+			result->type = AST_TERM_INT;
+			result->integer.value = (int)value;
+			return EVALUATION_OK;
+		}
+		case BUILTIN_LENGTH:
+			if (!isAscii(args[0].string.content)) {
+				return EVALUATION_GIVE_UP;
+			}
+			result->type = AST_TERM_INT;
+			result->integer.value = strlen(args[0].string.content);
+			return EVALUATION_OK;
+		case BUILTIN_SUBSTRING: {
+			const char* str = args[0].string.content;
+			int start = args[1].integer.value;
+			int end = args[2].integer.value;
+			if (!isAscii(str)) {
+				return EVALUATION_GIVE_UP;
+			}
+			int length = strlen(str);
+			if (start < 0 || end < 0 || start > end || start >= length || end > length) {
+				result->type = AST_TERM_NIL;
+				return EVALUATION_OK;
+			}
+			return makeString(str + start, end - start, result);
+		}
+		case BUILTIN_ORD: {
+			const char* str = args[0].string.content;
+			if (!isAscii(str)) {
+				return EVALUATION_GIVE_UP;
+			}
+			result->type = AST_TERM_INT;
+			result->integer.value = (unsigned char)str[0];
+			return EVALUATION_OK;
+		}
+		case BUILTIN_CHR: {
+			int code = args[0].integer.value;
+			if (code < 1 || code >= 128) {
+				return EVALUATION_GIVE_UP;	// NUL cannot be a part of string literal
+			}
+			char character = code;
+			return makeString(&character, 1, result);
+		}
+		default:
+			return EVALUATION_GIVE_UP;	// input
+	}
+}
+
+static evaluationStatus evaluateStatementBlock(evaluation*, const astStatementBlock*);
+
+// arguments are evaluated in the frame of the caller
+static evaluationStatus evaluateArguments(evaluation* ev, const astInputParameterList* list, astTerm* args) {
+	for (int i = 0; i < list->count; i++) {
+		evaluationStatus status = evaluateTerm(ev, &list->data[i].value, &args[i]);
+		if (status != EVALUATION_OK) {
+			for (int j = 0; j < i; j++) {
+				astTermDestroy(&args[j]);
+			}
+			return status;
+		}
+	}
+	return EVALUATION_OK;
+}
+
+static evaluationStatus evaluateFunction(evaluation* ev, int funcId, const astInputParameterList* list,
+										 astTerm* result) {
+	if (funcId == SYM_FUNC_NONE) {
+		return EVALUATION_GIVE_UP;
+	}
+	const astFunctionDefinition* def = isBuiltinFunction(funcId) ? NULL : ev->definitions[funcId];
+	if ((def && !def->pure) || ev->depth >= EVALUATION_MAX_DEPTH) {
+		return EVALUATION_GIVE_UP;
+	}
+	astTerm* args = malloc((list->count ? list->count : 1) * sizeof(astTerm));
+	if (!args) {
+		return EVALUATION_NO_MEMORY;
+	}
+	evaluationStatus status = evaluateArguments(ev, list, args);
+	if (status != EVALUATION_OK) {
+		free(args);
+		return status;
+	}
+
+	if (!def) {
+		status = evaluateBuiltin(funcId, args, result);
+		for (int i = 0; i < list->count; i++) {
+			astTermDestroy(&args[i]);
+		}
+		free(args);
+		return status;
+	}
+
+	// new frame with the parameters
+	int frameStart = ev->frameStart;
+	ev->frameStart = ev->count;
+	for (int i = 0; i < list->count; i++) {
+		if (status == EVALUATION_OK) {
+			status = pushVariable(ev, def->params.data[i].insideName.name, args[i], true);
+		} else {
+			astTermDestroy(&args[i]);
+		}
+	}
+	free(args);
+
+	if (status == EVALUATION_OK) {
+		ev->depth++;
+		status = evaluateStatementBlock(ev, &def->body);
+		ev->depth--;
+	}
+	popVariables(ev, ev->frameStart);
+	ev->frameStart = frameStart;
+
+	if (status == EVALUATION_RETURN) {
+		*result = ev->returnValue;
+		return EVALUATION_OK;
+	} else if (status == EVALUATION_OK) {
+		result->type = AST_TERM_NIL;  // procedure without return
+	}
+	return status;
+}
+
+// STATEMENTS
+
+static evaluationStatus evaluateVariableDef(evaluation* ev, const astVariableDefinition* def) {
+	astTerm value;
+	value.type = AST_TERM_NIL;
+	if (def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+		EVALUATE(evaluateExpression(ev, &def->value.expr, &value));
+		if (def->convertValue) {
+			makeDecimal(&value);
+		}
+	} else if (def->hasInitValue) {
+		EVALUATE(evaluateFunction(ev, def->value.call.funcId, &def->value.call.params, &value));
+	}
+	return pushVariable(ev, def->variableName.name, value, def->hasInitValue || def->variableType.nullable);
+}
+
+static evaluationStatus evaluateConditional(evaluation* ev, const astConditional* conditional) {
+	bool value;
+	if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+		EVALUATE(evaluateCondition(ev, &conditional->condition.expression, &value));
+	} else {
+		// the unwrapped variable has the same value as the original one
+		const evaluationVariable* variable = findVariable(ev, conditional->condition.optBinding.identifier.name);
+		if (!variable || !variable->initialised) {
+			return EVALUATION_GIVE_UP;
+		}
+		value = variable->value.type != AST_TERM_NIL;
+	}
+
+	if (value) {
+		return evaluateStatementBlock(ev, &conditional->body);
+	} else if (conditional->hasElse) {
+		return evaluateStatementBlock(ev, &conditional->bodyElse);
+	}
+	return EVALUATION_OK;
+}
+
+static evaluationStatus evaluateStatement(evaluation* ev, const astStatement* statement) {
+	EVALUATE(useFuel(ev));
+	astTerm value;
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			return evaluateVariableDef(ev, &statement->variableDef);
+		case AST_STATEMENT_ASSIGN:
+			EVALUATE(evaluateExpression(ev, &statement->assignment.value, &value));
+			if (statement->assignment.convertValue) {
+				makeDecimal(&value);
+			}
+			return storeVariable(ev, statement->assignment.variableName.name, value);
+		case AST_STATEMENT_COND:
+			return evaluateConditional(ev, &statement->conditional);
+		case AST_STATEMENT_ITER:
+			while (true) {
+				bool condition;
+				EVALUATE(evaluateCondition(ev, &statement->iteration.condition, &condition));
+				if (!condition) {
+					return EVALUATION_OK;
+				}
+				EVALUATE(evaluateStatementBlock(ev, &statement->iteration.body));
+			}
+		case AST_STATEMENT_FUNC_CALL: {
+			const astFunctionCall* call = &statement->functionCall;
+			EVALUATE(evaluateFunction(ev, call->funcId, &call->params, &value));
+			return storeVariable(ev, call->varName.name, value);
+		}
+		case AST_STATEMENT_PROC_CALL:
+			EVALUATE(evaluateFunction(ev, statement->procedureCall.funcId, &statement->procedureCall.params, &value));
+			astTermDestroy(&value);
+			return EVALUATION_OK;
+		case AST_STATEMENT_RETURN:
+			value.type = AST_TERM_NIL;
+			if (statement->returnStmt.hasValue) {
+				EVALUATE(evaluateExpression(ev, &statement->returnStmt.value, &value));
+			}
+			ev->returnValue = value;
+			return EVALUATION_RETURN;
+	}
+	return EVALUATION_GIVE_UP;
+}
+
+static evaluationStatus evaluateStatementBlock(evaluation* ev, const astStatementBlock* block) {
+	int count = ev->count;
+	evaluationStatus status = EVALUATION_OK;
+	for (int i = 0; i < block->count && status == EVALUATION_OK; i++) {
+		status = evaluateStatement(ev, &block->statements[i]);
+	}
+	popVariables(ev, count);
+	return status;
+}
+
+bool evaluateCall(astFunctionDefinition* const* definitions, int funcId, const astInputParameterList* args,
+				  int* fuel, astTerm* result, bool* computed) {
+	int callFuel = *fuel < EVALUATION_CALL_FUEL ? *fuel : EVALUATION_CALL_FUEL;
+	evaluation ev = {definitions, NULL, 0, 0, 0, callFuel, 0, {AST_TERM_NIL, {{NULL}}}};
+	evaluationStatus status = evaluateFunction(&ev, funcId, args, result);
+	*fuel -= ev.fuel < 0 ? callFuel : callFuel - ev.fuel;
+	popVariables(&ev, 0);
+	free(ev.variables);
+	*computed = status == EVALUATION_OK;
+	return status != EVALUATION_NO_MEMORY;
+}
@@ -0,0 +1,33 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef EVALUATOR_H
+#define EVALUATOR_H
+
+#include "ast.h"
+
+// Compile time evaluation of operations on literals and of calls of pure functions.
+// Functions returning bool return false when out of memory, *computed tells whether the value is known.
+
+bool copyTerm(astTerm* dst, const astTerm* src);
+// int literal to decimal literal, other terms are left unchanged
+void makeDecimal(astTerm* term);
+
+// Computes the binary operation on literal operands, fails (not computed) on runtime errors.
+bool evaluateBinary(const astBinaryExpression*, const astTerm* lhs, const astTerm* rhs, astTerm* result,
+					bool* computed);
+
+// Evaluates a call with literal arguments, definitions of user functions are indexed by function id.
+// Gives up (not computed) on impure functions or when the evaluation is too long.
+// The spent part of the shared fuel is subtracted, so that the whole program is bounded too.
+bool evaluateCall(astFunctionDefinition* const* definitions, int funcId, const astInputParameterList* args,
+				  int* fuel, astTerm* result, bool* computed);
+
+#endif
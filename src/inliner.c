@@ -0,0 +1,883 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "inliner.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "builtins.h"
+#include "evaluator.h"
+#include "optimiser.h"
+
+// A call
+//     let x = f(a, b)
+// becomes
+//     var x: T
+//     if true {
+//         let p$1 = a
+//         let q$1 = b
+//         ... body of f with x = e in place of return e ...
+//     }
+// Variables of the copy get the number of the inlined call after $, which cannot appear in identifiers of the language,
+// so they never collide with variables of the caller. Only functions using no global variables are inlined, so every
+// identifier of the body is renamed without looking at scopes. Returns have to be the last statements of their paths,
+// the body is rearranged to achieve that where possible. Functions are processed callees first, so an inlined body
+// already contains the inlined calls of its own callees.
+
+// cost model, sizes are numbers of statements and expression nodes of the body
+#define INLINE_MAX_SIZE 10		 // inlined everywhere
+#define INLINE_MAX_LOOP_SIZE 30	 // inlined into loops, where the overhead of the call is paid in every iteration
+#define INLINE_MAX_ONCE_SIZE 60	 // inlined into the only call site, bounds the bodies grown by chains of such calls
+
+typedef enum { FUNCTION_UNVISITED, FUNCTION_VISITING, FUNCTION_DONE } functionState;
+
+typedef struct {
+	astFunctionDefinition* definition;	// NULL for builtins
+	functionState state;
+	bool recursive;	 // calls itself, possibly through other functions
+	bool inlinable;	 // uses no global variables and returns only at the ends of paths
+	int size;
+	int calls;	// call sites in the program before inlining
+} inlinerFunction;
+
+typedef struct {
+	int suffix;			 // of the renamed variables
+	const char* result;	 // variable receiving the returned value, NULL for functions without one
+} inlinedCall;
+
+static inlinerFunction* FUNCTIONS;	// indexed by function id
+static int* VISITING;				// functions being processed, callers first
+static int VISITING_COUNT;
+static symbolTableStack VAR_SYM_STACK;	// scopes of the function checked for global variables
+static long INLINED_CALLS;				// also numbers the copies
+
+// id of the user function called by the statement, SYM_FUNC_NONE for other statements
+static int calledFunction(const astStatement* statement) {
+	int funcId = SYM_FUNC_NONE;
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			if (statement->variableDef.hasInitValue && statement->variableDef.value.type == AST_VAR_INIT_FUNC) {
+				funcId = statement->variableDef.value.call.funcId;
+			}
+			break;
+		case AST_STATEMENT_FUNC_CALL:
+			funcId = statement->functionCall.funcId;
+			break;
+		case AST_STATEMENT_PROC_CALL:
+			funcId = statement->procedureCall.funcId;
+			break;
+		default:
+			break;
+	}
+	return isBuiltinFunction(funcId) ? SYM_FUNC_NONE : funcId;
+}
+
+static void countCalls(const astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		const astStatement* statement = &block->statements[i];
+		int funcId = calledFunction(statement);
+		if (funcId != SYM_FUNC_NONE) {
+			FUNCTIONS[funcId].calls++;
+		} else if (statement->type == AST_STATEMENT_COND) {
+			countCalls(&statement->conditional.body);
+			if (statement->conditional.hasElse) {
+				countCalls(&statement->conditional.bodyElse);
+			}
+		} else if (statement->type == AST_STATEMENT_ITER) {
+			countCalls(&statement->iteration.body);
+		}
+	}
+}
+
+// SIZES
+
+static int expressionSize(const astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return 1;
+		case AST_EXPR_BINARY:
+			return 1 + expressionSize(expr->binary.lhs) + expressionSize(expr->binary.rhs);
+		case AST_EXPR_UNWRAP:
+			return 1 + expressionSize(expr->unwrap.innerExpr);
+	}
+	return 1;
+}
+
+static int blockSize(const astStatementBlock* block);
+
+static int statementSize(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			const astVariableDefinition* def = &statement->variableDef;
+			if (!def->hasInitValue) {
+				return 1;
+			}
+			return 1 + (def->value.type == AST_VAR_INIT_EXPR ? expressionSize(&def->value.expr)
+															 : def->value.call.params.count);
+		}
+		case AST_STATEMENT_ASSIGN:
+			return 1 + expressionSize(&statement->assignment.value);
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			int size = 1 + blockSize(&conditional->body);
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+				size += expressionSize(&conditional->condition.expression);
+			}
+			return size + (conditional->hasElse ? blockSize(&conditional->bodyElse) : 0);
+		}
+		case AST_STATEMENT_ITER:
+			return 1 + expressionSize(&statement->iteration.condition) + blockSize(&statement->iteration.body);
+		case AST_STATEMENT_FUNC_CALL:
+			return 1 + statement->functionCall.params.count;
+		case AST_STATEMENT_PROC_CALL:
+			return 1 + statement->procedureCall.params.count;
+		case AST_STATEMENT_RETURN:
+			return 1 + (statement->returnStmt.hasValue ? expressionSize(&statement->returnStmt.value) : 0);
+	}
+	return 1;
+}
+
+static int blockSize(const astStatementBlock* block) {
+	int size = 0;
+	for (int i = 0; i < block->count; i++) {
+		size += statementSize(&block->statements[i]);
+	}
+	return size;
+}
+
+// RETURNS
+
+static bool containsReturn(const astStatementBlock* block);
+
+static bool statementContainsReturn(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_RETURN:
+			return true;
+		case AST_STATEMENT_COND:
+			return containsReturn(&statement->conditional.body) ||
+				   (statement->conditional.hasElse && containsReturn(&statement->conditional.bodyElse));
+		case AST_STATEMENT_ITER:
+			return containsReturn(&statement->iteration.body);
+		default:
+			return false;
+	}
+}
+
+static bool containsReturn(const astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		if (statementContainsReturn(&block->statements[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// branch decided by optimiser, the body is always taken
+static bool isDecided(const astConditional* conditional) {
+	const astExpression* condition = &conditional->condition.expression;
+	return conditional->condition.type == AST_CONDITION_EXPRESSION && condition->type == AST_EXPR_TERM &&
+		   condition->term.type == AST_TERM_BOOL && condition->term.boolean.value;
+}
+
+// every path through the block ends with a return
+static bool blockReturns(const astStatementBlock* block) {
+	if (block->count == 0) {
+		return false;
+	}
+	const astStatement* last = &block->statements[block->count - 1];
+	if (last->type == AST_STATEMENT_RETURN) {
+		return true;
+	}
+	if (last->type != AST_STATEMENT_COND) {
+		return false;
+	}
+	const astConditional* conditional = &last->conditional;
+	return blockReturns(&conditional->body) &&
+		   (isDecided(conditional) || (conditional->hasElse && blockReturns(&conditional->bodyElse)));
+}
+
+static void truncateBlock(astStatementBlock* block, int count) {
+	for (int i = count; i < block->count; i++) {
+		astStatementDestroy(&block->statements[i]);
+	}
+	block->count = count;
+}
+
+static bool expressionUsesName(const astExpression* expr, const char* name) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return expr->term.type == AST_TERM_ID && strcmp(expr->term.identifier.name, name) == 0;
+		case AST_EXPR_BINARY:
+			return expressionUsesName(expr->binary.lhs, name) || expressionUsesName(expr->binary.rhs, name);
+		case AST_EXPR_UNWRAP:
+			return expressionUsesName(expr->unwrap.innerExpr, name);
+	}
+	return false;
+}
+
+static bool isName(const astIdentifier* identifier, const char* name) {
+	return identifier->name && strcmp(identifier->name, name) == 0;
+}
+
+static bool parametersUseName(const astInputParameterList* list, const char* name) {
+	for (int i = 0; i < list->count; i++) {
+		if (list->data[i].value.type == AST_TERM_ID && isName(&list->data[i].value.identifier, name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool blockUsesName(const astStatementBlock* block, int from, const char* name);
+
+// the statement defines, assigns or reads the variable
+static bool usesName(const astStatement* statement, const char* name) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			const astVariableDefinition* def = &statement->variableDef;
+			if (isName(&def->variableName, name)) {
+				return true;
+			}
+			if (!def->hasInitValue) {
+				return false;
+			}
+			return def->value.type == AST_VAR_INIT_EXPR ? expressionUsesName(&def->value.expr, name)
+														: parametersUseName(&def->value.call.params, name);
+		}
+		case AST_STATEMENT_ASSIGN:
+			return isName(&statement->assignment.variableName, name) ||
+				   expressionUsesName(&statement->assignment.value, name);
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			bool condition = conditional->condition.type == AST_CONDITION_EXPRESSION
+								 ? expressionUsesName(&conditional->condition.expression, name)
+								 : isName(&conditional->condition.optBinding.identifier, name);
+			return condition || blockUsesName(&conditional->body, 0, name) ||
+				   (conditional->hasElse && blockUsesName(&conditional->bodyElse, 0, name));
+		}
+		case AST_STATEMENT_ITER:
+			return expressionUsesName(&statement->iteration.condition, name) ||
+				   blockUsesName(&statement->iteration.body, 0, name);
+		case AST_STATEMENT_FUNC_CALL:
+			return isName(&statement->functionCall.varName, name) ||
+				   parametersUseName(&statement->functionCall.params, name);
+		case AST_STATEMENT_PROC_CALL:
+			return parametersUseName(&statement->procedureCall.params, name);
+		case AST_STATEMENT_RETURN:
+			return statement->returnStmt.hasValue && expressionUsesName(&statement->returnStmt.value, name);
+	}
+	return false;
+}
+
+static bool blockUsesName(const astStatementBlock* block, int from, const char* name) {
+	for (int i = from; i < block->count; i++) {
+		if (usesName(&block->statements[i], name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// a variable defined in the branch would capture a name of the statements moved after it
+static bool capturesName(const astStatementBlock* branch, const astStatementBlock* block, int from) {
+	for (int i = 0; i < branch->count; i++) {
+		const astStatement* statement = &branch->statements[i];
+		if (statement->type == AST_STATEMENT_VAR_DEF &&
+			blockUsesName(block, from, statement->variableDef.variableName.name)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Removes statements after returns and moves the statements after a conditional with a returning branch to its other
+// branch, so that returns end up at the ends of paths. Returns which cannot be moved there are left alone.
+static bool normaliseReturns(astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		astStatement* statement = &block->statements[i];
+		if (statement->type == AST_STATEMENT_RETURN) {
+			truncateBlock(block, i + 1);
+			return true;
+		}
+		if (statement->type != AST_STATEMENT_COND) {
+			continue;
+		}
+
+		astConditional* conditional = &statement->conditional;
+		OPTIMISE(normaliseReturns(&conditional->body));
+		if (conditional->hasElse) {
+			OPTIMISE(normaliseReturns(&conditional->bodyElse));
+		}
+		if (i == block->count - 1) {
+			return true;
+		}
+
+		bool bodyReturns = blockReturns(&conditional->body);
+		bool elseReturns = isDecided(conditional) || (conditional->hasElse && blockReturns(&conditional->bodyElse));
+		astStatementBlock* rest;
+		if (bodyReturns && elseReturns) {
+			truncateBlock(block, i + 1);
+			return true;
+		} else if (bodyReturns) {
+			if (!conditional->hasElse) {
+				astStatementBlockCreate(&conditional->bodyElse);
+				conditional->hasElse = true;
+			}
+			rest = &conditional->bodyElse;
+		} else if (elseReturns) {
+			rest = &conditional->body;
+		} else {
+			continue;
+		}
+		if (capturesName(rest, block, i + 1)) {
+			continue;
+		}
+		for (int j = i + 1; j < block->count; j++) {
+			OPTIMISE(!astStatementBlockAdd(rest, block->statements[j]));
+		}
+		block->count = i + 1;
+		return normaliseReturns(rest);
+	}
+	return true;
+}
+
+static bool returnsOnlyAtEnds(const astStatementBlock* block) {
+	if (block->count == 0) {
+		return true;
+	}
+	for (int i = 0; i < block->count - 1; i++) {
+		if (statementContainsReturn(&block->statements[i])) {
+			return false;
+		}
+	}
+	const astStatement* last = &block->statements[block->count - 1];
+	if (last->type == AST_STATEMENT_COND) {
+		return returnsOnlyAtEnds(&last->conditional.body) &&
+			   (!last->conditional.hasElse || returnsOnlyAtEnds(&last->conditional.bodyElse));
+	}
+	return last->type == AST_STATEMENT_RETURN || !statementContainsReturn(last);
+}
+
+// GLOBAL VARIABLES
+// *local is cleared when a variable defined outside of the function is used, false is returned when out of memory
+
+static bool isLocal(const char* name) { return symStackLookup(&VAR_SYM_STACK, name, NULL) != NULL; }
+
+static bool isLocalExpression(const astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return expr->term.type != AST_TERM_ID || isLocal(expr->term.identifier.name);
+		case AST_EXPR_BINARY:
+			return isLocalExpression(expr->binary.lhs) && isLocalExpression(expr->binary.rhs);
+		case AST_EXPR_UNWRAP:
+			return isLocalExpression(expr->unwrap.innerExpr);
+	}
+	return false;
+}
+
+static bool areLocalParameters(const astInputParameterList* list) {
+	for (int i = 0; i < list->count; i++) {
+		const astTerm* term = &list->data[i].value;
+		if (term->type == AST_TERM_ID && !isLocal(term->identifier.name)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool checkLocalBlock(const astStatementBlock* block, bool* local);
+
+static bool checkLocalStatement(const astStatement* statement, bool* local) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			const astVariableDefinition* def = &statement->variableDef;
+			if (def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+				*local = *local && isLocalExpression(&def->value.expr);
+			} else if (def->hasInitValue) {
+				*local = *local && areLocalParameters(&def->value.call.params);
+			}
+			symbolVariable variable = {def->variableType, def->immutable, NULL, NULL};
+			return symStackInsertVar(&VAR_SYM_STACK, variable, def->variableName.name);
+		}
+		case AST_STATEMENT_ASSIGN:
+			*local = *local && isLocal(statement->assignment.variableName.name) &&
+					 isLocalExpression(&statement->assignment.value);
+			return true;
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+				*local = *local && isLocalExpression(&conditional->condition.expression);
+			} else {
+				*local = *local && isLocal(conditional->condition.optBinding.identifier.name);
+			}
+			return checkLocalBlock(&conditional->body, local) &&
+				   (!conditional->hasElse || checkLocalBlock(&conditional->bodyElse, local));
+		}
+		case AST_STATEMENT_ITER:
+			*local = *local && isLocalExpression(&statement->iteration.condition);
+			return checkLocalBlock(&statement->iteration.body, local);
+		case AST_STATEMENT_FUNC_CALL:
+			*local = *local && isLocal(statement->functionCall.varName.name) &&
+					 areLocalParameters(&statement->functionCall.params);
+			return true;
+		case AST_STATEMENT_PROC_CALL:
+			*local = *local && areLocalParameters(&statement->procedureCall.params);
+			return true;
+		case AST_STATEMENT_RETURN:
+			*local = *local && (!statement->returnStmt.hasValue || isLocalExpression(&statement->returnStmt.value));
+			return true;
+	}
+	return true;
+}
+
+static bool checkLocalBlock(const astStatementBlock* block, bool* local) {
+	OPTIMISE(symStackPush(&VAR_SYM_STACK));
+	for (int i = 0; i < block->count && *local; i++) {
+		OPTIMISE(checkLocalStatement(&block->statements[i], local));
+	}
+	symStackPop(&VAR_SYM_STACK);
+	return true;
+}
+
+static bool usesOnlyLocals(const astFunctionDefinition* def, bool* local) {
+	*local = true;
+	OPTIMISE(symStackPush(&VAR_SYM_STACK));
+	for (int i = 0; i < def->params.count; i++) {
+		const astParameter* param = &def->params.data[i];
+		if (param->used) {
+			symbolVariable variable = {param->dataType, true, NULL, NULL};
+			OPTIMISE(symStackInsertVar(&VAR_SYM_STACK, variable, param->insideName.name));
+		}
+	}
+	OPTIMISE(checkLocalBlock(&def->body, local));
+	symStackPop(&VAR_SYM_STACK);
+	return true;
+}
+
+// COPIES
+
+// variable of the copy numbered by suffix, or the result variable $<suffix> for an empty name
+static char* renamedVariable(const char* name, int suffix) {
+	size_t length = strlen(name) + 16;
+	char* renamed = malloc(length);
+	if (renamed) {
+		snprintf(renamed, length, "%s$%d", name, suffix);
+	}
+	return renamed;
+}
+
+static bool renameIdentifier(astIdentifier* dst, const astIdentifier* src, int suffix) {
+	if (!src->name) {
+		dst->name = NULL;
+		return true;
+	}
+	dst->name = renamedVariable(src->name, suffix);
+	return dst->name != NULL;
+}
+
+static bool cloneTerm(astTerm* dst, const astTerm* src, int suffix) {
+	if (src->type != AST_TERM_ID) {
+		return copyTerm(dst, src);
+	}
+	dst->type = AST_TERM_ID;
+	return renameIdentifier(&dst->identifier, &src->identifier, suffix);
+}
+
+static bool cloneExpression(astExpression* dst, const astExpression* src, int suffix) {
+	*dst = *src;
+	switch (src->type) {
+		case AST_EXPR_TERM:
+			return cloneTerm(&dst->term, &src->term, suffix);
+		case AST_EXPR_BINARY:
+			dst->binary.lhs = malloc(sizeof(astExpression));
+			dst->binary.rhs = malloc(sizeof(astExpression));
+			return dst->binary.lhs && dst->binary.rhs && cloneExpression(dst->binary.lhs, src->binary.lhs, suffix) &&
+				   cloneExpression(dst->binary.rhs, src->binary.rhs, suffix);
+		case AST_EXPR_UNWRAP:
+			dst->unwrap.innerExpr = malloc(sizeof(astExpression));
+			return dst->unwrap.innerExpr && cloneExpression(dst->unwrap.innerExpr, src->unwrap.innerExpr, suffix);
+	}
+	return true;
+}
+
+static bool cloneParameters(astInputParameterList* dst, const astInputParameterList* src, int suffix) {
+	astInputParameterListCreate(dst);
+	for (int i = 0; i < src->count; i++) {
+		astInputParameter param = src->data[i];
+		if (param.hasName) {
+			OPTIMISE(astIdentCreate(&param.name, src->data[i].name.name) == 0);
+		}
+		OPTIMISE(cloneTerm(&param.value, &src->data[i].value, suffix));
+		OPTIMISE(!astInputParameterListAdd(dst, param));
+	}
+	return true;
+}
+
+static bool cloneCall(astFunctionCall* dst, const astFunctionCall* src, int suffix) {
+	*dst = *src;
+	return renameIdentifier(&dst->varName, &src->varName, suffix) &&
+		   astIdentCreate(&dst->funcName, src->funcName.name) == 0 &&
+		   cloneParameters(&dst->params, &src->params, suffix);
+}
+
+static bool cloneBlock(astStatementBlock* dst, const astStatementBlock* src, const inlinedCall* call);
+
+// appends the copy of the statement to the block, return e becomes an assignment of e to the result variable
+static bool cloneStatement(astStatementBlock* block, const astStatement* src, const inlinedCall* call) {
+	int suffix = call->suffix;
+	astStatement statement = *src;
+	switch (src->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			astVariableDefinition* def = &statement.variableDef;
+			OPTIMISE(renameIdentifier(&def->variableName, &src->variableDef.variableName, suffix));
+			if (def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+				OPTIMISE(cloneExpression(&def->value.expr, &src->variableDef.value.expr, suffix));
+			} else if (def->hasInitValue) {
+				OPTIMISE(cloneCall(&def->value.call, &src->variableDef.value.call, suffix));
+			}
+			break;
+		}
+		case AST_STATEMENT_ASSIGN:
+			OPTIMISE(renameIdentifier(&statement.assignment.variableName, &src->assignment.variableName, suffix));
+			OPTIMISE(cloneExpression(&statement.assignment.value, &src->assignment.value, suffix));
+			break;
+		case AST_STATEMENT_COND: {
+			astConditional* conditional = &statement.conditional;
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+				OPTIMISE(cloneExpression(&conditional->condition.expression, &src->conditional.condition.expression,
+										 suffix));
+			} else {
+				OPTIMISE(renameIdentifier(&conditional->condition.optBinding.identifier,
+										  &src->conditional.condition.optBinding.identifier, suffix));
+			}
+			OPTIMISE(cloneBlock(&conditional->body, &src->conditional.body, call));
+			if (conditional->hasElse) {
+				OPTIMISE(cloneBlock(&conditional->bodyElse, &src->conditional.bodyElse, call));
+			}
+			break;
+		}
+		case AST_STATEMENT_ITER:
+			OPTIMISE(cloneExpression(&statement.iteration.condition, &src->iteration.condition, suffix));
+			OPTIMISE(cloneBlock(&statement.iteration.body, &src->iteration.body, call));
+			break;
+		case AST_STATEMENT_FUNC_CALL:
+			OPTIMISE(cloneCall(&statement.functionCall, &src->functionCall, suffix));
+			break;
+		case AST_STATEMENT_PROC_CALL:
+			OPTIMISE(astIdentCreate(&statement.procedureCall.procName, src->procedureCall.procName.name) == 0);
+			OPTIMISE(cloneParameters(&statement.procedureCall.params, &src->procedureCall.params, suffix));
+			break;
+		case AST_STATEMENT_RETURN:
+			if (!src->returnStmt.hasValue) {
+				return true;  // the end of the copy
+			}
+			assert(call->result);
+			statement.type = AST_STATEMENT_ASSIGN;
+			OPTIMISE(astIdentCreate(&statement.assignment.variableName, call->result) == 0);
+			OPTIMISE(cloneExpression(&statement.assignment.value, &src->returnStmt.value, suffix));
+			statement.assignment.convertValue = false;
+			break;
+	}
+	return !astStatementBlockAdd(block, statement);
+}
+
+static bool cloneBlock(astStatementBlock* dst, const astStatementBlock* src, const inlinedCall* call) {
+	astStatementBlockCreate(dst);
+	for (int i = 0; i < src->count; i++) {
+		OPTIMISE(cloneStatement(dst, &src->statements[i], call));
+	}
+	return true;
+}
+
+// EXPANSION
+
+// definition without initialiser, the variable is assigned later
+static astStatement declaration(astIdentifier name, astDataType type) {
+	astStatement statement;
+	statement.type = AST_STATEMENT_VAR_DEF;
+	astVariableDefinition* def = &statement.variableDef;
+	def->variableName = name;
+	def->variableType = type;
+	def->hasExplicitType = true;
+	def->hasInitValue = false;
+	def->immutable = false;
+	def->convertValue = false;
+	def->nilInit = false;
+	return statement;
+}
+
+static bool argumentDefinition(astStatementBlock* block, const astParameter* param, const astTerm* argument,
+							   int suffix) {
+	astStatement statement = declaration((astIdentifier){NULL}, param->dataType);
+	astVariableDefinition* def = &statement.variableDef;
+	def->immutable = true;
+	def->hasInitValue = true;
+	def->value.type = AST_VAR_INIT_EXPR;
+	def->value.expr.type = AST_EXPR_TERM;
+	def->value.expr.dataType = param->dataType;
+	def->value.expr.isLiteral = argument->type != AST_TERM_ID;
+	OPTIMISE(renameIdentifier(&def->variableName, &param->insideName, suffix));
+	OPTIMISE(copyTerm(&def->value.expr.term, argument));
+	return !astStatementBlockAdd(block, statement);
+}
+
+static bool isArgument(const astInputParameterList* args, const char* name) {
+	for (int i = 0; i < args->count; i++) {
+		const astTerm* term = &args->data[i].value;
+		if (term->type == AST_TERM_ID && strcmp(term->identifier.name, name) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Builds the statements replacing the call statement, which is consumed. The arguments and the copy of the body run in
+// a conditional decided by optimiser, so that they have their own scope.
+static bool expandCall(astStatement* statement, int funcId, astStatementBlock* expansion) {
+	const astFunctionDefinition* def = FUNCTIONS[funcId].definition;
+	inlinedCall call = {++INLINED_CALLS, NULL};
+	astStatementBlockCreate(expansion);
+
+	const astInputParameterList* args;
+	bool resultVariable = false;  // the result goes through the variable $<suffix>
+	if (statement->type == AST_STATEMENT_VAR_DEF) {
+		args = &statement->variableDef.value.call.params;
+		call.result = statement->variableDef.variableName.name;
+		// an argument can be a variable shadowed by the defined one
+		resultVariable = isArgument(args, call.result);
+	} else if (statement->type == AST_STATEMENT_FUNC_CALL) {
+		args = &statement->functionCall.params;
+		call.result = statement->functionCall.varName.name;
+	} else {
+		args = &statement->procedureCall.params;
+		// the returned value may fail at runtime, an unused result variable is removed by dead store elimination
+		resultVariable = def->hasReturnValue;
+	}
+	astIdentifier result = {NULL};
+	if (resultVariable) {
+		OPTIMISE(renameIdentifier(&result, &(astIdentifier){""}, call.suffix));
+		call.result = result.name;
+	}
+
+	astStatementBlock body;
+	astStatementBlockCreate(&body);
+	if (resultVariable && statement->type == AST_STATEMENT_PROC_CALL) {
+		OPTIMISE(!astStatementBlockAdd(&body, declaration(result, def->returnType)));
+	}
+	for (int i = 0; i < def->params.count; i++) {
+		if (def->params.data[i].used) {
+			OPTIMISE(argumentDefinition(&body, &def->params.data[i], &args->data[i].value, call.suffix));
+		}
+	}
+	for (int i = 0; i < def->body.count; i++) {
+		OPTIMISE(cloneStatement(&body, &def->body.statements[i], &call));
+	}
+
+	astStatement wrapper;
+	astScopeCreate(&wrapper, body);
+
+	if (statement->type != AST_STATEMENT_VAR_DEF) {
+		OPTIMISE(!astStatementBlockAdd(expansion, wrapper));
+		astStatementDestroy(statement);
+		return true;
+	}
+
+	// the defined variable is declared before the copy assigns it, or initialised by the result variable after it
+	astVariableDefinition* target = &statement->variableDef;
+	astFunctionCallDestroy(&target->value.call);
+	if (!resultVariable) {
+		target->hasInitValue = false;
+		target->immutable = false;
+		target->nilInit = false;
+		OPTIMISE(!astStatementBlockAdd(expansion, *statement));
+		return !astStatementBlockAdd(expansion, wrapper);
+	}
+	astIdentifier declared;
+	OPTIMISE(astIdentCreate(&declared, result.name) == 0);
+	OPTIMISE(!astStatementBlockAdd(expansion, declaration(declared, def->returnType)));
+	OPTIMISE(!astStatementBlockAdd(expansion, wrapper));
+	target->value.type = AST_VAR_INIT_EXPR;
+	target->value.expr.type = AST_EXPR_TERM;
+	target->value.expr.term.type = AST_TERM_ID;
+	target->value.expr.term.identifier = result;
+	target->value.expr.dataType = def->returnType;
+	target->value.expr.isLiteral = false;
+	target->convertValue = false;
+	return !astStatementBlockAdd(expansion, *statement);
+}
+
+// PROCESSING
+
+static bool processFunction(int funcId);
+
+static bool shouldInline(int funcId, int loopDepth) {
+	const inlinerFunction* function = &FUNCTIONS[funcId];
+	if (function->state != FUNCTION_DONE || function->recursive || !function->inlinable) {
+		return false;
+	}
+	// a function called once is removed after inlining, so the program does not grow
+	int maxSize = function->calls == 1 ? INLINE_MAX_ONCE_SIZE : loopDepth > 0 ? INLINE_MAX_LOOP_SIZE : INLINE_MAX_SIZE;
+	return function->size <= maxSize;
+}
+
+static bool inlineInBlock(astStatementBlock* block, int loopDepth);
+
+// *expanded tells whether the statement was consumed by the expansion of its call
+static bool inlineInStatement(astStatement* statement, int loopDepth, astStatementBlock* expansion, bool* expanded) {
+	*expanded = false;
+	if (statement->type == AST_STATEMENT_COND) {
+		OPTIMISE(inlineInBlock(&statement->conditional.body, loopDepth));
+		return !statement->conditional.hasElse || inlineInBlock(&statement->conditional.bodyElse, loopDepth);
+	} else if (statement->type == AST_STATEMENT_ITER) {
+		return inlineInBlock(&statement->iteration.body, loopDepth + 1);
+	}
+
+	int funcId = calledFunction(statement);
+	if (funcId == SYM_FUNC_NONE) {
+		return true;
+	}
+	OPTIMISE(processFunction(funcId));
+	if (!shouldInline(funcId, loopDepth)) {
+		return true;
+	}
+	*expanded = true;
+	return expandCall(statement, funcId, expansion);
+}
+
+// the block is rebuilt only when some call is expanded
+static bool inlineInBlock(astStatementBlock* block, int loopDepth) {
+	astStatementBlock result;
+	astStatementBlockCreate(&result);
+	bool changed = false;
+	for (int i = 0; i < block->count; i++) {
+		astStatementBlock expansion;
+		bool expanded;
+		OPTIMISE(inlineInStatement(&block->statements[i], loopDepth, &expansion, &expanded));
+		if (expanded && !changed) {
+			changed = true;
+			for (int j = 0; j < i; j++) {
+				OPTIMISE(!astStatementBlockAdd(&result, block->statements[j]));
+			}
+		}
+		if (expanded) {
+			for (int j = 0; j < expansion.count; j++) {
+				OPTIMISE(!astStatementBlockAdd(&result, expansion.statements[j]));
+			}
+			free(expansion.statements);
+		} else if (changed) {
+			OPTIMISE(!astStatementBlockAdd(&result, block->statements[i]));
+		}
+	}
+	if (changed) {
+		free(block->statements);
+		*block = result;
+	}
+	return true;
+}
+
+static bool processFunction(int funcId) {
+	inlinerFunction* function = &FUNCTIONS[funcId];
+	if (function->state == FUNCTION_VISITING) {
+		// all functions on the stack from the callee up are in the cycle
+		for (int i = VISITING_COUNT - 1; i >= 0; i--) {
+			FUNCTIONS[VISITING[i]].recursive = true;
+			if (VISITING[i] == funcId) {
+				break;
+			}
+		}
+		return true;
+	}
+	if (function->state == FUNCTION_DONE) {
+		return true;
+	}
+
+	astFunctionDefinition* def = function->definition;
+	function->state = FUNCTION_VISITING;
+	VISITING[VISITING_COUNT++] = funcId;
+	OPTIMISE(inlineInBlock(&def->body, 0));
+	VISITING_COUNT--;
+	function->state = FUNCTION_DONE;
+	if (function->recursive) {
+		return true;
+	}
+
+	bool local;
+	OPTIMISE(normaliseReturns(&def->body));
+	OPTIMISE(usesOnlyLocals(def, &local));
+	function->inlinable = local && returnsOnlyAtEnds(&def->body);
+	function->size = blockSize(&def->body);
+	return true;
+}
+
+bool inlineFunctions(astProgram* program, const symbolFuncTable* functionTable, bool* inlined) {
+	long inlinedBefore = INLINED_CALLS;
+	FUNCTIONS = calloc(functionTable->count, sizeof(inlinerFunction));
+	VISITING = malloc(functionTable->count * sizeof(int));
+	bool result = FUNCTIONS && VISITING && symStackCreate(&VAR_SYM_STACK);
+	VISITING_COUNT = 0;
+
+	for (int i = 0; result && i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION) {
+			FUNCTIONS[symFuncTableFind(functionTable, topStatement->functionDef.name.name)].definition =
+				&topStatement->functionDef;
+		}
+	}
+	for (int i = 0; result && i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION) {
+			countCalls(&topStatement->functionDef.body);
+		} else {
+			countCalls(&(astStatementBlock){&topStatement->statement, 1});
+		}
+	}
+	for (int i = 0; result && i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION) {
+			result = processFunction(symFuncTableFind(functionTable, topStatement->functionDef.name.name));
+		}
+	}
+
+	// global code, the old array keeps the definitions copied from during the rebuild
+	astProgram rebuilt;
+	astProgramCreate(&rebuilt);
+	for (int i = 0; result && i < program->count; i++) {
+		astTopLevelStatement topStatement = program->statements[i];
+		astStatementBlock expansion;
+		bool expanded = false;
+		if (topStatement.type == AST_TOP_STATEMENT) {
+			result = inlineInStatement(&topStatement.statement, 0, &expansion, &expanded);
+		}
+		if (result && !expanded) {
+			result = !astProgramAdd(&rebuilt, topStatement);
+		}
+		for (int j = 0; result && expanded && j < expansion.count; j++) {
+			astTopLevelStatement expanded = {.type = AST_TOP_STATEMENT, .statement = expansion.statements[j]};
+			result = !astProgramAdd(&rebuilt, expanded);
+		}
+		if (expanded) {
+			free(expansion.statements);
+		}
+	}
+	if (result) {
+		free(program->statements);
+		*program = rebuilt;
+	}
+
+	symStackDestroy(&VAR_SYM_STACK);
+	free(FUNCTIONS);
+	free(VISITING);
+	*inlined = INLINED_CALLS > inlinedBefore;
+	return result;
+}
+
+void inlinerPrintStatistics(FILE* output) { fprintf(output, "inliner inlined calls: %ld\n", INLINED_CALLS); }
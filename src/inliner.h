@@ -0,0 +1,26 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef INLINER_H
+#define INLINER_H
+
+#include <stdio.h>
+
+#include "ast.h"
+#include "symtable.h"
+
+// Replaces calls of small non-recursive user functions by copies of their bodies. *inlined tells whether any call
+// was replaced. Returns false when out of memory.
+bool inlineFunctions(astProgram*, const symbolFuncTable* functionTable, bool* inlined);
+
+// prints how many calls were inlined
+void inlinerPrintStatistics(FILE* output);
+
+#endif
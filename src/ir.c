@@ -0,0 +1,174 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "ir.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IR_INITIAL_CAPACITY 1024
+
+const irOpcodeDescriptor IR_OPCODES[IR_OPCODE_COUNT] = {
+	[IR_MOVE] = {"MOVE", 2},
+	[IR_CREATEFRAME] = {"CREATEFRAME", 0},
+	[IR_PUSHFRAME] = {"PUSHFRAME", 0},
+	[IR_POPFRAME] = {"POPFRAME", 0},
+	[IR_DEFVAR] = {"DEFVAR", 1},
+	[IR_CALL] = {"CALL", 1},
+	[IR_RETURN] = {"RETURN", 0},
+	[IR_PUSHS] = {"PUSHS", 1},
+	[IR_POPS] = {"POPS", 1},
+	[IR_CLEARS] = {"CLEARS", 0},
+	[IR_ADD] = {"ADD", 3},
+	[IR_SUB] = {"SUB", 3},
+	[IR_MUL] = {"MUL", 3},
+	[IR_DIV] = {"DIV", 3},
+	[IR_IDIV] = {"IDIV", 3},
+	[IR_ADDS] = {"ADDS", 0},
+	[IR_SUBS] = {"SUBS", 0},
+	[IR_MULS] = {"MULS", 0},
+	[IR_DIVS] = {"DIVS", 0},
+	[IR_IDIVS] = {"IDIVS", 0},
+	[IR_LT] = {"LT", 3},
+	[IR_GT] = {"GT", 3},
+	[IR_EQ] = {"EQ", 3},
+	[IR_LTS] = {"LTS", 0},
+	[IR_GTS] = {"GTS", 0},
+	[IR_EQS] = {"EQS", 0},
+	[IR_AND] = {"AND", 3},
+	[IR_OR] = {"OR", 3},
+	[IR_NOT] = {"NOT", 2},
+	[IR_ANDS] = {"ANDS", 0},
+	[IR_ORS] = {"ORS", 0},
+	[IR_NOTS] = {"NOTS", 0},
+	[IR_INT2FLOAT] = {"INT2FLOAT", 2},
+	[IR_FLOAT2INT] = {"FLOAT2INT", 2},
+	[IR_INT2CHAR] = {"INT2CHAR", 2},
+	[IR_STRI2INT] = {"STRI2INT", 3},
+	[IR_INT2FLOATS] = {"INT2FLOATS", 0},
+	[IR_FLOAT2INTS] = {"FLOAT2INTS", 0},
+	[IR_INT2CHARS] = {"INT2CHARS", 0},
+	[IR_STRI2INTS] = {"STRI2INTS", 0},
+	[IR_READ] = {"READ", 2},
+	[IR_WRITE] = {"WRITE", 1},
+	[IR_CONCAT] = {"CONCAT", 3},
+	[IR_STRLEN] = {"STRLEN", 2},
+	[IR_GETCHAR] = {"GETCHAR", 3},
+	[IR_SETCHAR] = {"SETCHAR", 3},
+	[IR_TYPE] = {"TYPE", 2},
+	[IR_LABEL] = {"LABEL", 1},
+	[IR_JUMP] = {"JUMP", 1},
+	[IR_JUMPIFEQ] = {"JUMPIFEQ", 3},
+	[IR_JUMPIFNEQ] = {"JUMPIFNEQ", 3},
+	[IR_JUMPIFEQS] = {"JUMPIFEQS", 1},
+	[IR_JUMPIFNEQS] = {"JUMPIFNEQS", 1},
+	[IR_EXIT] = {"EXIT", 1},
+	[IR_BREAK] = {"BREAK", 0},
+	[IR_DPRINT] = {"DPRINT", 1},
+};
+
+void irCodeCreate(irCode* code) {
+	code->data = NULL;
+	code->count = 0;
+	code->capacity = 0;
+}
+
+void irCodeDestroy(irCode* code) {
+	free(code->data);
+	irCodeCreate(code);
+}
+
+// returns pointer to room for count more instructions
+static irInstruction* reserve(irCode* code, int count) {
+	if (code->count + count > code->capacity) {
+		int capacity = code->capacity ? code->capacity : IR_INITIAL_CAPACITY;
+		while (code->count + count > capacity) {
+			capacity *= 2;
+		}
+		irInstruction* data = realloc(code->data, capacity * sizeof(irInstruction));
+		if (!data) {
+			fputs("Out of memory.\n", stderr);
+			exit(99);
+		}
+		code->data = data;
+		code->capacity = capacity;
+	}
+	return code->data + code->count;
+}
+
+irInstruction* irAppend(irCode* code, irOpcode opcode) {
+	irInstruction* instruction = reserve(code, 1);
+	*instruction = (irInstruction){.opcode = opcode};
+	code->count++;
+	return instruction;
+}
+
+void irMoveBack(irCode* code, int position, int start) {
+	int count = code->count - start;
+	// the moved instructions are parked in the free space behind the end of the array
+	irInstruction* parked = reserve(code, count);
+	memcpy(parked, code->data + start, count * sizeof(irInstruction));
+	memmove(code->data + position + count, code->data + position, (start - position) * sizeof(irInstruction));
+	memcpy(code->data + position, parked, count * sizeof(irInstruction));
+}
+
+// names of variables and labels compare equal with NULL only when both are NULL
+static bool namesEqual(const char* a, const char* b) { return a == b || (a && b && strcmp(a, b) == 0); }
+
+bool irOperandEquals(const irOperand* a, const irOperand* b) {
+	if (a->type != b->type) {
+		return false;
+	}
+	switch ((irOperandType)a->type) {
+		case IR_OPERAND_VARIABLE:
+			return a->frame == b->frame && a->prefix == b->prefix && (!a->prefix || a->number == b->number) &&
+				   namesEqual(a->name, b->name);
+		case IR_OPERAND_LABEL:
+			return a->name || b->name ? namesEqual(a->name, b->name) : a->number == b->number;
+		case IR_OPERAND_INT:
+			return a->integer == b->integer;
+		case IR_OPERAND_FLOAT:
+			// compares the representation, so 0.0 and -0.0 differ
+			return memcmp(&a->decimal, &b->decimal, sizeof(double)) == 0;
+		case IR_OPERAND_STRING:
+			return strcmp(a->string, b->string) == 0;
+		case IR_OPERAND_BOOL:
+			return a->boolean == b->boolean;
+		case IR_OPERAND_TYPE:
+			return strcmp(a->typeName, b->typeName) == 0;
+		case IR_OPERAND_NONE:
+		case IR_OPERAND_NIL:
+			break;
+	}
+	return true;
+}
+
+irOperand irNone() { return (irOperand){.type = IR_OPERAND_NONE}; }
+
+irOperand irVariableOperand(irFrame frame, char prefix, int number, const char* name) {
+	return (irOperand){.type = IR_OPERAND_VARIABLE, .frame = frame, .prefix = prefix, .number = number, .name = name};
+}
+
+irOperand irInt(int value) { return (irOperand){.type = IR_OPERAND_INT, .integer = value}; }
+
+irOperand irFloat(double value) { return (irOperand){.type = IR_OPERAND_FLOAT, .decimal = value}; }
+
+irOperand irString(const char* content) { return (irOperand){.type = IR_OPERAND_STRING, .string = content}; }
+
+irOperand irBool(bool value) { return (irOperand){.type = IR_OPERAND_BOOL, .boolean = value}; }
+
+irOperand irNil() { return (irOperand){.type = IR_OPERAND_NIL}; }
+
+irOperand irLabelOperand(int number) { return (irOperand){.type = IR_OPERAND_LABEL, .number = number}; }
+
+irOperand irFunctionLabel(const char* name) { return (irOperand){.type = IR_OPERAND_LABEL, .name = name}; }
+
+irOperand irType(const char* name) { return (irOperand){.type = IR_OPERAND_TYPE, .typeName = name}; }
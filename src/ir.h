@@ -0,0 +1,166 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef IR_H
+#define IR_H
+
+#include <stdbool.h>
+
+// Generated IFJcode23 kept in memory as a flat array of instructions, so it can be inspected and rewritten before it
+// is printed. Strings and names are not copied, they point to the AST or to static strings.
+
+typedef enum {
+	// frames and function calls
+	IR_MOVE,
+	IR_CREATEFRAME,
+	IR_PUSHFRAME,
+	IR_POPFRAME,
+	IR_DEFVAR,
+	IR_CALL,
+	IR_RETURN,
+	// data stack
+	IR_PUSHS,
+	IR_POPS,
+	IR_CLEARS,
+	// arithmetic, relational, boolean and conversion instructions
+	IR_ADD,
+	IR_SUB,
+	IR_MUL,
+	IR_DIV,
+	IR_IDIV,
+	IR_ADDS,
+	IR_SUBS,
+	IR_MULS,
+	IR_DIVS,
+	IR_IDIVS,
+	IR_LT,
+	IR_GT,
+	IR_EQ,
+	IR_LTS,
+	IR_GTS,
+	IR_EQS,
+	IR_AND,
+	IR_OR,
+	IR_NOT,
+	IR_ANDS,
+	IR_ORS,
+	IR_NOTS,
+	IR_INT2FLOAT,
+	IR_FLOAT2INT,
+	IR_INT2CHAR,
+	IR_STRI2INT,
+	IR_INT2FLOATS,
+	IR_FLOAT2INTS,
+	IR_INT2CHARS,
+	IR_STRI2INTS,
+	// input and output
+	IR_READ,
+	IR_WRITE,
+	// strings
+	IR_CONCAT,
+	IR_STRLEN,
+	IR_GETCHAR,
+	IR_SETCHAR,
+	// types
+	IR_TYPE,
+	// control flow
+	IR_LABEL,
+	IR_JUMP,
+	IR_JUMPIFEQ,
+	IR_JUMPIFNEQ,
+	IR_JUMPIFEQS,
+	IR_JUMPIFNEQS,
+	IR_EXIT,
+	// debugging
+	IR_BREAK,
+	IR_DPRINT,
+	IR_OPCODE_COUNT
+} irOpcode;
+
+typedef struct {
+	const char* name;
+	int operandCount;
+} irOpcodeDescriptor;
+
+extern const irOpcodeDescriptor IR_OPCODES[IR_OPCODE_COUNT];
+
+typedef enum {
+	IR_FRAME_GLOBAL,
+	IR_FRAME_LOCAL,
+	IR_FRAME_TEMPORARY,
+} irFrame;
+
+typedef enum {
+	IR_OPERAND_NONE,
+	IR_OPERAND_VARIABLE,
+	IR_OPERAND_INT,
+	IR_OPERAND_FLOAT,
+	IR_OPERAND_STRING,
+	IR_OPERAND_BOOL,
+	IR_OPERAND_NIL,
+	IR_OPERAND_LABEL,
+	IR_OPERAND_TYPE,  // type name of READ
+} irOperandType;
+
+// Operands are kept small, as generated programs have hundreds of thousands of instructions.
+// Variables are <frame>@<prefix><number><name>, prefix and number are left out if prefix is 0 and name may be NULL.
+// Labels are l<number>, or l<name> for functions.
+typedef struct {
+	unsigned char type;	  // irOperandType
+	unsigned char frame;  // irFrame of variables
+	char prefix;
+	int number;	 // of variables with prefix and labels
+	union {
+		const char* name;  // of variables and labels
+		int integer;
+		double decimal;
+		const char* string;
+		bool boolean;
+		const char* typeName;
+	};
+} irOperand;
+
+#define IR_MAX_OPERANDS 3
+
+typedef struct {
+	irOpcode opcode;
+	irOperand operands[IR_MAX_OPERANDS];  // unused ones are IR_OPERAND_NONE
+} irInstruction;
+
+typedef struct {
+	irInstruction* data;
+	int count;
+	int capacity;
+} irCode;
+
+void irCodeCreate(irCode* code);
+void irCodeDestroy(irCode* code);
+
+// appends an instruction without operands and returns it to fill them in, running out of memory is fatal as in the rest
+// of the code generation
+irInstruction* irAppend(irCode* code, irOpcode opcode);
+// moves the instructions appended since start (up to now) back to position, the ones in between follow them
+void irMoveBack(irCode* code, int position, int start);
+
+// same variable, label or literal value
+bool irOperandEquals(const irOperand* a, const irOperand* b);
+
+irOperand irNone();
+irOperand irVariableOperand(irFrame frame, char prefix, int number, const char* name);
+irOperand irInt(int value);
+irOperand irFloat(double value);
+irOperand irString(const char* content);
+irOperand irBool(bool value);
+irOperand irNil();
+irOperand irLabelOperand(int number);
+irOperand irFunctionLabel(const char* name);
+irOperand irType(const char* name);
+
+#endif
@@ -0,0 +1,346 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "licm.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "builtins.h"
+#include "optimiser.h"
+
+// A loop
+//     while i < n * m {
+//         let l = length(s)
+//         ...
+//     }
+// where n, m and s are not changed by the loop becomes
+//     if true {
+//         let $inv1 = n * m
+//         let $inv2 = length(s)
+//         while i < $inv1 {
+//             let l = $inv2
+//             ...
+//         }
+//     }
+// A value is invariant when none of its variables is defined or assigned anywhere in the loop. The moved values are
+// computed even if the loop does not run, so only operations which cannot fail are moved. Loops calling user functions
+// which may change global variables are left alone. Inner loops are processed first, so values invariant in several
+// nested loops move out of them one by one.
+
+typedef struct {
+	const char** names;	 // non-owning
+	int count;
+	int capacity;
+} nameSet;
+
+typedef struct {
+	const nameSet* variant;			 // variables defined or assigned in the loop
+	astStatementBlock* definitions;	 // of the moved values, placed before the loop
+} loopContext;
+
+static astFunctionDefinition** FUNCTIONS;  // indexed by function id
+static long HOISTED_EXPRESSIONS;
+static long HOISTED_CALLS;
+static int HOISTED_VARIABLES;  // numbers the variables of the moved values
+
+static bool nameSetAdd(nameSet* set, const char* name) {
+	if (set->count == set->capacity) {
+		int capacity = set->capacity ? set->capacity * 2 : 8;
+		const char** names = realloc(set->names, capacity * sizeof(const char*));
+		if (!names) {
+			return false;
+		}
+		set->names = names;
+		set->capacity = capacity;
+	}
+	set->names[set->count++] = name;
+	return true;
+}
+
+static bool nameSetContains(const nameSet* set, const char* name) {
+	for (int i = 0; i < set->count; i++) {
+		if (strcmp(set->names[i], name) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// VARIANT VARIABLES
+
+// user function which may assign global variables
+static bool isImpureCall(int funcId) {
+	return funcId != SYM_FUNC_NONE && !isBuiltinFunction(funcId) && !FUNCTIONS[funcId]->pure;
+}
+
+// *impure is set by calls which may change variables not named in the block
+static bool collectVariant(const astStatementBlock* block, nameSet* variant, bool* impure) {
+	for (int i = 0; i < block->count; i++) {
+		const astStatement* statement = &block->statements[i];
+		switch (statement->type) {
+			case AST_STATEMENT_VAR_DEF: {
+				const astVariableDefinition* def = &statement->variableDef;
+				OPTIMISE(nameSetAdd(variant, def->variableName.name));
+				if (def->hasInitValue && def->value.type == AST_VAR_INIT_FUNC) {
+					*impure = *impure || isImpureCall(def->value.call.funcId);
+				}
+				break;
+			}
+			case AST_STATEMENT_ASSIGN:
+				OPTIMISE(nameSetAdd(variant, statement->assignment.variableName.name));
+				break;
+			case AST_STATEMENT_COND: {
+				const astConditional* conditional = &statement->conditional;
+				if (conditional->condition.type == AST_CONDITION_OPT_BINDING) {
+					OPTIMISE(nameSetAdd(variant, conditional->condition.optBinding.identifier.name));
+				}
+				OPTIMISE(collectVariant(&conditional->body, variant, impure));
+				if (conditional->hasElse) {
+					OPTIMISE(collectVariant(&conditional->bodyElse, variant, impure));
+				}
+				break;
+			}
+			case AST_STATEMENT_ITER:
+				OPTIMISE(collectVariant(&statement->iteration.body, variant, impure));
+				break;
+			case AST_STATEMENT_FUNC_CALL:
+				OPTIMISE(nameSetAdd(variant, statement->functionCall.varName.name));
+				*impure = *impure || isImpureCall(statement->functionCall.funcId);
+				break;
+			case AST_STATEMENT_PROC_CALL:
+				*impure = *impure || isImpureCall(statement->procedureCall.funcId);
+				break;
+			case AST_STATEMENT_RETURN:
+				break;
+		}
+	}
+	return true;
+}
+
+// INVARIANT VALUES
+
+// none of the variables is defined or assigned in the loop
+static bool isInvariant(const astExpression* expr, const nameSet* variant) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return expr->term.type != AST_TERM_ID || !nameSetContains(variant, expr->term.identifier.name);
+		case AST_EXPR_BINARY:
+			return isInvariant(expr->binary.lhs, variant) && isInvariant(expr->binary.rhs, variant);
+		case AST_EXPR_UNWRAP:
+			return isInvariant(expr->unwrap.innerExpr, variant);
+	}
+	return false;
+}
+
+// builtins which cannot fail
+static bool isHoistableCall(const astFunctionCall* call, const nameSet* variant) {
+	switch (call->funcId) {
+		case BUILTIN_LENGTH:
+		case BUILTIN_SUBSTRING:
+		case BUILTIN_ORD:
+		case BUILTIN_INT2DOUBLE:
+			break;
+		default:
+			return false;
+	}
+	for (int i = 0; i < call->params.count; i++) {
+		const astTerm* term = &call->params.data[i].value;
+		if (term->type == AST_TERM_ID && nameSetContains(variant, term->identifier.name)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// definition of a new variable before the loop, *value becomes the variable
+static bool defineBeforeLoop(loopContext* ctx, astStatement* statement, astExpression* value, astDataType type) {
+	astVariableDefinition* def = &statement->variableDef;
+	statement->type = AST_STATEMENT_VAR_DEF;
+	def->variableType = type;
+	def->hasExplicitType = true;
+	def->hasInitValue = true;
+	def->immutable = true;
+	def->convertValue = false;
+	def->nilInit = false;
+
+	value->type = AST_EXPR_TERM;
+	value->term.type = AST_TERM_ID;
+	value->dataType = type;
+	value->isLiteral = false;
+	OPTIMISE(astIdentCreate(&value->term.identifier, def->variableName.name) == 0);
+	return !astStatementBlockAdd(ctx->definitions, *statement);
+}
+
+static bool hoistValue(astExpression* expr, loopContext* ctx) {
+	astStatement statement;
+	OPTIMISE(createTemporaryName(&statement.variableDef.variableName, "inv", ++HOISTED_VARIABLES));
+	statement.variableDef.value.type = AST_VAR_INIT_EXPR;
+	statement.variableDef.value.expr = *expr;
+	HOISTED_EXPRESSIONS++;
+	return defineBeforeLoop(ctx, &statement, expr, expr->dataType);
+}
+
+// the call is moved to the definition of a new variable before the loop, *value becomes the variable and *target the
+// variable the call assigned
+static bool hoistCall(astFunctionCall* call, loopContext* ctx, astIdentifier* target, astExpression* value) {
+	astStatement statement;
+	OPTIMISE(createTemporaryName(&statement.variableDef.variableName, "inv", ++HOISTED_VARIABLES));
+	*target = call->varName;
+	statement.variableDef.value.type = AST_VAR_INIT_FUNC;
+	statement.variableDef.value.call = *call;
+	OPTIMISE(astIdentCreate(&statement.variableDef.value.call.varName, statement.variableDef.variableName.name) == 0);
+	HOISTED_CALLS++;
+	return defineBeforeLoop(ctx, &statement, value, BUILTINS[call->funcId].returnType);
+}
+
+// moves the largest invariant parts of the expression
+static bool hoistExpression(astExpression* expr, loopContext* ctx) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return true;
+		case AST_EXPR_BINARY:
+			if (!expr->isLiteral && isInvariant(expr, ctx->variant) && !expressionCanFail(expr)) {
+				return hoistValue(expr, ctx);
+			}
+			return hoistExpression(expr->binary.lhs, ctx) && hoistExpression(expr->binary.rhs, ctx);
+		case AST_EXPR_UNWRAP:
+			return hoistExpression(expr->unwrap.innerExpr, ctx);
+	}
+	return true;
+}
+
+// comparisons are left in conditions, where they are compiled into the jumps
+static bool hoistCondition(astExpression* condition, loopContext* ctx) {
+	if (condition->type == AST_EXPR_BINARY && condition->binary.op >= AST_BINARY_EQ &&
+		condition->binary.op <= AST_BINARY_GREATER_EQ) {
+		return hoistExpression(condition->binary.lhs, ctx) && hoistExpression(condition->binary.rhs, ctx);
+	}
+	return hoistExpression(condition, ctx);
+}
+
+// inner loops are already processed, their values depend on variables they change
+static bool hoistFromBlock(astStatementBlock* block, loopContext* ctx) {
+	for (int i = 0; i < block->count; i++) {
+		astStatement* statement = &block->statements[i];
+		switch (statement->type) {
+			case AST_STATEMENT_VAR_DEF: {
+				astVariableDefinition* def = &statement->variableDef;
+				if (!def->hasInitValue) {
+					break;
+				}
+				if (def->value.type == AST_VAR_INIT_EXPR) {
+					OPTIMISE(hoistExpression(&def->value.expr, ctx));
+				} else if (isHoistableCall(&def->value.call, ctx->variant)) {
+					astIdentifier target;
+					astExpression value;
+					OPTIMISE(hoistCall(&def->value.call, ctx, &target, &value));
+					free(target.name);
+					def->value.type = AST_VAR_INIT_EXPR;
+					def->value.expr = value;
+				}
+				break;
+			}
+			case AST_STATEMENT_ASSIGN:
+				OPTIMISE(hoistExpression(&statement->assignment.value, ctx));
+				break;
+			case AST_STATEMENT_COND: {
+				astConditional* conditional = &statement->conditional;
+				if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+					OPTIMISE(hoistCondition(&conditional->condition.expression, ctx));
+				}
+				OPTIMISE(hoistFromBlock(&conditional->body, ctx));
+				if (conditional->hasElse) {
+					OPTIMISE(hoistFromBlock(&conditional->bodyElse, ctx));
+				}
+				break;
+			}
+			case AST_STATEMENT_FUNC_CALL:
+				if (isHoistableCall(&statement->functionCall, ctx->variant)) {
+					astIdentifier target;
+					astExpression value;
+					OPTIMISE(hoistCall(&statement->functionCall, ctx, &target, &value));
+					statement->type = AST_STATEMENT_ASSIGN;
+					statement->assignment.variableName = target;
+					statement->assignment.value = value;
+					statement->assignment.convertValue = false;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+	return true;
+}
+
+// the loop is replaced by a block defining the moved values before it
+static bool hoistFromLoop(astStatement* statement) {
+	astIteration* loop = &statement->iteration;
+	nameSet variant = {NULL, 0, 0};
+	bool impure = false;
+	bool result = collectVariant(&loop->body, &variant, &impure);
+	if (!result || impure) {
+		free(variant.names);
+		return result;
+	}
+
+	astStatementBlock definitions;
+	astStatementBlockCreate(&definitions);
+	loopContext ctx = {&variant, &definitions};
+	result = hoistCondition(&loop->condition, &ctx) && hoistFromBlock(&loop->body, &ctx);
+	free(variant.names);
+	if (!result || definitions.count == 0) {
+		astStatementBlockDestroy(&definitions);
+		return result;
+	}
+	OPTIMISE(!astStatementBlockAdd(&definitions, *statement));
+	astScopeCreate(statement, definitions);
+	return true;
+}
+
+static bool hoistInBlock(astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		astStatement* statement = &block->statements[i];
+		if (statement->type == AST_STATEMENT_COND) {
+			OPTIMISE(hoistInBlock(&statement->conditional.body));
+			if (statement->conditional.hasElse) {
+				OPTIMISE(hoistInBlock(&statement->conditional.bodyElse));
+			}
+		} else if (statement->type == AST_STATEMENT_ITER) {
+			OPTIMISE(hoistInBlock(&statement->iteration.body));
+			OPTIMISE(hoistFromLoop(statement));
+		}
+	}
+	return true;
+}
+
+bool hoistLoopInvariants(astProgram* program, const symbolFuncTable* functionTable) {
+	FUNCTIONS = findFunctionDefinitions(program, functionTable);
+	if (!FUNCTIONS) {
+		return false;
+	}
+
+	bool result = true;
+	for (int i = 0; result && i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION) {
+			result = hoistInBlock(&topStatement->functionDef.body);
+		} else {
+			result = hoistInBlock(&(astStatementBlock){&topStatement->statement, 1});
+		}
+	}
+	free(FUNCTIONS);
+	return result;
+}
+
+void licmPrintStatistics(FILE* output) {
+	fprintf(output, "licm hoisted expressions: %ld\n", HOISTED_EXPRESSIONS);
+	fprintf(output, "licm hoisted calls: %ld\n", HOISTED_CALLS);
+}
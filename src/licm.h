@@ -0,0 +1,26 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef LICM_H
+#define LICM_H
+
+#include <stdio.h>
+
+#include "ast.h"
+#include "symtable.h"
+
+// Moves expressions and builtin calls which compute the same value in every iteration of a while loop into variables
+// defined before the loop. Returns false when out of memory.
+bool hoistLoopInvariants(astProgram*, const symbolFuncTable* functionTable);
+
+// prints how many expressions and calls were moved out of loops
+void licmPrintStatistics(FILE* output);
+
+#endif
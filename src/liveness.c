@@ -0,0 +1,570 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "liveness.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "optimiser.h"
+#include "symtable.h"
+
+// Liveness is computed separately for each function body and for the global code. Local variables of the unit
+// are numbered, identifiers are resolved to the numbers in a forward pass and a backward pass over the statement
+// tree then computes the set of live variables before every statement. Global variables are never tracked.
+
+#define POINTER_MAP_INITIAL_CAPACITY 64
+#define VARIABLE_NONE -1
+
+typedef unsigned long long bitWord;
+#define WORD_BITS ((int)(sizeof(bitWord) * CHAR_BIT))
+
+// open addressing hash map from addresses of AST nodes to integers
+typedef struct {
+	const void** keys;
+	int* values;
+	int capacity;  // power of two
+	int count;
+} pointerMap;
+
+typedef struct {
+	pointerMap variables;	// variable names and identifiers -> variable index
+	pointerMap deadStores;	// statements -> whether their store is never read
+	bool* read;				// variable is read somewhere
+	bool* pinned;			// variable has a store which cannot be removed
+	int varCount;
+	int varCapacity;
+	int wordCount;	// length of the bitsets
+} livenessUnit;
+
+// scopes of local variables of the current unit
+static symbolTableStack VAR_SYM_STACK;
+
+static bool pointerMapCreate(pointerMap* map) {
+	map->capacity = POINTER_MAP_INITIAL_CAPACITY;
+	map->count = 0;
+	map->keys = calloc(map->capacity, sizeof(const void*));
+	map->values = malloc(map->capacity * sizeof(int));
+	return map->keys && map->values;
+}
+
+static void pointerMapDestroy(pointerMap* map) {
+	free(map->keys);
+	free(map->values);
+	map->keys = NULL;
+	map->values = NULL;
+	map->capacity = 0;
+	map->count = 0;
+}
+
+static unsigned hashPointer(const void* key) {
+	uintptr_t value = (uintptr_t)key;
+	return (unsigned)((value >> 3) * 2654435761u);
+}
+
+static int pointerMapSlot(const pointerMap* map, const void* key) {
+	unsigned pos = hashPointer(key) & (map->capacity - 1);
+	while (map->keys[pos] && map->keys[pos] != key) {
+		pos = (pos + 1) & (map->capacity - 1);
+	}
+	return pos;
+}
+
+static bool pointerMapPut(pointerMap* map, const void* key, int value) {
+	if ((map->count + 1) * 2 > map->capacity) {
+		pointerMap grown = {calloc(map->capacity * 2, sizeof(const void*)), malloc(map->capacity * 2 * sizeof(int)),
+							map->capacity * 2, 0};
+		if (!grown.keys || !grown.values) {
+			pointerMapDestroy(&grown);
+			return false;
+		}
+		for (int i = 0; i < map->capacity; i++) {
+			if (map->keys[i]) {
+				int pos = pointerMapSlot(&grown, map->keys[i]);
+				grown.keys[pos] = map->keys[i];
+				grown.values[pos] = map->values[i];
+				grown.count++;
+			}
+		}
+		pointerMapDestroy(map);
+		*map = grown;
+	}
+
+	int pos = pointerMapSlot(map, key);
+	if (!map->keys[pos]) {
+		map->keys[pos] = key;
+		map->count++;
+	}
+	map->values[pos] = value;
+	return true;
+}
+
+static int pointerMapGet(const pointerMap* map, const void* key, int notFound) {
+	int pos = pointerMapSlot(map, key);
+	return map->keys[pos] ? map->values[pos] : notFound;
+}
+
+// BITSETS
+
+static bitWord* bitsetCreate(const livenessUnit* unit) {
+	return calloc(unit->wordCount ? unit->wordCount : 1, sizeof(bitWord));
+}
+
+static void bitsetSet(bitWord* set, int index) { set[index / WORD_BITS] |= (bitWord)1 << (index % WORD_BITS); }
+
+static void bitsetReset(bitWord* set, int index) { set[index / WORD_BITS] &= ~((bitWord)1 << (index % WORD_BITS)); }
+
+static bool bitsetTest(const bitWord* set, int index) { return (set[index / WORD_BITS] >> (index % WORD_BITS)) & 1; }
+
+static void bitsetCopy(const livenessUnit* unit, bitWord* dst, const bitWord* src) {
+	memcpy(dst, src, unit->wordCount * sizeof(bitWord));
+}
+
+// dst |= src, returns whether dst has changed
+static bool bitsetUnion(const livenessUnit* unit, bitWord* dst, const bitWord* src) {
+	bool changed = false;
+	for (int i = 0; i < unit->wordCount; i++) {
+		bitWord merged = dst[i] | src[i];
+		changed |= merged != dst[i];
+		dst[i] = merged;
+	}
+	return changed;
+}
+
+// RESOLUTION
+
+static bool addVariable(livenessUnit* unit, const astVariableDefinition* def) {
+	if (unit->varCount == unit->varCapacity) {
+		int newCapacity = unit->varCapacity ? unit->varCapacity * 2 : 16;
+		bool* read = realloc(unit->read, newCapacity * sizeof(bool));
+		if (!read) {
+			return false;
+		}
+		unit->read = read;
+		bool* pinned = realloc(unit->pinned, newCapacity * sizeof(bool));
+		if (!pinned) {
+			return false;
+		}
+		unit->pinned = pinned;
+		unit->varCapacity = newCapacity;
+	}
+
+	int index = unit->varCount++;
+	unit->read[index] = false;
+	unit->pinned[index] = def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR &&
+						  expressionCanFail(&def->value.expr);
+
+	symbolVariable var = {def->variableType, def->immutable, NULL, NULL};
+	return pointerMapPut(&unit->variables, def->variableName.name, index) &&
+		   symStackInsertVar(&VAR_SYM_STACK, var, def->variableName.name);
+}
+
+// maps the identifier to the index of a local variable, *index is VARIABLE_NONE for other variables
+static bool resolveIdentifier(livenessUnit* unit, const astIdentifier* identifier, bool read, int* index) {
+	*index = VARIABLE_NONE;
+	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, identifier->name, NULL);
+	if (!slot) {
+		return true;
+	}
+	*index = pointerMapGet(&unit->variables, slot->name, VARIABLE_NONE);
+	if (*index == VARIABLE_NONE) {
+		return true;
+	}
+	if (read) {
+		unit->read[*index] = true;
+	}
+	return pointerMapPut(&unit->variables, identifier, *index);
+}
+
+static bool resolveTerm(livenessUnit* unit, const astTerm* term) {
+	int index;
+	return term->type != AST_TERM_ID || resolveIdentifier(unit, &term->identifier, true, &index);
+}
+
+static bool resolveExpression(livenessUnit* unit, const astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return resolveTerm(unit, &expr->term);
+		case AST_EXPR_BINARY:
+			return resolveExpression(unit, expr->binary.lhs) && resolveExpression(unit, expr->binary.rhs);
+		case AST_EXPR_UNWRAP:
+			return resolveExpression(unit, expr->unwrap.innerExpr);
+	}
+	return true;
+}
+
+static bool resolveInputParameterList(livenessUnit* unit, const astInputParameterList* list) {
+	for (int i = 0; i < list->count; i++) {
+		OPTIMISE(resolveTerm(unit, &list->data[i].value));
+	}
+	return true;
+}
+
+static bool resolveStatementBlock(livenessUnit*, const astStatementBlock*);
+
+static bool resolveStatement(livenessUnit* unit, const astStatement* statement) {
+	int index;
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			const astVariableDefinition* def = &statement->variableDef;
+			if (def->hasInitValue) {
+				if (def->value.type == AST_VAR_INIT_EXPR) {
+					OPTIMISE(resolveExpression(unit, &def->value.expr));
+				} else {
+					OPTIMISE(resolveInputParameterList(unit, &def->value.call.params));
+				}
+			}
+			// variables of the global scope are global variables
+			if (symStackCurrentScope(&VAR_SYM_STACK) != symStackGlobalScope(&VAR_SYM_STACK)) {
+				OPTIMISE(addVariable(unit, def));
+			}
+			return true;
+		}
+		case AST_STATEMENT_ASSIGN:
+			OPTIMISE(resolveExpression(unit, &statement->assignment.value));
+			OPTIMISE(resolveIdentifier(unit, &statement->assignment.variableName, false, &index));
+			if (index != VARIABLE_NONE && expressionCanFail(&statement->assignment.value)) {
+				unit->pinned[index] = true;
+			}
+			return true;
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+				OPTIMISE(resolveExpression(unit, &conditional->condition.expression));
+			} else {
+				// the unwrapped variable shares storage with the original one
+				OPTIMISE(resolveIdentifier(unit, &conditional->condition.optBinding.identifier, true, &index));
+			}
+			OPTIMISE(resolveStatementBlock(unit, &conditional->body));
+			return !conditional->hasElse || resolveStatementBlock(unit, &conditional->bodyElse);
+		}
+		case AST_STATEMENT_ITER:
+			OPTIMISE(resolveExpression(unit, &statement->iteration.condition));
+			return resolveStatementBlock(unit, &statement->iteration.body);
+		case AST_STATEMENT_FUNC_CALL:
+			OPTIMISE(resolveInputParameterList(unit, &statement->functionCall.params));
+			return resolveIdentifier(unit, &statement->functionCall.varName, false, &index);
+		case AST_STATEMENT_PROC_CALL:
+			return resolveInputParameterList(unit, &statement->procedureCall.params);
+		case AST_STATEMENT_RETURN:
+			return !statement->returnStmt.hasValue || resolveExpression(unit, &statement->returnStmt.value);
+	}
+	return true;
+}
+
+static bool resolveStatementBlock(livenessUnit* unit, const astStatementBlock* block) {
+	OPTIMISE(symStackPush(&VAR_SYM_STACK));
+	for (int i = 0; i < block->count; i++) {
+		OPTIMISE(resolveStatement(unit, &block->statements[i]));
+	}
+	symStackPop(&VAR_SYM_STACK);
+	return true;
+}
+
+// LIVENESS
+
+static void addUses(const livenessUnit* unit, const astExpression* expr, bitWord* live) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			if (expr->term.type == AST_TERM_ID) {
+				int index = pointerMapGet(&unit->variables, &expr->term.identifier, VARIABLE_NONE);
+				if (index != VARIABLE_NONE) {
+					bitsetSet(live, index);
+				}
+			}
+			break;
+		case AST_EXPR_BINARY:
+			addUses(unit, expr->binary.lhs, live);
+			addUses(unit, expr->binary.rhs, live);
+			break;
+		case AST_EXPR_UNWRAP:
+			addUses(unit, expr->unwrap.innerExpr, live);
+			break;
+	}
+}
+
+static void addParameterUses(const livenessUnit* unit, const astInputParameterList* list, bitWord* live) {
+	for (int i = 0; i < list->count; i++) {
+		const astTerm* term = &list->data[i].value;
+		if (term->type == AST_TERM_ID) {
+			int index = pointerMapGet(&unit->variables, &term->identifier, VARIABLE_NONE);
+			if (index != VARIABLE_NONE) {
+				bitsetSet(live, index);
+			}
+		}
+	}
+}
+
+// the variable is overwritten by the statement, so it is not live before it (unless used by the value)
+static bool killVariable(livenessUnit* unit, const astStatement* statement, int index, bool removable,
+						 bitWord* live) {
+	if (index == VARIABLE_NONE) {
+		return true;
+	}
+	bool dead = removable && !bitsetTest(live, index);
+	bitsetReset(live, index);
+	return pointerMapPut(&unit->deadStores, statement, dead);
+}
+
+static bool livenessStatementBlock(livenessUnit*, const astStatementBlock*, bitWord* live);
+
+// transforms the set of variables live after the statement to the set of variables live before it
+static bool livenessStatement(livenessUnit* unit, const astStatement* statement, bitWord* live) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			const astVariableDefinition* def = &statement->variableDef;
+			int index = pointerMapGet(&unit->variables, def->variableName.name, VARIABLE_NONE);
+			bool isExpr = def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR;
+			OPTIMISE(killVariable(unit, statement, index, !isExpr || !expressionCanFail(&def->value.expr), live));
+			if (isExpr) {
+				addUses(unit, &def->value.expr, live);
+			} else if (def->hasInitValue) {
+				addParameterUses(unit, &def->value.call.params, live);
+			}
+			return true;
+		}
+		case AST_STATEMENT_ASSIGN: {
+			const astAssignment* assignment = &statement->assignment;
+			int index = pointerMapGet(&unit->variables, &assignment->variableName, VARIABLE_NONE);
+			OPTIMISE(killVariable(unit, statement, index, !expressionCanFail(&assignment->value), live));
+			addUses(unit, &assignment->value, live);
+			return true;
+		}
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			bitWord* liveElse = bitsetCreate(unit);
+			if (!liveElse) {
+				return false;
+			}
+			bitsetCopy(unit, liveElse, live);
+			bool result = livenessStatementBlock(unit, &conditional->body, live) &&
+						  (!conditional->hasElse || livenessStatementBlock(unit, &conditional->bodyElse, liveElse));
+			bitsetUnion(unit, live, liveElse);
+			free(liveElse);
+
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+				addUses(unit, &conditional->condition.expression, live);
+			} else {
+				int index =
+					pointerMapGet(&unit->variables, &conditional->condition.optBinding.identifier, VARIABLE_NONE);
+				if (index != VARIABLE_NONE) {
+					bitsetSet(live, index);
+				}
+			}
+			return result;
+		}
+		case AST_STATEMENT_ITER: {
+			// live before the condition = live after the loop + condition + live before the body, iterated to fixpoint
+			const astIteration* iteration = &statement->iteration;
+			bitWord* liveBody = bitsetCreate(unit);
+			if (!liveBody) {
+				return false;
+			}
+			addUses(unit, &iteration->condition, live);
+			bool result = true;
+			do {
+				bitsetCopy(unit, liveBody, live);
+				result = livenessStatementBlock(unit, &iteration->body, liveBody);
+			} while (result && bitsetUnion(unit, live, liveBody));
+			free(liveBody);
+			return result;
+		}
+		case AST_STATEMENT_FUNC_CALL: {
+			const astFunctionCall* call = &statement->functionCall;
+			int index = pointerMapGet(&unit->variables, &call->varName, VARIABLE_NONE);
+			OPTIMISE(killVariable(unit, statement, index, true, live));
+			addParameterUses(unit, &call->params, live);
+			return true;
+		}
+		case AST_STATEMENT_PROC_CALL:
+			addParameterUses(unit, &statement->procedureCall.params, live);
+			return true;
+		case AST_STATEMENT_RETURN:
+			memset(live, 0, unit->wordCount * sizeof(bitWord));
+			if (statement->returnStmt.hasValue) {
+				addUses(unit, &statement->returnStmt.value, live);
+			}
+			return true;
+	}
+	return true;
+}
+
+static bool livenessStatementBlock(livenessUnit* unit, const astStatementBlock* block, bitWord* live) {
+	for (int i = block->count - 1; i >= 0; i--) {
+		OPTIMISE(livenessStatement(unit, &block->statements[i], live));
+	}
+	return true;
+}
+
+// REMOVAL
+
+// turns a call whose result is not needed into a procedure call
+static void discardResult(astStatement* statement, astFunctionCall call) {
+	astIdentDestroy(&call.varName);
+	statement->type = AST_STATEMENT_PROC_CALL;
+	statement->procedureCall.procName = call.funcName;
+	statement->procedureCall.params = call.params;
+	statement->procedureCall.funcId = call.funcId;
+}
+
+static void removeInStatementBlock(const livenessUnit*, astStatementBlock*);
+
+// returns false when the whole statement is removed
+static bool removeInStatement(const livenessUnit* unit, astStatement* statement) {
+	bool dead = pointerMapGet(&unit->deadStores, statement, false);
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF: {
+			astVariableDefinition* def = &statement->variableDef;
+			int index = pointerMapGet(&unit->variables, def->variableName.name, VARIABLE_NONE);
+			if (index == VARIABLE_NONE) {
+				return true;
+			}
+			if (!unit->read[index] && !unit->pinned[index]) {
+				// all stores are dead, so the variable itself is not needed
+				if (def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+					astStatementDestroy(statement);
+					return false;
+				} else if (def->hasInitValue) {
+					astIdentDestroy(&def->variableName);
+					discardResult(statement, def->value.call);
+					return true;
+				}
+				astStatementDestroy(statement);
+				return false;
+			}
+			if (dead && def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+				astExpressionDestroy(&def->value.expr);
+				def->hasInitValue = false;
+			}
+			if (dead) {
+				def->nilInit = false;
+			}
+			return true;
+		}
+		case AST_STATEMENT_ASSIGN:
+			if (dead) {
+				astStatementDestroy(statement);
+				return false;
+			}
+			return true;
+		case AST_STATEMENT_FUNC_CALL:
+			if (dead) {
+				discardResult(statement, statement->functionCall);
+			}
+			return true;
+		case AST_STATEMENT_COND:
+			removeInStatementBlock(unit, &statement->conditional.body);
+			if (statement->conditional.hasElse) {
+				removeInStatementBlock(unit, &statement->conditional.bodyElse);
+			}
+			return true;
+		case AST_STATEMENT_ITER:
+			removeInStatementBlock(unit, &statement->iteration.body);
+			return true;
+		default:
+			return true;
+	}
+}
+
+static void removeInStatementBlock(const livenessUnit* unit, astStatementBlock* block) {
+	int count = 0;
+	for (int i = 0; i < block->count; i++) {
+		if (removeInStatement(unit, &block->statements[i])) {
+			block->statements[count++] = block->statements[i];
+		}
+	}
+	block->count = count;
+}
+
+// UNITS
+
+static bool livenessUnitCreate(livenessUnit* unit) {
+	unit->read = NULL;
+	unit->pinned = NULL;
+	unit->varCount = 0;
+	unit->varCapacity = 0;
+	unit->wordCount = 0;
+	bool variables = pointerMapCreate(&unit->variables);
+	bool deadStores = pointerMapCreate(&unit->deadStores);
+	return variables && deadStores;
+}
+
+static void livenessUnitDestroy(livenessUnit* unit) {
+	pointerMapDestroy(&unit->variables);
+	pointerMapDestroy(&unit->deadStores);
+	free(unit->read);
+	free(unit->pinned);
+}
+
+static bool removeDeadStoresInFunction(astFunctionDefinition* def) {
+	livenessUnit unit;
+	bitWord* live = NULL;
+	bool result = livenessUnitCreate(&unit) && symStackPush(&VAR_SYM_STACK) &&  // parameters and globals
+				  resolveStatementBlock(&unit, &def->body);
+	if (result) {
+		symStackPop(&VAR_SYM_STACK);
+		unit.wordCount = (unit.varCount + WORD_BITS - 1) / WORD_BITS;
+		live = bitsetCreate(&unit);
+		result = live && livenessStatementBlock(&unit, &def->body, live);
+	}
+	if (result) {
+		removeInStatementBlock(&unit, &def->body);
+	}
+	free(live);
+	livenessUnitDestroy(&unit);
+	return result;
+}
+
+static bool removeDeadStoresInGlobalCode(astProgram* program) {
+	livenessUnit unit;
+	bitWord* live = NULL;
+	bool result = livenessUnitCreate(&unit) && symStackPush(&VAR_SYM_STACK);  // global scope
+	for (int i = 0; result && i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_STATEMENT) {
+			result = resolveStatement(&unit, &program->statements[i].statement);
+		}
+	}
+	if (result) {
+		symStackPop(&VAR_SYM_STACK);
+		unit.wordCount = (unit.varCount + WORD_BITS - 1) / WORD_BITS;
+		live = bitsetCreate(&unit);
+		result = live != NULL;
+	}
+	for (int i = program->count - 1; result && i >= 0; i--) {
+		if (program->statements[i].type == AST_TOP_STATEMENT) {
+			result = livenessStatement(&unit, &program->statements[i].statement, live);
+		}
+	}
+	// global statements store only into global variables, so none of them is removed as a whole
+	for (int i = 0; result && i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_STATEMENT) {
+			removeInStatement(&unit, &program->statements[i].statement);
+		}
+	}
+	free(live);
+	livenessUnitDestroy(&unit);
+	return result;
+}
+
+bool removeDeadStores(astProgram* program) {
+	if (!symStackCreate(&VAR_SYM_STACK)) {
+		return false;
+	}
+	bool result = removeDeadStoresInGlobalCode(program);
+	for (int i = 0; result && i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_FUNCTION) {
+			result = removeDeadStoresInFunction(&program->statements[i].functionDef);
+		}
+	}
+	symStackDestroy(&VAR_SYM_STACK);
+	return result;
+}
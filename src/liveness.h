@@ -0,0 +1,20 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef LIVENESS_H
+#define LIVENESS_H
+
+#include "ast.h"
+
+// Removes stores whose value is never read and definitions of variables which are never read,
+// clears nil initialisations overwritten before use. Returns false when out of memory.
+bool removeDeadStores(astProgram*);
+
+#endif
@@ -8,15 +8,27 @@
  *
  */
 
+#include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 
 #include "analyser.h"
 #include "ast.h"
+#include "cfg.h"
 #include "compiler.h"
+#include "cse.h"
+#include "emitter.h"
+#include "inliner.h"
+#include "ir.h"
 #include "lexer.h"
+#include "licm.h"
+#include "optimiser.h"
 #include "parser.h"
+#include "peephole.h"
 #include "printAST.h"
 #include "printToken.h"
+#include "simplifier.h"
 #include "symtable.h"
 
 // edit these two
@@ -27,13 +39,47 @@
 #undef TEST_LEXER
 #endif
 
-#define END(value)                   \
-	do {                             \
-		astProgramDestroy(&program); \
-		return value;                \
+#define END(value)                           \
+	do {                                     \
+		astProgramDestroy(&program);         \
+		symFuncTableDestroy(&functionTable); \
+		return value;                        \
 	} while (0)
 
-int main() {
+// -O0 turns off all optimisations
+static bool OPTIMISE = true;
+
+static void printCode(irCode* code) {
+	if (OPTIMISE) {
+		peepholeOptimise(code);
+		cfgOptimise(code);
+	}
+	emitCode(code);
+}
+
+int main(int argc, char** argv) {
+	bool useTemporaries = false;
+	bool printStatistics = false;
+	const char* outputPath = NULL;	// standard output by default
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-O0") == 0) {
+			OPTIMISE = false;  // emit code straight from the analysed AST
+		} else if (strcmp(argv[i], "-ftemporaries") == 0) {
+			useTemporaries = true;	// three-address code instead of stack instructions
+		} else if (strcmp(argv[i], "-fstats") == 0) {
+			printStatistics = true;	 // report what the optimisations did to stderr
+		} else if (strcmp(argv[i], "-o") == 0) {
+			if (i + 1 == argc) {
+				fputs("Missing path after -o.\n", stderr);
+				return 99;
+			}
+			outputPath = argv[++i];
+		} else {
+			fprintf(stderr, "Unknown option %s.\n", argv[i]);
+			return 99;
+		}
+	}
+
 #ifdef TEST_LEXER
 	while (true) {
 		token tok;
@@ -51,6 +97,8 @@ int main() {
 
 	astProgram program;
 	astProgramCreate(&program);
+	symbolFuncTable functionTable;
+	symFuncTableCreate(&functionTable);
 
 	switch (parseProgram(&program)) {
 		case PARSE_LEXER_ERROR:
@@ -68,8 +116,6 @@ int main() {
 	return 0;
 #endif
 
-	symbolTable functionTable;
-	symTableCreate(&functionTable);
 	switch (analyseProgram(&program, &functionTable)) {
 		case ANALYSIS_UNDEFINED_FUNC:
 			END(3);
@@ -91,7 +137,30 @@ int main() {
 			break;
 	}
 
-	compileProgram(&program, &functionTable);
-	astProgramDestroy(&program);
-	return 0;
+	if (OPTIMISE && !optimiseProgram(&program, &functionTable)) {
+		END(99);
+	}
+
+	emitLine(".IFJcode23");
+	compileProgram(&program, &functionTable, useTemporaries, printCode);
+	if (printStatistics) {
+		peepholePrintStatistics(stderr);
+		simplifierPrintStatistics(stderr);
+		inlinerPrintStatistics(stderr);
+		licmPrintStatistics(stderr);
+		csePrintStatistics(stderr);
+		cfgPrintStatistics(stderr);
+	}
+
+	// the file is created only for successfully compiled programs
+	int output = outputPath ? open(outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0644) : STDOUT_FILENO;
+	bool written = output >= 0 && emitterFlush(output);
+	if (outputPath && output >= 0) {
+		close(output);
+	}
+	if (!written) {
+		fputs("Cannot write the output.\n", stderr);
+		END(99);
+	}
+	END(0);
 }
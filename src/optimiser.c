@@ -0,0 +1,565 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "optimiser.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "builtins.h"
+#include "cse.h"
+#include "evaluator.h"
+#include "inliner.h"
+#include "licm.h"
+#include "liveness.h"
+#include "simplifier.h"
+#include "symtable.h"
+
+#define EVALUATION_PROGRAM_FUEL 2000000	 // compile time evaluation of all calls together
+
+// tracks constants, i.e. immutable variables initialised by a literal
+static symbolTableStack VAR_SYM_STACK;
+// definitions of user functions indexed by function id, for compile time evaluation
+static astFunctionDefinition** FUNCTIONS;
+static int EVALUATION_FUEL;	 // left for the rest of the program
+
+// forward decl
+static bool optimiseStatementBlock(astStatementBlock*);
+
+static bool isLiteralTerm(const astExpression* expr) {
+	return expr->type == AST_EXPR_TERM && expr->term.type != AST_TERM_ID;
+}
+
+static bool isBoolLiteral(const astExpression* expr, bool value) {
+	return expr->type == AST_EXPR_TERM && expr->term.type == AST_TERM_BOOL && expr->term.boolean.value == value;
+}
+
+// replaces whole expression by an already owned term
+static void replaceByTerm(astExpression* expr, astTerm term) {
+	astExpressionDestroy(expr);
+	expr->type = AST_EXPR_TERM;
+	expr->term = term;
+	expr->isLiteral = term.type != AST_TERM_ID;
+}
+
+// replaces constant variable by its value
+static bool propagateConstant(astTerm* term) {
+	if (term->type != AST_TERM_ID) {
+		return true;
+	}
+	symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, term->identifier.name, NULL);
+	if (!slot || !slot->variable.constant) {
+		return true;
+	}
+
+	astTerm value;
+	OPTIMISE(copyTerm(&value, slot->variable.constant));
+	astTermDestroy(term);
+	*term = value;
+	return true;
+}
+
+// replaces binary expression with literal operands by its value, if it can be computed at compile time
+static bool foldBinaryExpression(astExpression* expr) {
+	astBinaryExpression* binary = &expr->binary;
+	if (!isLiteralTerm(binary->lhs) || !isLiteralTerm(binary->rhs)) {
+		return true;
+	}
+
+	astTerm result;
+	bool computed;
+	OPTIMISE(evaluateBinary(binary, &binary->lhs->term, &binary->rhs->term, &result, &computed));
+	if (computed) {
+		replaceByTerm(expr, result);
+	}
+	return true;
+}
+
+// implicit int to double conversion of a literal is done at compile time
+static void convertLiteral(astExpression* value, bool* convert) {
+	if (*convert && value->type == AST_EXPR_TERM && value->term.type == AST_TERM_INT) {
+		makeDecimal(&value->term);
+		value->dataType.type = AST_TYPE_DOUBLE;
+		*convert = false;
+	}
+}
+
+static bool optimiseExpression(astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			OPTIMISE(propagateConstant(&expr->term));
+			expr->isLiteral = expr->term.type != AST_TERM_ID;
+			break;
+		case AST_EXPR_BINARY:
+			OPTIMISE(optimiseExpression(expr->binary.lhs));
+			OPTIMISE(optimiseExpression(expr->binary.rhs));
+			convertLiteral(expr->binary.lhs, &expr->binary.convertLhs);
+			convertLiteral(expr->binary.rhs, &expr->binary.convertRhs);
+			OPTIMISE(foldBinaryExpression(expr));
+			simplifyExpression(expr);
+			break;
+		case AST_EXPR_UNWRAP:
+			OPTIMISE(optimiseExpression(expr->unwrap.innerExpr));
+			if (isLiteralTerm(expr->unwrap.innerExpr)) {
+				// unwrapping has no runtime effect
+				astTerm value = expr->unwrap.innerExpr->term;
+				free(expr->unwrap.innerExpr);
+				expr->type = AST_EXPR_TERM;
+				expr->term = value;
+				expr->isLiteral = true;
+			}
+			break;
+	}
+	return true;
+}
+
+static bool optimiseInputParameterList(astInputParameterList* list) {
+	for (int i = 0; i < list->count; i++) {
+		OPTIMISE(propagateConstant(&list->data[i].value));
+	}
+	return true;
+}
+
+static bool insertVariable(const char* name, astDataType type, bool immutable, const astTerm* constant) {
+	symbolVariable variable = {type, immutable, NULL, constant};
+	return symStackInsertVar(&VAR_SYM_STACK, variable, name);
+}
+
+// computes call of a pure function with literal arguments, the result is stored to value as a literal term
+static bool evaluatePureCall(const astFunctionCall* call, astExpression* value, bool* evaluated) {
+	*evaluated = false;
+	for (int i = 0; i < call->params.count; i++) {
+		if (call->params.data[i].value.type == AST_TERM_ID) {
+			return true;
+		}
+	}
+
+	OPTIMISE(evaluateCall(FUNCTIONS, call->funcId, &call->params, &EVALUATION_FUEL, &value->term, evaluated));
+	if (*evaluated) {
+		value->type = AST_EXPR_TERM;
+		value->dataType =
+			isBuiltinFunction(call->funcId) ? BUILTINS[call->funcId].returnType : FUNCTIONS[call->funcId]->returnType;
+		value->isLiteral = true;
+	}
+	return true;
+}
+
+static bool optimiseVariableDef(astVariableDefinition* def) {
+	const astTerm* constant = NULL;
+	if (def->hasInitValue && def->value.type == AST_VAR_INIT_FUNC) {
+		OPTIMISE(optimiseInputParameterList(&def->value.call.params));
+		astExpression value;
+		bool evaluated;
+		OPTIMISE(evaluatePureCall(&def->value.call, &value, &evaluated));
+		if (evaluated) {
+			astFunctionCallDestroy(&def->value.call);
+			def->value.type = AST_VAR_INIT_EXPR;
+			def->value.expr = value;
+		}
+	}
+	if (def->hasInitValue && def->value.type == AST_VAR_INIT_EXPR) {
+		astExpression* value = &def->value.expr;
+		OPTIMISE(optimiseExpression(value));
+		convertLiteral(value, &def->convertValue);
+		if (isLiteralTerm(value) && def->immutable) {
+			constant = &value->term;
+		}
+	}
+	return insertVariable(def->variableName.name, def->variableType, def->immutable, constant);
+}
+
+// x = f(...) with a computable result becomes an assignment of the result
+static bool optimiseFunctionCall(astStatement* statement) {
+	astFunctionCall* call = &statement->functionCall;
+	OPTIMISE(optimiseInputParameterList(&call->params));
+	astExpression value;
+	bool evaluated;
+	OPTIMISE(evaluatePureCall(call, &value, &evaluated));
+	if (evaluated) {
+		astIdentifier variableName = call->varName;
+		call->varName.name = NULL;
+		astFunctionCallDestroy(call);
+		statement->type = AST_STATEMENT_ASSIGN;
+		statement->assignment.variableName = variableName;
+		statement->assignment.value = value;
+		statement->assignment.convertValue = false;
+	}
+	return true;
+}
+
+static bool optimiseConditional(astConditional* conditional) {
+	if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+		OPTIMISE(optimiseExpression(&conditional->condition.expression));
+		OPTIMISE(optimiseStatementBlock(&conditional->body));
+	} else {
+		const char* name = conditional->condition.optBinding.identifier.name;
+		symbolTableSlot* slot = symStackLookup(&VAR_SYM_STACK, name, NULL);
+		assert(slot);
+		const astTerm* constant = slot->variable.constant;
+
+		if (constant && constant->type == AST_TERM_NIL) {
+			// the body never runs, it is not optimised as it would see the nil as a non-nullable value
+			astStatementBlockDestroy(&conditional->body);
+			conditional->body.count = 0;
+		} else {
+			// unwrapped variable shadows the original one in the body
+			if (!symStackPush(&VAR_SYM_STACK)) {
+				return false;
+			}
+			astDataType type = slot->variable.type;
+			type.nullable = false;
+			OPTIMISE(insertVariable(name, type, true, constant));
+			OPTIMISE(optimiseStatementBlock(&conditional->body));
+			symStackPop(&VAR_SYM_STACK);
+		}
+
+		if (constant) {
+			// uses of the variable in the body were replaced by the constant, the binding is not needed
+			astIdentDestroy(&conditional->condition.optBinding.identifier);
+			astExpression* condition = &conditional->condition.expression;
+			conditional->condition.type = AST_CONDITION_EXPRESSION;
+			condition->type = AST_EXPR_TERM;
+			condition->term.type = AST_TERM_BOOL;
+			condition->term.boolean.value = constant->type != AST_TERM_NIL;
+			condition->dataType.type = AST_TYPE_BOOL;
+			condition->dataType.nullable = false;
+			condition->isLiteral = true;
+		}
+	}
+	if (conditional->hasElse) {
+		OPTIMISE(optimiseStatementBlock(&conditional->bodyElse));
+	}
+
+	// keep only the branch which is taken, the condition is then literal true without else
+	if (conditional->condition.type == AST_CONDITION_EXPRESSION) {
+		astExpression* condition = &conditional->condition.expression;
+		if (isBoolLiteral(condition, true) && conditional->hasElse) {
+			astStatementBlockDestroy(&conditional->bodyElse);
+			conditional->hasElse = false;
+		} else if (isBoolLiteral(condition, false) && conditional->hasElse) {
+			astStatementBlockDestroy(&conditional->body);
+			conditional->body = conditional->bodyElse;
+			conditional->hasElse = false;
+			condition->term.boolean.value = true;
+		}
+	}
+	return true;
+}
+
+static bool optimiseStatement(astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			return optimiseVariableDef(&statement->variableDef);
+		case AST_STATEMENT_ASSIGN:
+			OPTIMISE(optimiseExpression(&statement->assignment.value));
+			convertLiteral(&statement->assignment.value, &statement->assignment.convertValue);
+			return true;
+		case AST_STATEMENT_COND:
+			return optimiseConditional(&statement->conditional);
+		case AST_STATEMENT_ITER:
+			OPTIMISE(optimiseExpression(&statement->iteration.condition));
+			return optimiseStatementBlock(&statement->iteration.body);
+		case AST_STATEMENT_FUNC_CALL:
+			return optimiseFunctionCall(statement);
+		case AST_STATEMENT_PROC_CALL:
+			return optimiseInputParameterList(&statement->procedureCall.params);
+		case AST_STATEMENT_RETURN:
+			if (statement->returnStmt.hasValue) {
+				return optimiseExpression(&statement->returnStmt.value);
+			}
+			return true;
+	}
+	return true;
+}
+
+// statements which never execute their body
+static bool isDeadStatement(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_COND:
+			return statement->conditional.condition.type == AST_CONDITION_EXPRESSION &&
+				   isBoolLiteral(&statement->conditional.condition.expression, false);
+		case AST_STATEMENT_ITER:
+			return isBoolLiteral(&statement->iteration.condition, false);
+		default:
+			return false;
+	}
+}
+
+// statements after which nothing in the same block is executed
+// nested blocks are already cleaned up, so a returning block ends with a returning statement
+static bool alwaysReturns(const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_RETURN:
+			return true;
+		case AST_STATEMENT_COND: {
+			const astConditional* conditional = &statement->conditional;
+			const astStatementBlock* body = &conditional->body;
+			bool bodyReturns = body->count > 0 && alwaysReturns(&body->statements[body->count - 1]);
+			if (conditional->condition.type == AST_CONDITION_EXPRESSION &&
+				isBoolLiteral(&conditional->condition.expression, true)) {
+				return bodyReturns;
+			}
+			const astStatementBlock* bodyElse = &conditional->bodyElse;
+			return bodyReturns && conditional->hasElse && bodyElse->count > 0 &&
+				   alwaysReturns(&bodyElse->statements[bodyElse->count - 1]);
+		}
+		default:
+			return false;
+	}
+}
+
+// removes dead statements and everything after a return
+// must not be done while the block's scope is open as constants point into the block
+static void removeDeadStatements(astStatementBlock* block) {
+	int count = 0;
+	int i = 0;
+	for (; i < block->count; i++) {
+		astStatement* statement = &block->statements[i];
+		if (isDeadStatement(statement)) {
+			astStatementDestroy(statement);
+			continue;
+		}
+		block->statements[count++] = *statement;
+		if (alwaysReturns(statement)) {
+			i++;
+			break;
+		}
+	}
+	for (; i < block->count; i++) {
+		astStatementDestroy(&block->statements[i]);  // unreachable
+	}
+	block->count = count;
+}
+
+static bool optimiseStatementBlock(astStatementBlock* block) {
+	if (!symStackPush(&VAR_SYM_STACK)) {
+		return false;
+	}
+	for (int i = 0; i < block->count; i++) {
+		OPTIMISE(optimiseStatement(&block->statements[i]));
+	}
+	symStackPop(&VAR_SYM_STACK);
+	removeDeadStatements(block);
+	return true;
+}
+
+static bool optimiseFunctionDef(astFunctionDefinition* def) {
+	// parameters shadow global constants
+	if (!symStackPush(&VAR_SYM_STACK)) {
+		return false;
+	}
+	for (int i = 0; i < def->params.count; i++) {
+		const astParameter* param = &def->params.data[i];
+		if (param->used) {
+			OPTIMISE(insertVariable(param->insideName.name, param->dataType, true, NULL));
+		}
+	}
+	OPTIMISE(optimiseStatementBlock(&def->body));
+	symStackPop(&VAR_SYM_STACK);
+	return true;
+}
+
+static bool optimiseTopLevel(astProgram* program) {
+	if (!symStackPush(&VAR_SYM_STACK)) {  // global scope
+		return false;
+	}
+	// functions see only the global constants defined before them, same as in analyser
+	for (int i = 0; i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_STATEMENT) {
+			OPTIMISE(optimiseStatement(&topStatement->statement));
+		} else {
+			OPTIMISE(optimiseFunctionDef(&topStatement->functionDef));
+		}
+	}
+	symStackPop(&VAR_SYM_STACK);
+
+	// remove dead global statements
+	int count = 0;
+	for (int i = 0; i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_STATEMENT && isDeadStatement(&topStatement->statement)) {
+			astStatementDestroy(&topStatement->statement);
+		} else {
+			program->statements[count++] = *topStatement;
+		}
+	}
+	program->count = count;
+	return true;
+}
+
+// CALL GRAPH
+
+typedef struct {
+	astFunctionDefinition** definitions;  // indexed by function id, NULL for builtins
+	bool* reachable;					  // indexed by function id
+	int* worklist;						  // reachable functions whose bodies were not visited yet
+	int worklistCount;
+} callGraph;
+
+static void markCalled(callGraph* graph, int funcId) {
+	if (funcId != SYM_FUNC_NONE && !graph->reachable[funcId]) {
+		graph->reachable[funcId] = true;
+		graph->worklist[graph->worklistCount++] = funcId;
+	}
+}
+
+static void markCalledFromBlock(callGraph*, const astStatementBlock*);
+
+static void markCalledFromStatement(callGraph* graph, const astStatement* statement) {
+	switch (statement->type) {
+		case AST_STATEMENT_VAR_DEF:
+			if (statement->variableDef.hasInitValue && statement->variableDef.value.type == AST_VAR_INIT_FUNC) {
+				markCalled(graph, statement->variableDef.value.call.funcId);
+			}
+			break;
+		case AST_STATEMENT_COND:
+			markCalledFromBlock(graph, &statement->conditional.body);
+			if (statement->conditional.hasElse) {
+				markCalledFromBlock(graph, &statement->conditional.bodyElse);
+			}
+			break;
+		case AST_STATEMENT_ITER:
+			markCalledFromBlock(graph, &statement->iteration.body);
+			break;
+		case AST_STATEMENT_FUNC_CALL:
+			markCalled(graph, statement->functionCall.funcId);
+			break;
+		case AST_STATEMENT_PROC_CALL:
+			markCalled(graph, statement->procedureCall.funcId);
+			break;
+		case AST_STATEMENT_ASSIGN:
+		case AST_STATEMENT_RETURN:
+			break;
+	}
+}
+
+static void markCalledFromBlock(callGraph* graph, const astStatementBlock* block) {
+	for (int i = 0; i < block->count; i++) {
+		markCalledFromStatement(graph, &block->statements[i]);
+	}
+}
+
+// removes functions which cannot be called from the global code
+static bool removeUnreachableFunctions(astProgram* program, const symbolFuncTable* functionTable) {
+	int functionCount = functionTable->count;
+	callGraph graph;
+	graph.definitions = calloc(functionCount, sizeof(astFunctionDefinition*));
+	graph.reachable = calloc(functionCount, sizeof(bool));
+	graph.worklist = malloc(functionCount * sizeof(int));
+	graph.worklistCount = 0;
+	if (!graph.definitions || !graph.reachable || !graph.worklist) {
+		free(graph.definitions);
+		free(graph.reachable);
+		free(graph.worklist);
+		return false;
+	}
+
+	for (int i = 0; i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION) {
+			int funcId = symFuncTableFind(functionTable, topStatement->functionDef.name.name);
+			graph.definitions[funcId] = &topStatement->functionDef;
+		} else {
+			markCalledFromStatement(&graph, &topStatement->statement);
+		}
+	}
+	while (graph.worklistCount > 0) {
+		const astFunctionDefinition* def = graph.definitions[graph.worklist[--graph.worklistCount]];
+		if (def) {
+			markCalledFromBlock(&graph, &def->body);
+		}
+	}
+
+	int count = 0;
+	for (int i = 0; i < program->count; i++) {
+		astTopLevelStatement* topStatement = &program->statements[i];
+		if (topStatement->type == AST_TOP_FUNCTION &&
+			!graph.reachable[symFuncTableFind(functionTable, topStatement->functionDef.name.name)]) {
+			astFunctionDefinitionDestroy(&topStatement->functionDef);
+		} else {
+			program->statements[count++] = *topStatement;
+		}
+	}
+	program->count = count;
+
+	free(graph.definitions);
+	free(graph.reachable);
+	free(graph.worklist);
+	return true;
+}
+
+bool expressionCanFail(const astExpression* expr) {
+	switch (expr->type) {
+		case AST_EXPR_TERM:
+			return false;
+		case AST_EXPR_UNWRAP:
+			return true;
+		case AST_EXPR_BINARY: {
+			const astExpression* rhs = expr->binary.rhs;
+			bool nonZeroLiteral = rhs->type == AST_EXPR_TERM &&
+								  ((rhs->term.type == AST_TERM_INT && rhs->term.integer.value != 0) ||
+								   (rhs->term.type == AST_TERM_DECIMAL && rhs->term.decimal.value != 0));
+			if (expr->binary.op == AST_BINARY_DIV && !nonZeroLiteral) {
+				return true;
+			}
+			return expressionCanFail(expr->binary.lhs) || expressionCanFail(rhs);
+		}
+	}
+	return true;
+}
+
+astFunctionDefinition** findFunctionDefinitions(astProgram* program, const symbolFuncTable* functionTable) {
+	astFunctionDefinition** definitions = calloc(functionTable->count, sizeof(astFunctionDefinition*));
+	if (!definitions) {
+		return NULL;
+	}
+	for (int i = 0; i < program->count; i++) {
+		if (program->statements[i].type == AST_TOP_FUNCTION) {
+			astFunctionDefinition* def = &program->statements[i].functionDef;
+			definitions[symFuncTableFind(functionTable, def->name.name)] = def;
+		}
+	}
+	return definitions;
+}
+
+bool createTemporaryName(astIdentifier* identifier, const char* prefix, int number) {
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "$%s%d", prefix, number);
+	return astIdentCreate(identifier, buffer) == 0;
+}
+
+bool optimiseProgram(astProgram* program, const symbolFuncTable* functionTable) {
+	FUNCTIONS = findFunctionDefinitions(program, functionTable);
+	if (!FUNCTIONS || !symStackCreate(&VAR_SYM_STACK)) {
+		free(FUNCTIONS);
+		return false;
+	}
+	EVALUATION_FUEL = EVALUATION_PROGRAM_FUEL;
+	bool inlined = false;
+	bool result = optimiseTopLevel(program) && inlineFunctions(program, functionTable, &inlined);
+	if (result && inlined) {
+		// copied bodies are folded with the arguments at the call sites, the definitions may have moved
+		free(FUNCTIONS);
+		FUNCTIONS = findFunctionDefinitions(program, functionTable);
+		result = FUNCTIONS && optimiseTopLevel(program);
+	}
+	symStackDestroy(&VAR_SYM_STACK);
+	free(FUNCTIONS);
+	// values are moved out of loops once folding is done, the evaluator works on the loops as written
+	result = result && hoistLoopInvariants(program, functionTable);
+	result = result && eliminateCommonSubexpressions(program, functionTable);
+
+	// folding may remove calls and uses of variables, so the call graph and liveness are computed afterwards
+	return result && removeUnreachableFunctions(program, functionTable) && removeDeadStores(program);
+}
@@ -0,0 +1,40 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef OPTIMISER_H
+#define OPTIMISER_H
+
+#include "ast.h"
+#include "symtable.h"
+
+// Optimises analysed program in place. Returns false when out of memory.
+bool optimiseProgram(astProgram*, const symbolFuncTable* functionTable);
+
+// Helpers shared by the passes
+
+// returns false from the calling function when func fails, i.e. runs out of memory
+#define OPTIMISE(func)    \
+	do {                  \
+		if (!(func)) {    \
+			return false; \
+		}                 \
+	} while (0)
+
+// Evaluation may end with a runtime error (division by zero, unwrapping nil), so it must not be removed or moved.
+bool expressionCanFail(const astExpression*);
+
+// Definitions of user functions indexed by function id, NULL for builtins. Returns NULL when out of memory.
+astFunctionDefinition** findFunctionDefinitions(astProgram*, const symbolFuncTable* functionTable);
+
+// Names a new variable $<prefix><number>, which cannot clash with names in the program. Returns false when out of
+// memory.
+bool createTemporaryName(astIdentifier*, const char* prefix, int number);
+
+#endif
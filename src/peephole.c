@@ -0,0 +1,229 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "peephole.h"
+
+// Instructions are copied one by one to the optimised code at the front of the same array. After each one the rules
+// are matched against the window at the end of the optimised code, so a rewritten sequence can take part in a match
+// with the instructions before it. Rewrites never make the code longer, so the optimised code never overtakes the
+// instructions not read yet. Windows never contain a LABEL or CALL in the middle, nothing can jump into them.
+
+#define PEEPHOLE_MAX_WINDOW 4
+
+typedef struct {
+	const char* name;
+	int length;
+	irOpcode pattern[PEEPHOLE_MAX_WINDOW];	// opcodes of the window
+	// checks operands of the window with matching opcodes and rewrites it in place, returns the new length of the
+	// window or -1 if the rule does not apply
+	int (*rewrite)(irInstruction* window);
+	long hits;
+} peepholeRule;
+
+static irInstruction instruction(irOpcode opcode, irOperand first, irOperand second, irOperand third) {
+	return (irInstruction){opcode, {first, second, third}};
+}
+
+// PUSHS x; POPS y -> MOVE y x
+static int rewritePushPop(irInstruction* window) {
+	irOperand source = window[0].operands[0];
+	irOperand destination = window[1].operands[0];
+	if (irOperandEquals(&source, &destination)) {
+		return 0;
+	}
+	window[0] = instruction(IR_MOVE, destination, source, irNone());
+	return 1;
+}
+
+// PUSHS int@n; INT2FLOATS -> PUSHS float@n
+static int rewriteLiteralConversion(irInstruction* window) {
+	if (window[0].operands[0].type != IR_OPERAND_INT) {
+		return -1;
+	}
+	window[0].operands[0] = irFloat(window[0].operands[0].integer);
+	return 1;
+}
+
+// NOTS; PUSHS bool@true; JUMPIFNEQS l -> PUSHS bool@true; JUMPIFEQS l (and the other way round)
+static int rewriteNegatedBranch(irInstruction* window) {
+	irOperand* constant = &window[1].operands[0];
+	if (constant->type != IR_OPERAND_BOOL || !constant->boolean) {
+		return -1;
+	}
+	irOpcode jump = window[2].opcode == IR_JUMPIFEQS ? IR_JUMPIFNEQS : IR_JUMPIFEQS;
+	window[0] = window[1];
+	window[1] = instruction(jump, window[2].operands[0], irNone(), irNone());
+	return 2;
+}
+
+// EQS; PUSHS bool@true; JUMPIFNEQS l -> JUMPIFNEQS l (the same for JUMPIFEQS), the operands are compared directly
+static int rewriteComparisonBranch(irInstruction* window) {
+	irOperand* constant = &window[1].operands[0];
+	if (constant->type != IR_OPERAND_BOOL || !constant->boolean) {
+		return -1;
+	}
+	window[0] = window[2];
+	return 1;
+}
+
+// PUSHS a; PUSHS b; JUMPIFEQS l -> JUMPIFEQ l a b (the same for JUMPIFNEQS)
+static int rewriteStackBranch(irInstruction* window) {
+	irOpcode jump = window[2].opcode == IR_JUMPIFEQS ? IR_JUMPIFEQ : IR_JUMPIFNEQ;
+	window[0] = instruction(jump, window[2].operands[0], window[0].operands[0], window[1].operands[0]);
+	return 1;
+}
+
+// three-address form of an instruction working with the data stack
+static irOpcode operandForm(irOpcode opcode) {
+	switch (opcode) {
+		case IR_ADDS:
+			return IR_ADD;
+		case IR_SUBS:
+			return IR_SUB;
+		case IR_MULS:
+			return IR_MUL;
+		case IR_DIVS:
+			return IR_DIV;
+		case IR_IDIVS:
+			return IR_IDIV;
+		case IR_LTS:
+			return IR_LT;
+		case IR_GTS:
+			return IR_GT;
+		case IR_EQS:
+			return IR_EQ;
+		case IR_ANDS:
+			return IR_AND;
+		case IR_ORS:
+			return IR_OR;
+		case IR_STRI2INTS:
+			return IR_STRI2INT;
+		case IR_NOTS:
+			return IR_NOT;
+		case IR_INT2FLOATS:
+			return IR_INT2FLOAT;
+		case IR_FLOAT2INTS:
+			return IR_FLOAT2INT;
+		case IR_INT2CHARS:
+			return IR_INT2CHAR;
+		default:
+			return opcode;
+	}
+}
+
+// PUSHS a; PUSHS b; ADDS; POPS y -> ADD y a b
+static int rewriteBinaryOperation(irInstruction* window) {
+	irOperand a = window[0].operands[0];
+	irOperand b = window[1].operands[0];
+	window[0] = instruction(operandForm(window[2].opcode), window[3].operands[0], a, b);
+	return 1;
+}
+
+// PUSHS a; NOTS; POPS y -> NOT y a
+static int rewriteUnaryOperation(irInstruction* window) {
+	window[0] = instruction(operandForm(window[1].opcode), window[2].operands[0], window[0].operands[0], irNone());
+	return 1;
+}
+
+// CLEARS; CLEARS -> CLEARS
+static int rewriteClears(irInstruction* window) {
+	(void)window;
+	return 1;
+}
+
+// JUMP l; LABEL l -> LABEL l
+static int rewriteJumpToNext(irInstruction* window) {
+	if (!irOperandEquals(&window[0].operands[0], &window[1].operands[0])) {
+		return -1;
+	}
+	window[0] = window[1];
+	return 1;
+}
+
+#define BINARY_OPERATION_RULE(opcode) \
+	{"stack " #opcode, 4, {IR_PUSHS, IR_PUSHS, IR_##opcode, IR_POPS}, rewriteBinaryOperation, 0}
+
+#define UNARY_OPERATION_RULE(opcode) {"stack " #opcode, 3, {IR_PUSHS, IR_##opcode, IR_POPS}, rewriteUnaryOperation, 0}
+
+static peepholeRule RULES[] = {
+	{"push pop", 2, {IR_PUSHS, IR_POPS}, rewritePushPop, 0},
+	{"literal conversion", 2, {IR_PUSHS, IR_INT2FLOATS}, rewriteLiteralConversion, 0},
+	{"negated branch", 3, {IR_NOTS, IR_PUSHS, IR_JUMPIFEQS}, rewriteNegatedBranch, 0},
+	{"negated branch", 3, {IR_NOTS, IR_PUSHS, IR_JUMPIFNEQS}, rewriteNegatedBranch, 0},
+	{"comparison branch", 3, {IR_EQS, IR_PUSHS, IR_JUMPIFEQS}, rewriteComparisonBranch, 0},
+	{"comparison branch", 3, {IR_EQS, IR_PUSHS, IR_JUMPIFNEQS}, rewriteComparisonBranch, 0},
+	{"stack branch", 3, {IR_PUSHS, IR_PUSHS, IR_JUMPIFEQS}, rewriteStackBranch, 0},
+	{"stack branch", 3, {IR_PUSHS, IR_PUSHS, IR_JUMPIFNEQS}, rewriteStackBranch, 0},
+	BINARY_OPERATION_RULE(ADDS),
+	BINARY_OPERATION_RULE(SUBS),
+	BINARY_OPERATION_RULE(MULS),
+	BINARY_OPERATION_RULE(DIVS),
+	BINARY_OPERATION_RULE(IDIVS),
+	BINARY_OPERATION_RULE(LTS),
+	BINARY_OPERATION_RULE(GTS),
+	BINARY_OPERATION_RULE(EQS),
+	BINARY_OPERATION_RULE(ANDS),
+	BINARY_OPERATION_RULE(ORS),
+	BINARY_OPERATION_RULE(STRI2INTS),
+	UNARY_OPERATION_RULE(NOTS),
+	UNARY_OPERATION_RULE(INT2FLOATS),
+	UNARY_OPERATION_RULE(FLOAT2INTS),
+	UNARY_OPERATION_RULE(INT2CHARS),
+	{"repeated clears", 2, {IR_CLEARS, IR_CLEARS}, rewriteClears, 0},
+	{"jump to next", 2, {IR_JUMP, IR_LABEL}, rewriteJumpToNext, 0},
+};
+
+#define RULE_COUNT ((int)(sizeof(RULES) / sizeof(RULES[0])))
+
+// applies the first rule matching the end of the code, returns the new length or -1 if none applies
+static int rewriteEnd(irInstruction* code, int count) {
+	for (int i = 0; i < RULE_COUNT; i++) {
+		peepholeRule* rule = &RULES[i];
+		if (rule->length > count) {
+			continue;
+		}
+		irInstruction* window = code + count - rule->length;
+		bool matches = true;
+		for (int j = rule->length - 1; j >= 0 && matches; j--) {
+			matches = window[j].opcode == rule->pattern[j];
+		}
+		if (!matches) {
+			continue;
+		}
+		int length = rule->rewrite(window);
+		if (length >= 0) {
+			rule->hits++;
+			return count - rule->length + length;
+		}
+	}
+	return -1;
+}
+
+void peepholeOptimise(irCode* code) {
+	int count = 0;	// length of the optimised code
+	for (int i = 0; i < code->count; i++) {
+		code->data[count++] = code->data[i];
+		for (int length = rewriteEnd(code->data, count); length >= 0; length = rewriteEnd(code->data, count)) {
+			count = length;
+		}
+	}
+	code->count = count;
+}
+
+void peepholePrintStatistics(FILE* output) {
+	for (int i = 0; i < RULE_COUNT; i++) {
+		const peepholeRule* rule = &RULES[i];
+		fprintf(output, "peephole %-20s", rule->name);
+		for (int j = 0; j < rule->length; j++) {
+			fprintf(output, " %s", IR_OPCODES[rule->pattern[j]].name);
+		}
+		fprintf(output, ": %ld\n", rule->hits);
+	}
+}
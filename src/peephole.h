@@ -0,0 +1,24 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include <stdio.h>
+
+#include "ir.h"
+
+// Rewrites short sequences of generated instructions to shorter equivalent ones in place.
+void peepholeOptimise(irCode* code);
+
+// prints how many times each rewrite rule was applied
+void peepholePrintStatistics(FILE* output);
+
+#endif
@@ -66,47 +66,43 @@ void printTerm(const astTerm* term, int indent) {
 		case AST_TERM_NIL:
 			puts("NIL");
 			break;
+		case AST_TERM_BOOL:
+			printf("BOOL LITERAL: %s\n", term->boolean.value ? "true" : "false");
+			break;
 	}
 }
 
-void printBinaryOperator(astBinaryOperator op, FILE* f) {
+const char* binaryOperatorName(astBinaryOperator op) {
 	switch (op) {
 		case AST_BINARY_MUL:
-			fprintf(f, "*");
-			break;
+			return "*";
 		case AST_BINARY_DIV:
-			fprintf(f, "/");
-			break;
+			return "/";
 		case AST_BINARY_PLUS:
-			fprintf(f, "+");
-			break;
+			return "+";
 		case AST_BINARY_MINUS:
-			fprintf(f, "-");
-			break;
+			return "-";
 		case AST_BINARY_EQ:
-			fprintf(f, "==");
-			break;
+			return "==";
 		case AST_BINARY_NEQ:
-			fprintf(f, "!=");
-			break;
+			return "!=";
 		case AST_BINARY_LESS:
-			fprintf(f, "<");
-			break;
+			return "<";
 		case AST_BINARY_GREATER:
-			fprintf(f, ">");
-			break;
+			return ">";
 		case AST_BINARY_LESS_EQ:
-			fprintf(f, "<=");
-			break;
+			return "<=";
 		case AST_BINARY_GREATER_EQ:
-			fprintf(f, ">=");
-			break;
+			return ">=";
 		case AST_BINARY_NIL_COAL:
-			fprintf(f, "??");
-			break;
+			return "??";
 	}
+	assert(false);
+	return "";
 }
 
+void printBinaryOperator(astBinaryOperator op, FILE* f) { fputs(binaryOperatorName(op), f); }
+
 void printExpression(const astExpression* expression, int indent);	// fwd
 
 void printBinaryExpression(const astBinaryExpression* expression, int indent) {
@@ -15,6 +15,7 @@
 
 #include "ast.h"
 
+const char* binaryOperatorName(astBinaryOperator op);
 void printBinaryOperator(astBinaryOperator op, FILE*);
 void astPrint(const astProgram*);
 
@@ -0,0 +1,270 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#include "simplifier.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "optimiser.h"
+
+// Int expressions
+//     x + 0, x - 0, x * 1, x / 1, x * 0, x - x, (x + 1) - 3, (x * 2) * 3
+// become
+//     x, x, x, x, 0, 0, x - 2, x * 6
+// and comparisons of an int or string value with itself are decided. Double operations are only removed when the
+// result is the same for every value, x + 0.0 is not x for x = -0.0 and x * 0.0 is not 0 for infinity. Operands are
+// only dropped when evaluating them cannot fail. Mixed operands are converted only when the int one is a literal,
+// those expressions are folded before, so the kept operand never needs a conversion.
+
+static long IDENTITIES;
+static long CONSTANT_RESULTS;
+static long REASSOCIATIONS;
+
+static bool isNumber(const astExpression* expr, int value) {
+	if (expr->type != AST_EXPR_TERM) {
+		return false;
+	}
+	return (expr->term.type == AST_TERM_INT && expr->term.integer.value == value) ||
+		   (expr->term.type == AST_TERM_DECIMAL && expr->term.decimal.value == value);
+}
+
+static bool isIntLiteral(const astExpression* expr) {
+	return expr->type == AST_EXPR_TERM && expr->term.type == AST_TERM_INT;
+}
+
+static bool isEmptyString(const astExpression* expr) {
+	return expr->type == AST_EXPR_TERM && expr->term.type == AST_TERM_STRING && expr->term.string.content[0] == '\0';
+}
+
+static bool equalTerms(const astTerm* a, const astTerm* b) {
+	if (a->type != b->type) {
+		return false;
+	}
+	switch (a->type) {
+		case AST_TERM_ID:
+			return strcmp(a->identifier.name, b->identifier.name) == 0;
+		case AST_TERM_INT:
+			return a->integer.value == b->integer.value;
+		case AST_TERM_DECIMAL:
+			return a->decimal.value == b->decimal.value;
+		case AST_TERM_STRING:
+			return strcmp(a->string.content, b->string.content) == 0;
+		case AST_TERM_NIL:
+			return true;
+		case AST_TERM_BOOL:
+			return a->boolean.value == b->boolean.value;
+	}
+	return false;
+}
+
+static bool equalExpressions(const astExpression* a, const astExpression* b) {
+	if (a->type != b->type) {
+		return false;
+	}
+	switch (a->type) {
+		case AST_EXPR_TERM:
+			return equalTerms(&a->term, &b->term);
+		case AST_EXPR_BINARY:
+			return a->binary.op == b->binary.op && a->binary.convertLhs == b->binary.convertLhs &&
+				   a->binary.convertRhs == b->binary.convertRhs && equalExpressions(a->binary.lhs, b->binary.lhs) &&
+				   equalExpressions(a->binary.rhs, b->binary.rhs);
+		case AST_EXPR_UNWRAP:
+			return equalExpressions(a->unwrap.innerExpr, b->unwrap.innerExpr);
+	}
+	return false;
+}
+
+// the expression is replaced by one of its operands, the other one is destroyed
+static void keepOperand(astExpression* expr, astExpression* kept) {
+	astExpression* dropped = kept == expr->binary.lhs ? expr->binary.rhs : expr->binary.lhs;
+	astExpression value = *kept;
+	astExpressionDestroy(dropped);
+	free(dropped);
+	free(kept);
+	*expr = value;
+	IDENTITIES++;
+}
+
+static void replaceByInt(astExpression* expr, int value) {
+	astExpressionDestroy(expr);
+	expr->type = AST_EXPR_TERM;
+	expr->term.type = AST_TERM_INT;
+	expr->term.integer.value = value;
+	expr->isLiteral = true;
+	CONSTANT_RESULTS++;
+}
+
+static void replaceByBool(astExpression* expr, bool value) {
+	astExpressionDestroy(expr);
+	expr->type = AST_EXPR_TERM;
+	expr->term.type = AST_TERM_BOOL;
+	expr->term.boolean.value = value;
+	expr->isLiteral = true;
+	CONSTANT_RESULTS++;
+}
+
+// int literal of a commutative operation is moved to the right
+static void literalToRight(astBinaryExpression* binary) {
+	if (isIntLiteral(binary->lhs) && !isIntLiteral(binary->rhs)) {
+		astExpression* lhs = binary->lhs;
+		binary->lhs = binary->rhs;
+		binary->rhs = lhs;
+	}
+}
+
+// (x + c1) - c2 becomes x + (c1 - c2), similarly for other additions and subtractions and for multiplications
+static void reassociate(astExpression* expr) {
+	astBinaryExpression* outer = &expr->binary;
+	if (!isIntLiteral(outer->rhs) || outer->lhs->type != AST_EXPR_BINARY) {
+		return;
+	}
+	astBinaryExpression* inner = &outer->lhs->binary;
+	if (!isIntLiteral(inner->rhs)) {
+		return;
+	}
+	bool additive = (outer->op == AST_BINARY_PLUS || outer->op == AST_BINARY_MINUS) &&
+					(inner->op == AST_BINARY_PLUS || inner->op == AST_BINARY_MINUS);
+	bool multiplicative = outer->op == AST_BINARY_MUL && inner->op == AST_BINARY_MUL;
+	if (!additive && !multiplicative) {
+		return;
+	}
+
+	long long c1 = inner->rhs->term.integer.value;
+	long long c2 = outer->rhs->term.integer.value;
+	long long value;
+	if (multiplicative) {
+		value = c1 * c2;
+	} else {
+		value = (inner->op == AST_BINARY_PLUS ? c1 : -c1) + (outer->op == AST_BINARY_PLUS ? c2 : -c2);
+	}
+	if (value <= INT_MIN || value > INT_MAX) {
+		return;	 // does not fit into the literal
+	}
+
+	astExpression* innerExpr = outer->lhs;
+	outer->lhs = inner->lhs;
+	free(inner->rhs);
+	free(innerExpr);
+	if (multiplicative) {
+		outer->op = AST_BINARY_MUL;
+	} else {
+		outer->op = value < 0 ? AST_BINARY_MINUS : AST_BINARY_PLUS;
+		value = value < 0 ? -value : value;
+	}
+	outer->rhs->term.integer.value = value;
+	REASSOCIATIONS++;
+}
+
+static void simplifyInt(astExpression* expr) {
+	astBinaryExpression* binary = &expr->binary;
+	if (binary->op == AST_BINARY_PLUS || binary->op == AST_BINARY_MUL) {
+		literalToRight(binary);
+	}
+	reassociate(expr);	// the constants may cancel out, which is left to the identities
+
+	switch (binary->op) {
+		case AST_BINARY_PLUS:
+			if (isNumber(binary->rhs, 0)) {
+				keepOperand(expr, binary->lhs);
+			}
+			break;
+		case AST_BINARY_MINUS:
+			if (isNumber(binary->rhs, 0)) {
+				keepOperand(expr, binary->lhs);
+			} else if (equalExpressions(binary->lhs, binary->rhs) && !expressionCanFail(binary->lhs)) {
+				replaceByInt(expr, 0);
+			}
+			break;
+		case AST_BINARY_MUL:
+			if (isNumber(binary->rhs, 1)) {
+				keepOperand(expr, binary->lhs);
+			} else if (isNumber(binary->rhs, 0) && !expressionCanFail(binary->lhs)) {
+				replaceByInt(expr, 0);
+			}
+			break;
+		case AST_BINARY_DIV:
+			if (isNumber(binary->rhs, 1)) {
+				keepOperand(expr, binary->lhs);
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+static void simplifyDouble(astExpression* expr) {
+	astBinaryExpression* binary = &expr->binary;
+	switch (binary->op) {
+		case AST_BINARY_MINUS:
+		case AST_BINARY_DIV:
+			if (isNumber(binary->rhs, binary->op == AST_BINARY_DIV) && !binary->convertLhs) {
+				keepOperand(expr, binary->lhs);
+			}
+			break;
+		case AST_BINARY_MUL:
+			if (isNumber(binary->rhs, 1) && !binary->convertLhs) {
+				keepOperand(expr, binary->lhs);
+			} else if (isNumber(binary->lhs, 1) && !binary->convertRhs) {
+				keepOperand(expr, binary->rhs);
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+// NaN is not equal to itself, so only ints and strings are compared
+static void simplifyComparison(astExpression* expr) {
+	astBinaryExpression* binary = &expr->binary;
+	astBasicDataType type = binary->lhs->dataType.type;
+	if ((type != AST_TYPE_INT && type != AST_TYPE_STRING) || !equalExpressions(binary->lhs, binary->rhs) ||
+		expressionCanFail(binary->lhs)) {
+		return;
+	}
+	bool reflexive = binary->op == AST_BINARY_EQ || binary->op == AST_BINARY_LESS_EQ ||
+					 binary->op == AST_BINARY_GREATER_EQ;
+	replaceByBool(expr, reflexive);
+}
+
+void simplifyExpression(astExpression* expr) {
+	if (expr->type != AST_EXPR_BINARY) {
+		return;
+	}
+	astBinaryExpression* binary = &expr->binary;
+	if (binary->op >= AST_BINARY_EQ && binary->op <= AST_BINARY_GREATER_EQ) {
+		simplifyComparison(expr);
+		return;
+	}
+	switch (expr->dataType.type) {
+		case AST_TYPE_INT:
+			simplifyInt(expr);
+			break;
+		case AST_TYPE_DOUBLE:
+			simplifyDouble(expr);
+			break;
+		case AST_TYPE_STRING:
+			if (binary->op == AST_BINARY_PLUS && isEmptyString(binary->rhs)) {
+				keepOperand(expr, binary->lhs);
+			} else if (binary->op == AST_BINARY_PLUS && isEmptyString(binary->lhs)) {
+				keepOperand(expr, binary->rhs);
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+void simplifierPrintStatistics(FILE* output) {
+	fprintf(output, "simplifier identities: %ld\n", IDENTITIES);
+	fprintf(output, "simplifier constant results: %ld\n", CONSTANT_RESULTS);
+	fprintf(output, "simplifier reassociations: %ld\n", REASSOCIATIONS);
+}
@@ -0,0 +1,24 @@
+/*
+ * Implementace překladače imperativního jazyka IFJ23
+ *
+ * Michal Havlíček (xhavli65)
+ * Adam Krška (xkrska08)
+ * Tomáš Sitarčík (xsitar06)
+ * Jan Šemora (xsemor01)
+ *
+ */
+
+#ifndef SIMPLIFIER_H
+#define SIMPLIFIER_H
+
+#include <stdio.h>
+
+#include "ast.h"
+
+// Rewrites the binary expression by algebraic identities, its operands must already be simplified.
+void simplifyExpression(astExpression*);
+
+// prints how many times each kind of rewrite was done
+void simplifierPrintStatistics(FILE* output);
+
+#endif
@@ -15,137 +15,386 @@
 #include <stdlib.h>
 #include <string.h>
 
-static int LAST_TABLE_ID = 0;
+#define SYM_STACK_INITIAL_BUCKETS 64
+#define SYM_STACK_INITIAL_SCOPES 16
 
-static int hashFunc(const char* str) {
-	int hash = 5381;
+static unsigned hashString(const char* str) {
+	unsigned hash = 5381;
 	int c;
 
 	while ((c = *(str++))) {
 		hash = hash * 33 + c;
 	}
 
-	return abs(hash) % SYM_TABLE_CAPACITY;
+	return hash;
 }
 
-void symTableCreate(symbolTable* table) {
-	for (int i = 0; i < SYM_TABLE_CAPACITY; i++) {
-		table->data[i].taken = false;
+#define SYM_FUNC_INITIAL_CAPACITY 16
+
+void symFuncTableCreate(symbolFuncTable* table) {
+	table->functions = NULL;
+	table->names = NULL;
+	table->count = 0;
+	table->capacity = 0;
+	table->index = NULL;
+	table->indexCapacity = 0;
+	table->frozen = false;
+}
+
+void symFuncTableDestroy(symbolFuncTable* table) {
+	free(table->functions);
+	for (int id = 0; id < table->count; id++) {
+		free(table->names[id]);
 	}
-	table->id = LAST_TABLE_ID++;
+	free(table->names);
+	free(table->index);
+	symFuncTableCreate(table);
 }
 
-static bool symTableInsertSlot(symbolTable* table, symbolTableSlot slot) {
-	int pos = hashFunc(slot.name);
-	const int startingPos = pos;
+// builds the hash index with given capacity (power of two) from the function names
+static bool symFuncTableBuildIndex(symbolFuncTable* table, int indexCapacity) {
+	int* index = malloc(indexCapacity * sizeof(int));
+	if (!index) {
+		return false;
+	}
+	for (int i = 0; i < indexCapacity; i++) {
+		index[i] = SYM_FUNC_NONE;
+	}
 
-	while (table->data[pos].taken) {
-		if (strcmp(table->data[pos].name, slot.name) == 0) {
-			return false;  // redefinition
-		}
-		pos++;
-		pos %= SYM_TABLE_CAPACITY;
-		if (pos == startingPos) {
-			// already searched the full table
-			return false;
+	for (int id = 0; id < table->count; id++) {
+		unsigned pos = hashString(table->names[id]) & (indexCapacity - 1);
+		while (index[pos] != SYM_FUNC_NONE) {
+			pos = (pos + 1) & (indexCapacity - 1);
 		}
+		index[pos] = id;
 	}
 
-	table->data[pos] = slot;
+	free(table->index);
+	table->index = index;
+	table->indexCapacity = indexCapacity;
 	return true;
 }
 
-bool symTableInsertVar(symbolTable* table, symbolVariable var, const char* name, bool valid) {
-	symbolTableSlot slot;
-	slot.variable = var;
-	slot.name = name;
-	slot.taken = true;
-	slot.valid = valid;
-	return symTableInsertSlot(table, slot);
+int symFuncTableInsert(symbolFuncTable* table, symbolFunc func, const char* name) {
+	assert(!table->frozen);
+	if (symFuncTableFind(table, name) != SYM_FUNC_NONE) {
+		return SYM_FUNC_NONE;  // redefinition
+	}
+
+	if (table->count == table->capacity) {
+		int newCapacity = table->capacity ? table->capacity * 2 : SYM_FUNC_INITIAL_CAPACITY;
+		symbolFunc* newFunctions = realloc(table->functions, newCapacity * sizeof(symbolFunc));
+		if (!newFunctions) {
+			return SYM_FUNC_NONE;
+		}
+		table->functions = newFunctions;
+		char** newNames = realloc(table->names, newCapacity * sizeof(char*));
+		if (!newNames) {
+			return SYM_FUNC_NONE;
+		}
+		table->names = newNames;
+		table->capacity = newCapacity;
+	}
+
+	// the definition may be removed by the optimiser while the table is still searched
+	size_t length = strlen(name);
+	char* nameCopy = malloc(length + 1);
+	if (!nameCopy) {
+		return SYM_FUNC_NONE;
+	}
+	memcpy(nameCopy, name, length + 1);
+
+	int id = table->count++;
+	table->functions[id] = func;
+	table->names[id] = nameCopy;
+
+	// keep the index at most half full
+	if (table->count * 2 > table->indexCapacity) {
+		int indexCapacity = table->indexCapacity ? table->indexCapacity * 2 : SYM_FUNC_INITIAL_CAPACITY;
+		if (!symFuncTableBuildIndex(table, indexCapacity)) {
+			free(nameCopy);
+			table->count--;
+			return SYM_FUNC_NONE;
+		}
+	} else {
+		unsigned pos = hashString(name) & (table->indexCapacity - 1);
+		while (table->index[pos] != SYM_FUNC_NONE) {
+			pos = (pos + 1) & (table->indexCapacity - 1);
+		}
+		table->index[pos] = id;
+	}
+
+	return id;
 }
 
-bool symTableInsertFunc(symbolTable* table, symbolFunc func, const char* name) {
-	symbolTableSlot slot;
-	slot.function = func;
-	slot.name = name;
-	slot.taken = true;
-	slot.valid = true;
-	return symTableInsertSlot(table, slot);
+bool symFuncTableFreeze(symbolFuncTable* table) {
+	assert(!table->frozen);
+	table->frozen = true;
+	if (table->count == 0) {
+		return true;
+	}
+
+	// shrink arrays to the exact size
+	symbolFunc* functions = realloc(table->functions, table->count * sizeof(symbolFunc));
+	if (functions) {
+		table->functions = functions;
+	}
+	char** names = realloc(table->names, table->count * sizeof(char*));
+	if (names) {
+		table->names = names;
+	}
+	table->capacity = table->count;
+
+	// rebuild the index with the smallest power of two capacity with load factor at most 1/2
+	int indexCapacity = SYM_FUNC_INITIAL_CAPACITY;
+	while (indexCapacity < table->count * 2) {
+		indexCapacity *= 2;
+	}
+	return symFuncTableBuildIndex(table, indexCapacity);
 }
 
-symbolTableSlot* symTableLookup(symbolTable* table, const char* name) {
-	int pos = hashFunc(name);
-	const int startingPos = pos;
+int symFuncTableFind(const symbolFuncTable* table, const char* name) {
+	if (table->indexCapacity == 0) {
+		return SYM_FUNC_NONE;
+	}
 
-	while (true) {
-		if (table->data[pos].taken == false) {
-			return NULL;
+	unsigned pos = hashString(name) & (table->indexCapacity - 1);
+	while (table->index[pos] != SYM_FUNC_NONE) {
+		int id = table->index[pos];
+		if (strcmp(table->names[id], name) == 0) {
+			return id;
 		}
+		pos = (pos + 1) & (table->indexCapacity - 1);
+	}
+
+	return SYM_FUNC_NONE;
+}
+
+const symbolFunc* symFuncTableGet(const symbolFuncTable* table, int id) {
+	assert(id >= 0 && id < table->count);
+	return &table->functions[id];
+}
 
-		if (strcmp(table->data[pos].name, name) == 0) {
-			return &table->data[pos];
+bool symStackCreate(symbolTableStack* stack) {
+	stack->count = 0;
+	stack->capacity = 0;
+	stack->scopes = NULL;
+	stack->lastScopeId = 0;
+	stack->freeBindings = NULL;
+	stack->nameCount = 0;
+	stack->bucketCount = SYM_STACK_INITIAL_BUCKETS;
+	stack->buckets = calloc(stack->bucketCount, sizeof(symbolName*));
+	return stack->buckets != NULL;
+}
+
+void symStackDestroy(symbolTableStack* stack) {
+	while (stack->count > 0) {
+		symStackPop(stack);
+	}
+
+	for (int i = 0; i < stack->capacity; i++) {
+		free(stack->scopes[i]);
+	}
+	free(stack->scopes);
+	stack->scopes = NULL;
+	stack->capacity = 0;
+
+	while (stack->freeBindings) {
+		symbolBinding* next = stack->freeBindings->initNext;
+		free(stack->freeBindings);
+		stack->freeBindings = next;
+	}
+
+	for (int i = 0; i < stack->bucketCount; i++) {
+		symbolName* name = stack->buckets[i];
+		while (name) {
+			symbolName* next = name->next;
+			free(name);
+			name = next;
 		}
+	}
 
-		pos++;
-		pos %= SYM_TABLE_CAPACITY;
-		if (pos == startingPos) {
-			// already searched the whole table
-			return NULL;
+	free(stack->buckets);
+	stack->buckets = NULL;
+	stack->bucketCount = 0;
+	stack->nameCount = 0;
+}
+
+// doubles the number of buckets, names keep their addresses
+static bool symStackRehash(symbolTableStack* stack) {
+	int newCount = stack->bucketCount * 2;
+	symbolName** newBuckets = calloc(newCount, sizeof(symbolName*));
+	if (!newBuckets) {
+		return false;
+	}
+
+	for (int i = 0; i < stack->bucketCount; i++) {
+		symbolName* name = stack->buckets[i];
+		while (name) {
+			symbolName* next = name->next;
+			unsigned pos = hashString(name->name) & (newCount - 1);
+			name->next = newBuckets[pos];
+			newBuckets[pos] = name;
+			name = next;
 		}
 	}
 
-	return NULL;
+	free(stack->buckets);
+	stack->buckets = newBuckets;
+	stack->bucketCount = newCount;
+	return true;
 }
 
-void symStackCreate(symbolTableStack* stack) { stack->count = 0; }
+static symbolName* symStackFindName(symbolTableStack* stack, const char* name) {
+	symbolName* entry = stack->buckets[hashString(name) & (stack->bucketCount - 1)];
+	while (entry && strcmp(entry->name, name) != 0) {
+		entry = entry->next;
+	}
+	return entry;
+}
 
-void symStackPush(symbolTableStack* stack) { symTableCreate(&(stack->tables[stack->count++])); }
+// finds the shadow chain of given name, creates a new one if it does not exist yet
+static symbolName* symStackFindOrAddName(symbolTableStack* stack, const char* name) {
+	symbolName* entry = symStackFindName(stack, name);
+	if (entry) {
+		return entry;
+	}
+
+	if (stack->nameCount >= stack->bucketCount && !symStackRehash(stack)) {
+		return NULL;
+	}
+
+	size_t length = strlen(name);
+	entry = malloc(sizeof(symbolName) + length + 1);
+	if (!entry) {
+		return NULL;
+	}
+
+	unsigned pos = hashString(name) & (stack->bucketCount - 1);
+	memcpy(entry->name, name, length + 1);
+	entry->top = NULL;
+	entry->next = stack->buckets[pos];
+	stack->buckets[pos] = entry;
+	stack->nameCount++;
+	return entry;
+}
+
+bool symStackPush(symbolTableStack* stack) {
+	if (stack->count == stack->capacity) {
+		int newCapacity = stack->capacity ? stack->capacity * 2 : SYM_STACK_INITIAL_SCOPES;
+		symbolScope** newScopes = realloc(stack->scopes, newCapacity * sizeof(symbolScope*));
+		if (!newScopes) {
+			return false;
+		}
+		stack->scopes = newScopes;
+		for (int i = stack->capacity; i < newCapacity; i++) {
+			stack->scopes[i] = NULL;
+		}
+		stack->capacity = newCapacity;
+	}
+
+	// scopes are allocated lazily and never moved, so pointers to them stay valid
+	if (!stack->scopes[stack->count]) {
+		stack->scopes[stack->count] = malloc(sizeof(symbolScope));
+		if (!stack->scopes[stack->count]) {
+			return false;
+		}
+	}
+
+	symbolScope* scope = stack->scopes[stack->count++];
+	scope->id = stack->lastScopeId++;
+	scope->bindings = NULL;
+	scope->initialised = NULL;
+	return true;
+}
 
 void symStackPop(symbolTableStack* stack) {
-	// TODO - destroy symbol table if it contains allocated memory
+	symbolScope* scope = symStackCurrentScope(stack);
+
+	// uninitialise variables initialised in this scope
+	for (symbolBinding* binding = scope->initialised; binding; binding = binding->initNext) {
+		binding->slot.variable.initialisedInScope = NULL;
+	}
+
+	// unlink bindings introduced by this scope from their shadow chains
+	symbolBinding* binding = scope->bindings;
+	while (binding) {
+		symbolBinding* next = binding->scopeNext;
+		binding->name->top = binding->shadowed;
+		binding->initNext = stack->freeBindings;
+		stack->freeBindings = binding;
+		binding = next;
+	}
+
 	stack->count--;
 }
 
-symbolTable* symStackCurrentScope(symbolTableStack* stack) {
-	assert(stack->count >= 0);
-	return &(stack->tables[stack->count - 1]);
+symbolScope* symStackCurrentScope(symbolTableStack* stack) {
+	assert(stack->count > 0);
+	return stack->scopes[stack->count - 1];
 }
 
-symbolTable* symStackGlobalScope(symbolTableStack* stack) {
-	assert(stack->count >= 0);
-	return &(stack->tables[0]);
+symbolScope* symStackGlobalScope(symbolTableStack* stack) {
+	assert(stack->count > 0);
+	return stack->scopes[0];
 }
 
-symbolTableSlot* symStackLookup(symbolTableStack* stack, const char* name, symbolTable** tablePtr) {
-	for (int i = stack->count - 1; i >= 0; i--) {
-		symbolTableSlot* slot = symTableLookup(&stack->tables[i], name);
-		if (slot && slot->valid) {
-			if (tablePtr) {
-				*tablePtr = &stack->tables[i];
-			}
-			return slot;
-		}
+bool symStackInsertVar(symbolTableStack* stack, symbolVariable var, const char* name) {
+	symbolScope* scope = symStackCurrentScope(stack);
+	symbolName* entry = symStackFindOrAddName(stack, name);
+	if (!entry) {
+		return false;
 	}
 
-	return NULL;
-}
+	if (entry->top && entry->top->scope == scope) {
+		return false;  // redefinition
+	}
 
-void symStackValidate(symbolTableStack* stack, const char* name) {
-	for (int i = stack->count - 1; i >= 0; i--) {
-		symbolTableSlot* slot = symTableLookup(&stack->tables[i], name);
-		if (slot) {
-			slot->valid = true;
-			return;
+	symbolBinding* binding = stack->freeBindings;
+	if (binding) {
+		stack->freeBindings = binding->initNext;
+	} else {
+		binding = malloc(sizeof(symbolBinding));
+		if (!binding) {
+			return false;
 		}
 	}
 
-	assert(false);
+	binding->slot.variable = var;
+	binding->slot.name = name;
+	binding->scope = scope;
+	binding->name = entry;
+	binding->shadowed = entry->top;
+	binding->scopeNext = scope->bindings;
+	binding->initNext = NULL;
+	entry->top = binding;
+	scope->bindings = binding;
+	return true;
 }
 
-void symStackSetVarType(symbolTableStack* stack, const char* name, astDataType type) {
-	symbolTableSlot* slot = symStackLookup(stack, name, NULL);
-	assert(slot);
-	slot->variable.type = type;
+symbolTableSlot* symStackLookup(symbolTableStack* stack, const char* name, symbolScope** scopePtr) {
+	symbolName* entry = symStackFindName(stack, name);
+	if (!entry) {
+		return NULL;
+	}
+
+	symbolBinding* binding = entry->top;
+	if (!binding) {
+		return NULL;
+	}
+	if (scopePtr) {
+		*scopePtr = binding->scope;
+	}
+	return &binding->slot;
 }
 
-// void symTableDestroy(symbolTable*);
+void symStackInitialiseVar(symbolTableStack* stack, symbolTableSlot* slot) {
+	symbolBinding* binding = (symbolBinding*)slot;
+	symbolScope* scope = symStackCurrentScope(stack);
+	slot->variable.initialisedInScope = scope;
+	if (binding->scope != scope) {
+		// bindings of the current scope are removed on pop anyway
+		binding->initNext = scope->initialised;
+		scope->initialised = binding;
+	}
+}
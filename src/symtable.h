@@ -13,15 +13,14 @@
 
 #include "ast.h"
 
-#define SYM_TABLE_CAPACITY 2048
-
-typedef struct symbolTable symbolTable;	 // fwd
+typedef struct symbolScope symbolScope;	 // fwd
 
 // Slot for variables
 typedef struct {
 	astDataType type;
 	bool immutable;
-	symbolTable* initialisedInScope;
+	symbolScope* initialisedInScope;
+	const astTerm* constant;  // value of constant variable, used by optimiser
 } symbolVariable;
 
 // Slot for functions
@@ -32,36 +31,84 @@ typedef struct {
 
 typedef struct {
 	const char* name;  // non-owning
-	bool taken;
-	union {
-		symbolVariable variable;
-		symbolFunc function;
-	};
-	bool valid;	 // used in codegen for variable predefinitions
+	symbolVariable variable;
 } symbolTableSlot;
 
-struct symbolTable {
-	symbolTableSlot data[SYM_TABLE_CAPACITY];  // TODO - make dynamic?
+#define SYM_FUNC_NONE (-1)
+
+// Function table. Functions get dense ids in order of registration.
+// After the registration pass the table is frozen into exactly sized arrays, call sites are then resolved to ids once
+// and all further accesses are plain array indexing.
+typedef struct {
+	symbolFunc* functions;	// indexed by id
+	char** names;			// indexed by id
+	int count;
+	int capacity;
+	int* index;	 // open addressing hash table of ids, SYM_FUNC_NONE = empty
+	int indexCapacity;
+	bool frozen;
+} symbolFuncTable;
+
+typedef struct symbolName symbolName;  // fwd
+
+// One variable binding introduced by a scope
+typedef struct symbolBinding {
+	symbolTableSlot slot;  // must be first, slots returned by lookups point here
+	symbolScope* scope;
+	symbolName* name;
+	struct symbolBinding* shadowed;	  // binding of the same name in an outer scope
+	struct symbolBinding* scopeNext;  // next binding introduced by the same scope
+	struct symbolBinding* initNext;	  // next outer binding initialised in the same scope, also used by the free list
+} symbolBinding;
+
+// Shadow chain of all bindings of one name, innermost first
+// The name is copied, as the chain outlives the bindings and the AST nodes they were created from may be freed.
+struct symbolName {
+	symbolBinding* top;
+	symbolName* next;  // next name in the same hash bucket
+	char name[];
+};
+
+struct symbolScope {
 	int id;
+	symbolBinding* bindings;	 // bindings introduced in this scope
+	symbolBinding* initialised;	 // bindings of outer scopes initialised in this scope
 };
 
+// Scoped symbol table for variables - lookup is a single hash probe regardless of nesting depth
 typedef struct {
-	symbolTable tables[256];  // TODO - make dynamic?
+	symbolScope** scopes;  // popped scopes stay allocated and are reused by the next push at the same depth
 	int count;
+	int capacity;
+	int lastScopeId;
+	symbolBinding* freeBindings;  // bindings of popped scopes, reused by later insertions
+	symbolName** buckets;
+	int bucketCount;
+	int nameCount;
 } symbolTableStack;
 
-void symTableCreate(symbolTable*);
-bool symTableInsertVar(symbolTable*, symbolVariable, const char* name, bool valid);
-bool symTableInsertFunc(symbolTable*, symbolFunc, const char* name);
-symbolTableSlot* symTableLookup(symbolTable*, const char* name);
+void symFuncTableCreate(symbolFuncTable*);
+void symFuncTableDestroy(symbolFuncTable*);
+// Returns id of the new function, SYM_FUNC_NONE on redefinition or allocation failure
+int symFuncTableInsert(symbolFuncTable*, symbolFunc, const char* name);
+// Returns false on allocation failure
+bool symFuncTableFreeze(symbolFuncTable*);
+// Returns SYM_FUNC_NONE if there is no such function
+int symFuncTableFind(const symbolFuncTable*, const char* name);
+const symbolFunc* symFuncTableGet(const symbolFuncTable*, int id);
 
-void symStackCreate(symbolTableStack*);
-void symStackPush(symbolTableStack*);
+// Returns false on allocation failure
+bool symStackCreate(symbolTableStack*);
+void symStackDestroy(symbolTableStack*);
+// Returns false on allocation failure
+bool symStackPush(symbolTableStack*);
+// Removes all bindings of the current scope and uninitialises variables initialised in it
 void symStackPop(symbolTableStack*);
-symbolTable* symStackCurrentScope(symbolTableStack*);
-symbolTable* symStackGlobalScope(symbolTableStack*);
-symbolTableSlot* symStackLookup(symbolTableStack*, const char* name, symbolTable** tablePtr);
-void symStackValidate(symbolTableStack*, const char* name);	 // validate slot in symstack
-void symStackSetVarType(symbolTableStack*, const char* name, astDataType type);
+symbolScope* symStackCurrentScope(symbolTableStack*);
+symbolScope* symStackGlobalScope(symbolTableStack*);
+// Inserts variable into the current scope. Returns false on redefinition or allocation failure.
+bool symStackInsertVar(symbolTableStack*, symbolVariable, const char* name);
+symbolTableSlot* symStackLookup(symbolTableStack*, const char* name, symbolScope** scopePtr);
+void symStackInitialiseVar(symbolTableStack*, symbolTableSlot*);  // mark variable as initialised in current scope
 
 #endif
@@ -0,0 +1,31 @@
+#!/bin/bash
+
+# Compares stack code with three-address code (-ftemporaries) on the test inputs.
+# For every program that compiles prints the number of generated instructions and the interpreter run time
+# of both modes.
+# arguments: additional compiler flags (e.g. -O0)
+
+compilerPath="../bin/compiler"
+
+# arguments:
+# 1. input file
+# 2. compiler flags
+# prints instruction count and run time in seconds
+measure () {
+	if ! bash -c "$compilerPath $2 < $1 > tmp_bench.txt 2> /dev/null"; then
+		return 1
+	fi
+	instructions=$(grep -cv '^\(\.IFJcode23\|LABEL .*\)$' tmp_bench.txt)
+	start=$(date +%s.%N)
+	ic23int tmp_bench.txt > /dev/null 2>&1 < /dev/null
+	end=$(date +%s.%N)
+	printf "%6d %8.3f" $instructions $(awk "BEGIN {print $end - $start}")
+}
+
+printf "%-40s %15s %15s\n" "" "stack" "temporaries"
+for file in input/*.swift; do
+	stack=$(measure $file "$*") || continue
+	temporaries=$(measure $file "$* -ftemporaries") || continue
+	printf "%-40s %s %s\n" $(basename $file) "$stack" "$temporaries"
+done
+rm -f tmp_bench.txt
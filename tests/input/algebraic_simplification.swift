@@ -0,0 +1,54 @@
+// identities and reassociated constants
+
+let t0 = readInt()
+let x = t0 ?? 7
+let t1 = readDouble()
+let d = t1 ?? 2.5
+let t2 = readString()
+let s = t2 ?? "abc"
+
+let i1 = x + 0
+let i2 = 0 + x
+let i3 = x - 0
+let i4 = x * 1
+let i5 = 1 * x
+let i6 = x / 1
+write(i1, " ", i2, " ", i3, " ", i4, " ", i5, " ", i6, "\n")
+
+let z1 = x * 0
+let z2 = 0 * x
+let z3 = x - x
+write(z1, " ", z2, " ", z3, "\n")
+
+let r1 = (x + 1) - 3
+let r2 = (x + 5) - 5
+let r3 = 2 + (x + 3)
+let r4 = (x * 2) * 3
+let r5 = (x - 4) - 6
+let r6 = x * 2
+let r7 = 2 * x + 1
+write(r1, " ", r2, " ", r3, " ", r4, " ", r5, " ", r6, " ", r7, "\n")
+
+let d1 = d * 1
+let d2 = d - 0
+let d3 = d / 1
+let d4 = 1.0 * d
+write(d1, " ", d2, " ", d3, " ", d4, "\n")
+
+let s1 = s + ""
+let s2 = "" + s
+write(s1, " ", s2, "\n")
+
+if x == x {
+	write("equal\n")
+}
+if s < s {
+	write("less\n")
+} else {
+	write("not less\n")
+}
+var n = 0
+while x != x {
+	n = n + 1
+}
+write(n, "\n")
@@ -0,0 +1,3 @@
+let s = "abc"
+length(s)
+write("ok")
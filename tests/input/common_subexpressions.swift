@@ -0,0 +1,74 @@
+// values computed again in straight-line code are reused
+
+var g = 5
+
+func bump() {
+	g = g + 1
+}
+
+func square(_ v: Int) -> Int {
+	return v * v
+}
+
+func area(width w: Int, height h: Int) -> Int {
+	let inner = (w - 2) * (h - 2)
+	let outer = w * h
+	return outer - (w - 2) * (h - 2) + inner
+}
+
+let t0 = readString()
+let s = t0 ?? "text"
+let t1 = readInt()
+var a = t1 ?? 3
+let t2 = readInt()
+let b = t2 ?? 4
+
+// repeated in one expression and in later statements
+let x = a * b + a * b
+let y = a * b
+let l1 = length(s)
+let l2 = length(s)
+write(x, " ", y, " ", l1, " ", l2, "\n")
+
+// the variable holding the value is assigned
+var h = a * b + 1
+h = 0
+let k = a * b + 1
+write(h, " ", k, "\n")
+
+// an operand is assigned
+a = a + 1
+let m = a * b
+let m2 = a * b
+write(m, " ", m2, "\n")
+
+// a function changes a global variable between the uses
+let p = g * 2
+bump()
+let q = g * 2
+write(p, " ", q, "\n")
+
+// pure function called twice with the same argument
+let s1 = square(b)
+let s2 = square(b)
+let r = area(width: a, height: b)
+write(s1, " ", s2, " ", r, "\n")
+
+// substrings and the condition
+let c1 = substring(of: s, startingAt: 1, endingBefore: 3)
+let c2 = substring(of: s, startingAt: 1, endingBefore: 3)
+if a * b > 20 {
+	let a = 100
+	let n = a * b
+	write(c1, c2, " ", n, "\n")
+} else {
+	let e = a * b
+	write(c1, " ", e, "\n")
+}
+
+// the divisor may be zero, the division is still done once
+let z0 = readInt()
+let z = z0 ?? 1
+let d1 = b / z
+let d2 = b / z + b / z
+write(d1, " ", d2, "\n")
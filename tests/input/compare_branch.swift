@@ -0,0 +1,37 @@
+func below(_ a: Int, _ b: Int) -> Int {
+    if a <= b {
+        return 1
+    }
+    return 0
+}
+
+var i = 0
+var d = 0.5
+var maybe: Int? = nil
+while i <= 5 {
+    if i >= 3 {
+        write("ge ")
+    } else {
+        write("lt ")
+    }
+    if i != 2 {
+        write(i, " ")
+    }
+    if d > 2 {
+        write("big ")
+    }
+    if let maybe {
+        write(maybe, " ")
+    }
+    maybe = i
+    d = d + 1.0
+    i = i + 1
+}
+let x = below(i, 6)
+let y = below(7, i)
+if x == 1 {
+    write("x ")
+}
+if 1 == 1 {
+    write("t\n")
+}
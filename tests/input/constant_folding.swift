@@ -0,0 +1,50 @@
+let a = 2 + 3 * 4
+let b: Double = 7
+let c = a + 1
+let s = "ab" + "cd"
+let n: Int? = nil
+let m: Int? = 4
+var x = 0
+while x < a {
+	x = x + 1
+	let k = c - 2
+	if a > 10 {
+		write(k, "\n")
+	} else {
+		write("never\n")
+	}
+}
+let bh = b / 2.0
+let d = 7 / 2
+let s2 = s + "!"
+write(x, " ", bh, " ", d, " ", s2, "\n")
+if let m {
+	write("m=", m, "\n")
+}
+if let n {
+	write("n\n")
+} else {
+	write("no n\n")
+}
+let e1 = n ?? 9
+let e2 = m ?? 9
+let e3 = 1.5 + 2
+let e4 = 0 - 7 / 2
+let e5 = (0 - 7) / 2
+write(e1, " ", e2, " ", e3, " ", e4, "\n")
+func f(_ a: Int) -> Int {
+	let q = a * 2
+	return q + c
+}
+let r = f(1)
+write(r, "\n")
+if 1 == 2 {
+	write("dead\n")
+}
+while 1 > 2 {
+	write("dead\n")
+}
+if "a" < "b" {
+	write("lt\n")
+}
+let big = 2147483647 + 1
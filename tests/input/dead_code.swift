@@ -0,0 +1,33 @@
+func unused(_ a: Int) -> Int {
+	let h = helper(a)
+	return h
+}
+func helper(_ a: Int) -> Int {
+	return a + 1
+}
+func used(_ a: Int) -> Int {
+	if a > 0 {
+		return a
+	} else {
+		return 0 - a
+	}
+	write("after if-else return\n")
+	return 1
+}
+func rec(_ n: Int) -> Int {
+	if n == 0 {
+		return 0
+	}
+	let m = n - 1
+	let r = rec(m)
+	return r + 1
+}
+func proc() {
+	write("proc\n")
+	return
+}
+let y = 0 - 5
+var x = used(y)
+x = rec(3)
+proc()
+write(x, "\n")
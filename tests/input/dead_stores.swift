@@ -0,0 +1,40 @@
+func sideEffect(_ x: Int) -> Int {
+    write("called ", x, "\n")
+    return x
+}
+
+func f(_ n: Int) -> Int {
+    var unused: Int?
+    var later: String?
+    var acc = 0
+    acc = 5
+    let r = sideEffect(n)
+    var i = 0
+    while i < n {
+        var fresh: Int?
+        if i == 1 {
+            fresh = i
+        } else {}
+        write(fresh, " ")
+        var tmp = i * 2
+        tmp = i * 3
+        acc = acc + tmp
+        i = i + 1
+    }
+    later = "x"
+    write(later, "\n")
+    var ignored = 0
+    ignored = sideEffect(7)
+    return acc
+}
+
+let res = f(3)
+write(res, "\n")
+if res > 0 {
+    var inner: Double?
+    inner = 1.5
+    var dead = 3
+    dead = 4
+    write(inner, "\n")
+} else {}
+write("end\n")
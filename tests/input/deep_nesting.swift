@@ -0,0 +1,904 @@
+// 300 nested blocks, each one shadowing x
+var x = 0
+if x == 0 {
+	let x = 1
+	if x == 1 {
+		let x = 2
+		if x == 2 {
+			let x = 3
+			if x == 3 {
+				let x = 4
+				if x == 4 {
+					let x = 5
+					if x == 5 {
+						let x = 6
+						if x == 6 {
+							let x = 7
+							if x == 7 {
+								let x = 8
+								if x == 8 {
+									let x = 9
+									if x == 9 {
+										let x = 10
+										if x == 10 {
+											let x = 11
+											if x == 11 {
+												let x = 12
+												if x == 12 {
+													let x = 13
+													if x == 13 {
+														let x = 14
+														if x == 14 {
+															let x = 15
+															if x == 15 {
+																let x = 16
+																if x == 16 {
+																	let x = 17
+																	if x == 17 {
+																		let x = 18
+																		if x == 18 {
+																			let x = 19
+																			if x == 19 {
+																				let x = 20
+																				if x == 20 {
+																					let x = 21
+																					if x == 21 {
+																						let x = 22
+																						if x == 22 {
+																							let x = 23
+																							if x == 23 {
+																								let x = 24
+																								if x == 24 {
+																									let x = 25
+																									if x == 25 {
+																										let x = 26
+																										if x == 26 {
+																											let x = 27
+																											if x == 27 {
+																												let x = 28
+																												if x == 28 {
+																													let x = 29
+																													if x == 29 {
+																														let x = 30
+																														if x == 30 {
+																															let x = 31
+																															if x == 31 {
+																																let x = 32
+																																if x == 32 {
+																																	let x = 33
+																																	if x == 33 {
+																																		let x = 34
+																																		if x == 34 {
+																																			let x = 35
+																																			if x == 35 {
+																																				let x = 36
+																																				if x == 36 {
+																																					let x = 37
+																																					if x == 37 {
+																																						let x = 38
+																																						if x == 38 {
+																																							let x = 39
+																																							if x == 39 {
+																																								let x = 40
+																																								if x == 40 {
+																																									let x = 41
+																																									if x == 41 {
+																																										let x = 42
+																																										if x == 42 {
+																																											let x = 43
+																																											if x == 43 {
+																																												let x = 44
+																																												if x == 44 {
+																																													let x = 45
+																																													if x == 45 {
+																																														let x = 46
+																																														if x == 46 {
+																																															let x = 47
+																																															if x == 47 {
+																																																let x = 48
+																																																if x == 48 {
+																																																	let x = 49
+																																																	if x == 49 {
+																																																		let x = 50
+																																																		if x == 50 {
+																																																			let x = 51
+																																																			if x == 51 {
+																																																				let x = 52
+																																																				if x == 52 {
+																																																					let x = 53
+																																																					if x == 53 {
+																																																						let x = 54
+																																																						if x == 54 {
+																																																							let x = 55
+																																																							if x == 55 {
+																																																								let x = 56
+																																																								if x == 56 {
+																																																									let x = 57
+																																																									if x == 57 {
+																																																										let x = 58
+																																																										if x == 58 {
+																																																											let x = 59
+																																																											if x == 59 {
+																																																												let x = 60
+																																																												if x == 60 {
+																																																													let x = 61
+																																																													if x == 61 {
+																																																														let x = 62
+																																																														if x == 62 {
+																																																															let x = 63
+																																																															if x == 63 {
+																																																																let x = 64
+																																																																if x == 64 {
+																																																																	let x = 65
+																																																																	if x == 65 {
+																																																																		let x = 66
+																																																																		if x == 66 {
+																																																																			let x = 67
+																																																																			if x == 67 {
+																																																																				let x = 68
+																																																																				if x == 68 {
+																																																																					let x = 69
+																																																																					if x == 69 {
+																																																																						let x = 70
+																																																																						if x == 70 {
+																																																																							let x = 71
+																																																																							if x == 71 {
+																																																																								let x = 72
+																																																																								if x == 72 {
+																																																																									let x = 73
+																																																																									if x == 73 {
+																																																																										let x = 74
+																																																																										if x == 74 {
+																																																																											let x = 75
+																																																																											if x == 75 {
+																																																																												let x = 76
+																																																																												if x == 76 {
+																																																																													let x = 77
+																																																																													if x == 77 {
+																																																																														let x = 78
+																																																																														if x == 78 {
+																																																																															let x = 79
+																																																																															if x == 79 {
+																																																																																let x = 80
+																																																																																if x == 80 {
+																																																																																	let x = 81
+																																																																																	if x == 81 {
+																																																																																		let x = 82
+																																																																																		if x == 82 {
+																																																																																			let x = 83
+																																																																																			if x == 83 {
+																																																																																				let x = 84
+																																																																																				if x == 84 {
+																																																																																					let x = 85
+																																																																																					if x == 85 {
+																																																																																						let x = 86
+																																																																																						if x == 86 {
+																																																																																							let x = 87
+																																																																																							if x == 87 {
+																																																																																								let x = 88
+																																																																																								if x == 88 {
+																																																																																									let x = 89
+																																																																																									if x == 89 {
+																																																																																										let x = 90
+																																																																																										if x == 90 {
+																																																																																											let x = 91
+																																																																																											if x == 91 {
+																																																																																												let x = 92
+																																																																																												if x == 92 {
+																																																																																													let x = 93
+																																																																																													if x == 93 {
+																																																																																														let x = 94
+																																																																																														if x == 94 {
+																																																																																															let x = 95
+																																																																																															if x == 95 {
+																																																																																																let x = 96
+																																																																																																if x == 96 {
+																																																																																																	let x = 97
+																																																																																																	if x == 97 {
+																																																																																																		let x = 98
+																																																																																																		if x == 98 {
+																																																																																																			let x = 99
+																																																																																																			if x == 99 {
+																																																																																																				let x = 100
+																																																																																																				if x == 100 {
+																																																																																																					let x = 101
+																																																																																																					if x == 101 {
+																																																																																																						let x = 102
+																																																																																																						if x == 102 {
+																																																																																																							let x = 103
+																																																																																																							if x == 103 {
+																																																																																																								let x = 104
+																																																																																																								if x == 104 {
+																																																																																																									let x = 105
+																																																																																																									if x == 105 {
+																																																																																																										let x = 106
+																																																																																																										if x == 106 {
+																																																																																																											let x = 107
+																																																																																																											if x == 107 {
+																																																																																																												let x = 108
+																																																																																																												if x == 108 {
+																																																																																																													let x = 109
+																																																																																																													if x == 109 {
+																																																																																																														let x = 110
+																																																																																																														if x == 110 {
+																																																																																																															let x = 111
+																																																																																																															if x == 111 {
+																																																																																																																let x = 112
+																																																																																																																if x == 112 {
+																																																																																																																	let x = 113
+																																																																																																																	if x == 113 {
+																																																																																																																		let x = 114
+																																																																																																																		if x == 114 {
+																																																																																																																			let x = 115
+																																																																																																																			if x == 115 {
+																																																																																																																				let x = 116
+																																																																																																																				if x == 116 {
+																																																																																																																					let x = 117
+																																																																																																																					if x == 117 {
+																																																																																																																						let x = 118
+																																																																																																																						if x == 118 {
+																																																																																																																							let x = 119
+																																																																																																																							if x == 119 {
+																																																																																																																								let x = 120
+																																																																																																																								if x == 120 {
+																																																																																																																									let x = 121
+																																																																																																																									if x == 121 {
+																																																																																																																										let x = 122
+																																																																																																																										if x == 122 {
+																																																																																																																											let x = 123
+																																																																																																																											if x == 123 {
+																																																																																																																												let x = 124
+																																																																																																																												if x == 124 {
+																																																																																																																													let x = 125
+																																																																																																																													if x == 125 {
+																																																																																																																														let x = 126
+																																																																																																																														if x == 126 {
+																																																																																																																															let x = 127
+																																																																																																																															if x == 127 {
+																																																																																																																																let x = 128
+																																																																																																																																if x == 128 {
+																																																																																																																																	let x = 129
+																																																																																																																																	if x == 129 {
+																																																																																																																																		let x = 130
+																																																																																																																																		if x == 130 {
+																																																																																																																																			let x = 131
+																																																																																																																																			if x == 131 {
+																																																																																																																																				let x = 132
+																																																																																																																																				if x == 132 {
+																																																																																																																																					let x = 133
+																																																																																																																																					if x == 133 {
+																																																																																																																																						let x = 134
+																																																																																																																																						if x == 134 {
+																																																																																																																																							let x = 135
+																																																																																																																																							if x == 135 {
+																																																																																																																																								let x = 136
+																																																																																																																																								if x == 136 {
+																																																																																																																																									let x = 137
+																																																																																																																																									if x == 137 {
+																																																																																																																																										let x = 138
+																																																																																																																																										if x == 138 {
+																																																																																																																																											let x = 139
+																																																																																																																																											if x == 139 {
+																																																																																																																																												let x = 140
+																																																																																																																																												if x == 140 {
+																																																																																																																																													let x = 141
+																																																																																																																																													if x == 141 {
+																																																																																																																																														let x = 142
+																																																																																																																																														if x == 142 {
+																																																																																																																																															let x = 143
+																																																																																																																																															if x == 143 {
+																																																																																																																																																let x = 144
+																																																																																																																																																if x == 144 {
+																																																																																																																																																	let x = 145
+																																																																																																																																																	if x == 145 {
+																																																																																																																																																		let x = 146
+																																																																																																																																																		if x == 146 {
+																																																																																																																																																			let x = 147
+																																																																																																																																																			if x == 147 {
+																																																																																																																																																				let x = 148
+																																																																																																																																																				if x == 148 {
+																																																																																																																																																					let x = 149
+																																																																																																																																																					if x == 149 {
+																																																																																																																																																						let x = 150
+																																																																																																																																																						if x == 150 {
+																																																																																																																																																							let x = 151
+																																																																																																																																																							if x == 151 {
+																																																																																																																																																								let x = 152
+																																																																																																																																																								if x == 152 {
+																																																																																																																																																									let x = 153
+																																																																																																																																																									if x == 153 {
+																																																																																																																																																										let x = 154
+																																																																																																																																																										if x == 154 {
+																																																																																																																																																											let x = 155
+																																																																																																																																																											if x == 155 {
+																																																																																																																																																												let x = 156
+																																																																																																																																																												if x == 156 {
+																																																																																																																																																													let x = 157
+																																																																																																																																																													if x == 157 {
+																																																																																																																																																														let x = 158
+																																																																																																																																																														if x == 158 {
+																																																																																																																																																															let x = 159
+																																																																																																																																																															if x == 159 {
+																																																																																																																																																																let x = 160
+																																																																																																																																																																if x == 160 {
+																																																																																																																																																																	let x = 161
+																																																																																																																																																																	if x == 161 {
+																																																																																																																																																																		let x = 162
+																																																																																																																																																																		if x == 162 {
+																																																																																																																																																																			let x = 163
+																																																																																																																																																																			if x == 163 {
+																																																																																																																																																																				let x = 164
+																																																																																																																																																																				if x == 164 {
+																																																																																																																																																																					let x = 165
+																																																																																																																																																																					if x == 165 {
+																																																																																																																																																																						let x = 166
+																																																																																																																																																																						if x == 166 {
+																																																																																																																																																																							let x = 167
+																																																																																																																																																																							if x == 167 {
+																																																																																																																																																																								let x = 168
+																																																																																																																																																																								if x == 168 {
+																																																																																																																																																																									let x = 169
+																																																																																																																																																																									if x == 169 {
+																																																																																																																																																																										let x = 170
+																																																																																																																																																																										if x == 170 {
+																																																																																																																																																																											let x = 171
+																																																																																																																																																																											if x == 171 {
+																																																																																																																																																																												let x = 172
+																																																																																																																																																																												if x == 172 {
+																																																																																																																																																																													let x = 173
+																																																																																																																																																																													if x == 173 {
+																																																																																																																																																																														let x = 174
+																																																																																																																																																																														if x == 174 {
+																																																																																																																																																																															let x = 175
+																																																																																																																																																																															if x == 175 {
+																																																																																																																																																																																let x = 176
+																																																																																																																																																																																if x == 176 {
+																																																																																																																																																																																	let x = 177
+																																																																																																																																																																																	if x == 177 {
+																																																																																																																																																																																		let x = 178
+																																																																																																																																																																																		if x == 178 {
+																																																																																																																																																																																			let x = 179
+																																																																																																																																																																																			if x == 179 {
+																																																																																																																																																																																				let x = 180
+																																																																																																																																																																																				if x == 180 {
+																																																																																																																																																																																					let x = 181
+																																																																																																																																																																																					if x == 181 {
+																																																																																																																																																																																						let x = 182
+																																																																																																																																																																																						if x == 182 {
+																																																																																																																																																																																							let x = 183
+																																																																																																																																																																																							if x == 183 {
+																																																																																																																																																																																								let x = 184
+																																																																																																																																																																																								if x == 184 {
+																																																																																																																																																																																									let x = 185
+																																																																																																																																																																																									if x == 185 {
+																																																																																																																																																																																										let x = 186
+																																																																																																																																																																																										if x == 186 {
+																																																																																																																																																																																											let x = 187
+																																																																																																																																																																																											if x == 187 {
+																																																																																																																																																																																												let x = 188
+																																																																																																																																																																																												if x == 188 {
+																																																																																																																																																																																													let x = 189
+																																																																																																																																																																																													if x == 189 {
+																																																																																																																																																																																														let x = 190
+																																																																																																																																																																																														if x == 190 {
+																																																																																																																																																																																															let x = 191
+																																																																																																																																																																																															if x == 191 {
+																																																																																																																																																																																																let x = 192
+																																																																																																																																																																																																if x == 192 {
+																																																																																																																																																																																																	let x = 193
+																																																																																																																																																																																																	if x == 193 {
+																																																																																																																																																																																																		let x = 194
+																																																																																																																																																																																																		if x == 194 {
+																																																																																																																																																																																																			let x = 195
+																																																																																																																																																																																																			if x == 195 {
+																																																																																																																																																																																																				let x = 196
+																																																																																																																																																																																																				if x == 196 {
+																																																																																																																																																																																																					let x = 197
+																																																																																																																																																																																																					if x == 197 {
+																																																																																																																																																																																																						let x = 198
+																																																																																																																																																																																																						if x == 198 {
+																																																																																																																																																																																																							let x = 199
+																																																																																																																																																																																																							if x == 199 {
+																																																																																																																																																																																																								let x = 200
+																																																																																																																																																																																																								if x == 200 {
+																																																																																																																																																																																																									let x = 201
+																																																																																																																																																																																																									if x == 201 {
+																																																																																																																																																																																																										let x = 202
+																																																																																																																																																																																																										if x == 202 {
+																																																																																																																																																																																																											let x = 203
+																																																																																																																																																																																																											if x == 203 {
+																																																																																																																																																																																																												let x = 204
+																																																																																																																																																																																																												if x == 204 {
+																																																																																																																																																																																																													let x = 205
+																																																																																																																																																																																																													if x == 205 {
+																																																																																																																																																																																																														let x = 206
+																																																																																																																																																																																																														if x == 206 {
+																																																																																																																																																																																																															let x = 207
+																																																																																																																																																																																																															if x == 207 {
+																																																																																																																																																																																																																let x = 208
+																																																																																																																																																																																																																if x == 208 {
+																																																																																																																																																																																																																	let x = 209
+																																																																																																																																																																																																																	if x == 209 {
+																																																																																																																																																																																																																		let x = 210
+																																																																																																																																																																																																																		if x == 210 {
+																																																																																																																																																																																																																			let x = 211
+																																																																																																																																																																																																																			if x == 211 {
+																																																																																																																																																																																																																				let x = 212
+																																																																																																																																																																																																																				if x == 212 {
+																																																																																																																																																																																																																					let x = 213
+																																																																																																																																																																																																																					if x == 213 {
+																																																																																																																																																																																																																						let x = 214
+																																																																																																																																																																																																																						if x == 214 {
+																																																																																																																																																																																																																							let x = 215
+																																																																																																																																																																																																																							if x == 215 {
+																																																																																																																																																																																																																								let x = 216
+																																																																																																																																																																																																																								if x == 216 {
+																																																																																																																																																																																																																									let x = 217
+																																																																																																																																																																																																																									if x == 217 {
+																																																																																																																																																																																																																										let x = 218
+																																																																																																																																																																																																																										if x == 218 {
+																																																																																																																																																																																																																											let x = 219
+																																																																																																																																																																																																																											if x == 219 {
+																																																																																																																																																																																																																												let x = 220
+																																																																																																																																																																																																																												if x == 220 {
+																																																																																																																																																																																																																													let x = 221
+																																																																																																																																																																																																																													if x == 221 {
+																																																																																																																																																																																																																														let x = 222
+																																																																																																																																																																																																																														if x == 222 {
+																																																																																																																																																																																																																															let x = 223
+																																																																																																																																																																																																																															if x == 223 {
+																																																																																																																																																																																																																																let x = 224
+																																																																																																																																																																																																																																if x == 224 {
+																																																																																																																																																																																																																																	let x = 225
+																																																																																																																																																																																																																																	if x == 225 {
+																																																																																																																																																																																																																																		let x = 226
+																																																																																																																																																																																																																																		if x == 226 {
+																																																																																																																																																																																																																																			let x = 227
+																																																																																																																																																																																																																																			if x == 227 {
+																																																																																																																																																																																																																																				let x = 228
+																																																																																																																																																																																																																																				if x == 228 {
+																																																																																																																																																																																																																																					let x = 229
+																																																																																																																																																																																																																																					if x == 229 {
+																																																																																																																																																																																																																																						let x = 230
+																																																																																																																																																																																																																																						if x == 230 {
+																																																																																																																																																																																																																																							let x = 231
+																																																																																																																																																																																																																																							if x == 231 {
+																																																																																																																																																																																																																																								let x = 232
+																																																																																																																																																																																																																																								if x == 232 {
+																																																																																																																																																																																																																																									let x = 233
+																																																																																																																																																																																																																																									if x == 233 {
+																																																																																																																																																																																																																																										let x = 234
+																																																																																																																																																																																																																																										if x == 234 {
+																																																																																																																																																																																																																																											let x = 235
+																																																																																																																																																																																																																																											if x == 235 {
+																																																																																																																																																																																																																																												let x = 236
+																																																																																																																																																																																																																																												if x == 236 {
+																																																																																																																																																																																																																																													let x = 237
+																																																																																																																																																																																																																																													if x == 237 {
+																																																																																																																																																																																																																																														let x = 238
+																																																																																																																																																																																																																																														if x == 238 {
+																																																																																																																																																																																																																																															let x = 239
+																																																																																																																																																																																																																																															if x == 239 {
+																																																																																																																																																																																																																																																let x = 240
+																																																																																																																																																																																																																																																if x == 240 {
+																																																																																																																																																																																																																																																	let x = 241
+																																																																																																																																																																																																																																																	if x == 241 {
+																																																																																																																																																																																																																																																		let x = 242
+																																																																																																																																																																																																																																																		if x == 242 {
+																																																																																																																																																																																																																																																			let x = 243
+																																																																																																																																																																																																																																																			if x == 243 {
+																																																																																																																																																																																																																																																				let x = 244
+																																																																																																																																																																																																																																																				if x == 244 {
+																																																																																																																																																																																																																																																					let x = 245
+																																																																																																																																																																																																																																																					if x == 245 {
+																																																																																																																																																																																																																																																						let x = 246
+																																																																																																																																																																																																																																																						if x == 246 {
+																																																																																																																																																																																																																																																							let x = 247
+																																																																																																																																																																																																																																																							if x == 247 {
+																																																																																																																																																																																																																																																								let x = 248
+																																																																																																																																																																																																																																																								if x == 248 {
+																																																																																																																																																																																																																																																									let x = 249
+																																																																																																																																																																																																																																																									if x == 249 {
+																																																																																																																																																																																																																																																										let x = 250
+																																																																																																																																																																																																																																																										if x == 250 {
+																																																																																																																																																																																																																																																											let x = 251
+																																																																																																																																																																																																																																																											if x == 251 {
+																																																																																																																																																																																																																																																												let x = 252
+																																																																																																																																																																																																																																																												if x == 252 {
+																																																																																																																																																																																																																																																													let x = 253
+																																																																																																																																																																																																																																																													if x == 253 {
+																																																																																																																																																																																																																																																														let x = 254
+																																																																																																																																																																																																																																																														if x == 254 {
+																																																																																																																																																																																																																																																															let x = 255
+																																																																																																																																																																																																																																																															if x == 255 {
+																																																																																																																																																																																																																																																																let x = 256
+																																																																																																																																																																																																																																																																if x == 256 {
+																																																																																																																																																																																																																																																																	let x = 257
+																																																																																																																																																																																																																																																																	if x == 257 {
+																																																																																																																																																																																																																																																																		let x = 258
+																																																																																																																																																																																																																																																																		if x == 258 {
+																																																																																																																																																																																																																																																																			let x = 259
+																																																																																																																																																																																																																																																																			if x == 259 {
+																																																																																																																																																																																																																																																																				let x = 260
+																																																																																																																																																																																																																																																																				if x == 260 {
+																																																																																																																																																																																																																																																																					let x = 261
+																																																																																																																																																																																																																																																																					if x == 261 {
+																																																																																																																																																																																																																																																																						let x = 262
+																																																																																																																																																																																																																																																																						if x == 262 {
+																																																																																																																																																																																																																																																																							let x = 263
+																																																																																																																																																																																																																																																																							if x == 263 {
+																																																																																																																																																																																																																																																																								let x = 264
+																																																																																																																																																																																																																																																																								if x == 264 {
+																																																																																																																																																																																																																																																																									let x = 265
+																																																																																																																																																																																																																																																																									if x == 265 {
+																																																																																																																																																																																																																																																																										let x = 266
+																																																																																																																																																																																																																																																																										if x == 266 {
+																																																																																																																																																																																																																																																																											let x = 267
+																																																																																																																																																																																																																																																																											if x == 267 {
+																																																																																																																																																																																																																																																																												let x = 268
+																																																																																																																																																																																																																																																																												if x == 268 {
+																																																																																																																																																																																																																																																																													let x = 269
+																																																																																																																																																																																																																																																																													if x == 269 {
+																																																																																																																																																																																																																																																																														let x = 270
+																																																																																																																																																																																																																																																																														if x == 270 {
+																																																																																																																																																																																																																																																																															let x = 271
+																																																																																																																																																																																																																																																																															if x == 271 {
+																																																																																																																																																																																																																																																																																let x = 272
+																																																																																																																																																																																																																																																																																if x == 272 {
+																																																																																																																																																																																																																																																																																	let x = 273
+																																																																																																																																																																																																																																																																																	if x == 273 {
+																																																																																																																																																																																																																																																																																		let x = 274
+																																																																																																																																																																																																																																																																																		if x == 274 {
+																																																																																																																																																																																																																																																																																			let x = 275
+																																																																																																																																																																																																																																																																																			if x == 275 {
+																																																																																																																																																																																																																																																																																				let x = 276
+																																																																																																																																																																																																																																																																																				if x == 276 {
+																																																																																																																																																																																																																																																																																					let x = 277
+																																																																																																																																																																																																																																																																																					if x == 277 {
+																																																																																																																																																																																																																																																																																						let x = 278
+																																																																																																																																																																																																																																																																																						if x == 278 {
+																																																																																																																																																																																																																																																																																							let x = 279
+																																																																																																																																																																																																																																																																																							if x == 279 {
+																																																																																																																																																																																																																																																																																								let x = 280
+																																																																																																																																																																																																																																																																																								if x == 280 {
+																																																																																																																																																																																																																																																																																									let x = 281
+																																																																																																																																																																																																																																																																																									if x == 281 {
+																																																																																																																																																																																																																																																																																										let x = 282
+																																																																																																																																																																																																																																																																																										if x == 282 {
+																																																																																																																																																																																																																																																																																											let x = 283
+																																																																																																																																																																																																																																																																																											if x == 283 {
+																																																																																																																																																																																																																																																																																												let x = 284
+																																																																																																																																																																																																																																																																																												if x == 284 {
+																																																																																																																																																																																																																																																																																													let x = 285
+																																																																																																																																																																																																																																																																																													if x == 285 {
+																																																																																																																																																																																																																																																																																														let x = 286
+																																																																																																																																																																																																																																																																																														if x == 286 {
+																																																																																																																																																																																																																																																																																															let x = 287
+																																																																																																																																																																																																																																																																																															if x == 287 {
+																																																																																																																																																																																																																																																																																																let x = 288
+																																																																																																																																																																																																																																																																																																if x == 288 {
+																																																																																																																																																																																																																																																																																																	let x = 289
+																																																																																																																																																																																																																																																																																																	if x == 289 {
+																																																																																																																																																																																																																																																																																																		let x = 290
+																																																																																																																																																																																																																																																																																																		if x == 290 {
+																																																																																																																																																																																																																																																																																																			let x = 291
+																																																																																																																																																																																																																																																																																																			if x == 291 {
+																																																																																																																																																																																																																																																																																																				let x = 292
+																																																																																																																																																																																																																																																																																																				if x == 292 {
+																																																																																																																																																																																																																																																																																																					let x = 293
+																																																																																																																																																																																																																																																																																																					if x == 293 {
+																																																																																																																																																																																																																																																																																																						let x = 294
+																																																																																																																																																																																																																																																																																																						if x == 294 {
+																																																																																																																																																																																																																																																																																																							let x = 295
+																																																																																																																																																																																																																																																																																																							if x == 295 {
+																																																																																																																																																																																																																																																																																																								let x = 296
+																																																																																																																																																																																																																																																																																																								if x == 296 {
+																																																																																																																																																																																																																																																																																																									let x = 297
+																																																																																																																																																																																																																																																																																																									if x == 297 {
+																																																																																																																																																																																																																																																																																																										let x = 298
+																																																																																																																																																																																																																																																																																																										if x == 298 {
+																																																																																																																																																																																																																																																																																																											let x = 299
+																																																																																																																																																																																																																																																																																																											if x == 299 {
+																																																																																																																																																																																																																																																																																																												let x = 300
+																																																																																																																																																																																																																																																																																																												write(x, "\n")
+																																																																																																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																																																																																																}
+																																																																																																																																																																																																																																																																																															}
+																																																																																																																																																																																																																																																																																														}
+																																																																																																																																																																																																																																																																																													}
+																																																																																																																																																																																																																																																																																												}
+																																																																																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																																																																																}
+																																																																																																																																																																																																																																																																															}
+																																																																																																																																																																																																																																																																														}
+																																																																																																																																																																																																																																																																													}
+																																																																																																																																																																																																																																																																												}
+																																																																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																																																																}
+																																																																																																																																																																																																																																																															}
+																																																																																																																																																																																																																																																														}
+																																																																																																																																																																																																																																																													}
+																																																																																																																																																																																																																																																												}
+																																																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																																																}
+																																																																																																																																																																																																																																															}
+																																																																																																																																																																																																																																														}
+																																																																																																																																																																																																																																													}
+																																																																																																																																																																																																																																												}
+																																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																																}
+																																																																																																																																																																																																																															}
+																																																																																																																																																																																																																														}
+																																																																																																																																																																																																																													}
+																																																																																																																																																																																																																												}
+																																																																																																																																																																																																																											}
+																																																																																																																																																																																																																										}
+																																																																																																																																																																																																																									}
+																																																																																																																																																																																																																								}
+																																																																																																																																																																																																																							}
+																																																																																																																																																																																																																						}
+																																																																																																																																																																																																																					}
+																																																																																																																																																																																																																				}
+																																																																																																																																																																																																																			}
+																																																																																																																																																																																																																		}
+																																																																																																																																																																																																																	}
+																																																																																																																																																																																																																}
+																																																																																																																																																																																																															}
+																																																																																																																																																																																																														}
+																																																																																																																																																																																																													}
+																																																																																																																																																																																																												}
+																																																																																																																																																																																																											}
+																																																																																																																																																																																																										}
+																																																																																																																																																																																																									}
+																																																																																																																																																																																																								}
+																																																																																																																																																																																																							}
+																																																																																																																																																																																																						}
+																																																																																																																																																																																																					}
+																																																																																																																																																																																																				}
+																																																																																																																																																																																																			}
+																																																																																																																																																																																																		}
+																																																																																																																																																																																																	}
+																																																																																																																																																																																																}
+																																																																																																																																																																																															}
+																																																																																																																																																																																														}
+																																																																																																																																																																																													}
+																																																																																																																																																																																												}
+																																																																																																																																																																																											}
+																																																																																																																																																																																										}
+																																																																																																																																																																																									}
+																																																																																																																																																																																								}
+																																																																																																																																																																																							}
+																																																																																																																																																																																						}
+																																																																																																																																																																																					}
+																																																																																																																																																																																				}
+																																																																																																																																																																																			}
+																																																																																																																																																																																		}
+																																																																																																																																																																																	}
+																																																																																																																																																																																}
+																																																																																																																																																																															}
+																																																																																																																																																																														}
+																																																																																																																																																																													}
+																																																																																																																																																																												}
+																																																																																																																																																																											}
+																																																																																																																																																																										}
+																																																																																																																																																																									}
+																																																																																																																																																																								}
+																																																																																																																																																																							}
+																																																																																																																																																																						}
+																																																																																																																																																																					}
+																																																																																																																																																																				}
+																																																																																																																																																																			}
+																																																																																																																																																																		}
+																																																																																																																																																																	}
+																																																																																																																																																																}
+																																																																																																																																																															}
+																																																																																																																																																														}
+																																																																																																																																																													}
+																																																																																																																																																												}
+																																																																																																																																																											}
+																																																																																																																																																										}
+																																																																																																																																																									}
+																																																																																																																																																								}
+																																																																																																																																																							}
+																																																																																																																																																						}
+																																																																																																																																																					}
+																																																																																																																																																				}
+																																																																																																																																																			}
+																																																																																																																																																		}
+																																																																																																																																																	}
+																																																																																																																																																}
+																																																																																																																																															}
+																																																																																																																																														}
+																																																																																																																																													}
+																																																																																																																																												}
+																																																																																																																																											}
+																																																																																																																																										}
+																																																																																																																																									}
+																																																																																																																																								}
+																																																																																																																																							}
+																																																																																																																																						}
+																																																																																																																																					}
+																																																																																																																																				}
+																																																																																																																																			}
+																																																																																																																																		}
+																																																																																																																																	}
+																																																																																																																																}
+																																																																																																																															}
+																																																																																																																														}
+																																																																																																																													}
+																																																																																																																												}
+																																																																																																																											}
+																																																																																																																										}
+																																																																																																																									}
+																																																																																																																								}
+																																																																																																																							}
+																																																																																																																						}
+																																																																																																																					}
+																																																																																																																				}
+																																																																																																																			}
+																																																																																																																		}
+																																																																																																																	}
+																																																																																																																}
+																																																																																																															}
+																																																																																																														}
+																																																																																																													}
+																																																																																																												}
+																																																																																																											}
+																																																																																																										}
+																																																																																																									}
+																																																																																																								}
+																																																																																																							}
+																																																																																																						}
+																																																																																																					}
+																																																																																																				}
+																																																																																																			}
+																																																																																																		}
+																																																																																																	}
+																																																																																																}
+																																																																																															}
+																																																																																														}
+																																																																																													}
+																																																																																												}
+																																																																																											}
+																																																																																										}
+																																																																																									}
+																																																																																								}
+																																																																																							}
+																																																																																						}
+																																																																																					}
+																																																																																				}
+																																																																																			}
+																																																																																		}
+																																																																																	}
+																																																																																}
+																																																																															}
+																																																																														}
+																																																																													}
+																																																																												}
+																																																																											}
+																																																																										}
+																																																																									}
+																																																																								}
+																																																																							}
+																																																																						}
+																																																																					}
+																																																																				}
+																																																																			}
+																																																																		}
+																																																																	}
+																																																																}
+																																																															}
+																																																														}
+																																																													}
+																																																												}
+																																																											}
+																																																										}
+																																																									}
+																																																								}
+																																																							}
+																																																						}
+																																																					}
+																																																				}
+																																																			}
+																																																		}
+																																																	}
+																																																}
+																																															}
+																																														}
+																																													}
+																																												}
+																																											}
+																																										}
+																																									}
+																																								}
+																																							}
+																																						}
+																																					}
+																																				}
+																																			}
+																																		}
+																																	}
+																																}
+																															}
+																														}
+																													}
+																												}
+																											}
+																										}
+																									}
+																								}
+																							}
+																						}
+																					}
+																				}
+																			}
+																		}
+																	}
+																}
+															}
+														}
+													}
+												}
+											}
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
+write(x, "\n")
@@ -0,0 +1,16 @@
+// the body of if let over a nil constant never runs and must not be optimised
+
+let m: String? = nil
+if let m {
+	let s = length(m)
+	write(s)
+}
+write("ok\n")
+
+let n: Int? = nil
+if let n {
+	let k = n + 1
+	write(k, "\n")
+} else {
+	write("nil\n")
+}
@@ -0,0 +1,3 @@
+let a: Double? = nil
+let b = a ?? 4
+write(b)
@@ -0,0 +1,83 @@
+// calls of small functions are replaced by copies of their bodies
+func square(_ x: Int) -> Int {
+	return x * x
+}
+
+func clamp(_ value: Int, low lo: Int, high hi: Int) -> Int {
+	if value < lo {
+		return lo
+	}
+	if value > hi {
+		return hi
+	}
+	return value
+}
+
+func sign(_ x: Int) -> Int {
+	if x < 0 {
+		return 0 - 1
+	} else {
+		if x == 0 {
+			return 0
+		}
+	}
+	return 1
+}
+
+func report(_ label: String, _ value: Int) {
+	write(label, ": ", value, "\n")
+}
+
+func sumOfSquares(_ n: Int) -> Int {
+	var i = 0
+	var sum = 0
+	while i < n {
+		let s = square(i)
+		sum = sum + s
+		i = i + 1
+	}
+	return sum
+}
+
+// recursive functions stay calls
+func factorial(_ n: Int) -> Int {
+	if n < 2 {
+		return 1
+	}
+	let m = n - 1
+	let f = factorial(m)
+	return n * f
+}
+
+// functions using global variables stay calls
+var counter = 0
+func tick() -> Int {
+	counter = counter + 1
+	return counter
+}
+
+let text0 = readString()
+let text = text0 ?? "seven"
+let n = length(text)
+var x = square(n)
+report("square", x)
+// the argument is shadowed by the defined variable
+if n > 0 {
+	let x = square(x)
+	report("shadowed", x)
+}
+var i = 0 - 3
+while i < 30 {
+	let c = clamp(i, low: 0, high: 20)
+	let s = sign(i)
+	write(c, " ", s, "  ")
+	i = i + n
+}
+write("\n")
+let sum = sumOfSquares(n)
+report("sum", sum)
+let f = factorial(n)
+report("factorial", f)
+var t = tick()
+t = tick()
+report("tick", t)
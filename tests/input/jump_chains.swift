@@ -0,0 +1,32 @@
+func classify(_ n: Int, _ limit: Int) -> Int {
+    var count = 0
+    var i = 0
+    while i < n {
+        if i > limit {
+            if i == 3 {
+                count = count + 10
+            } else {
+                count = count + 1
+            }
+        } else {
+        }
+        if i == 0 {
+        } else {
+            write(i, " ")
+        }
+        i = i + 1
+    }
+    write("\n")
+    let maybe: Int? = count
+    let result = maybe ?? 0
+    if result > 100 {
+        return 0
+        write("unreachable")
+    }
+    return result
+}
+
+let a = classify(6, 2)
+write(a, "\n")
+let b = classify(2, 5)
+write(b, "\n")
@@ -0,0 +1,35 @@
+// int literals used as doubles are converted during compilation
+
+let t0 = readDouble()
+let x = t0 ?? 1.5
+
+var y: Double = 2
+y = 3
+let z: Double = 4
+write(y, " ", z, "\n")
+
+let a = x * 2
+let b = 10 - x
+let c = (x + 1) / 4
+write(a, " ", b, " ", c, "\n")
+
+// numeric kernel with mixed literals
+var sum = 0.0
+var i = 0
+while i < 5 {
+	sum = sum * 2 + 1
+	if sum > 10 {
+		sum = sum - 3
+	}
+	i = i + 1
+}
+write(sum, "\n")
+
+if x < 2 {
+	write("small\n")
+}
+if 1 == x {
+	write("one\n")
+} else {
+	write("not one\n")
+}
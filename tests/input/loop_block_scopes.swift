@@ -0,0 +1,35 @@
+// every block of a loop body has a scope of its own
+
+var x = 1
+var i = 0
+while i < 3 {
+	if i == 0 {
+		let x = 5
+		write(x, " ")
+	} else {
+		let x = i * 10
+		write(x, " ")
+	}
+	write(x, " ")
+	let x = i + 100
+	write(x, "\n")
+	var j = 0
+	while j < 2 {
+		let x = j
+		if j == 1 {
+			let x = "in"
+			write(x, " ")
+		}
+		write(x, " ")
+		j = j + 1
+	}
+	let m: String? = nil
+	if let m {
+		let n = length(m)
+		write(n)
+	} else {
+		write("nil\n")
+	}
+	i = i + 1
+}
+write(x, "\n")
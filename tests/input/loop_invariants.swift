@@ -0,0 +1,77 @@
+// values which do not change in a loop are computed once before it
+var total = 0
+func bump(_ by: Int) {
+	total = total + by
+}
+
+let s0 = readString()
+let s = s0 ?? "invariant"
+let n = length(s)
+
+// length of an unchanged string and arithmetic of unchanged variables
+var i = 0
+while i < n * 2 + 1 {
+	let l = length(s)
+	let first = ord(s)
+	total = total + l * n + first
+	i = i + 1
+}
+write(total, "\n")
+
+// nested loops, the inner bound depends on the outer loop only
+i = 0
+while i < n {
+	var j = 0
+	let bound = i + n
+	while j < bound - 2 {
+		total = total + bound * n
+		j = j + 1
+	}
+	i = i + 1
+}
+write(total, "\n")
+
+// the loop does not run, so the division by zero must not happen
+var zero = n - n
+i = 0
+while i < zero {
+	let q = n / zero
+	total = total + q
+	i = i + 1
+}
+write(total, "\n")
+
+// the variable is changed by the called function
+total = 0
+i = 0
+while i < 3 {
+	let t = total * 2
+	bump(n)
+	write(t, " ")
+	i = i + 1
+}
+write(total, "\n")
+
+// optional binding shadows the variable inside the loop
+var opt: Int? = n
+var sum = 0
+i = 0
+while i < 3 {
+	if let opt {
+		sum = sum + opt * 2
+	}
+	opt = i
+	i = i + 1
+}
+write(sum, "\n")
+
+// substring of an unchanged string with unchanged bounds
+i = 0
+var parts = ""
+while i < 3 {
+	let k = n - 4
+	let part = substring(of: s, startingAt: 2, endingBefore: k)
+	parts = parts + (part ?? "nil") + "|"
+	i = i + 1
+}
+write(parts, "\n")
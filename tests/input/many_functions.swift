@@ -0,0 +1,4202 @@
+// more functions than the old fixed-size function table could hold
+func f0(_ x: Int) -> Int { return x }
+func f1(_ x: Int) -> Int { let y = f0(x) 
+ return y + 1 }
+func f2(_ x: Int) -> Int { let y = f1(x) 
+ return y + 1 }
+func f3(_ x: Int) -> Int { let y = f2(x) 
+ return y + 1 }
+func f4(_ x: Int) -> Int { let y = f3(x) 
+ return y + 1 }
+func f5(_ x: Int) -> Int { let y = f4(x) 
+ return y + 1 }
+func f6(_ x: Int) -> Int { let y = f5(x) 
+ return y + 1 }
+func f7(_ x: Int) -> Int { let y = f6(x) 
+ return y + 1 }
+func f8(_ x: Int) -> Int { let y = f7(x) 
+ return y + 1 }
+func f9(_ x: Int) -> Int { let y = f8(x) 
+ return y + 1 }
+func f10(_ x: Int) -> Int { let y = f9(x) 
+ return y + 1 }
+func f11(_ x: Int) -> Int { let y = f10(x) 
+ return y + 1 }
+func f12(_ x: Int) -> Int { let y = f11(x) 
+ return y + 1 }
+func f13(_ x: Int) -> Int { let y = f12(x) 
+ return y + 1 }
+func f14(_ x: Int) -> Int { let y = f13(x) 
+ return y + 1 }
+func f15(_ x: Int) -> Int { let y = f14(x) 
+ return y + 1 }
+func f16(_ x: Int) -> Int { let y = f15(x) 
+ return y + 1 }
+func f17(_ x: Int) -> Int { let y = f16(x) 
+ return y + 1 }
+func f18(_ x: Int) -> Int { let y = f17(x) 
+ return y + 1 }
+func f19(_ x: Int) -> Int { let y = f18(x) 
+ return y + 1 }
+func f20(_ x: Int) -> Int { let y = f19(x) 
+ return y + 1 }
+func f21(_ x: Int) -> Int { let y = f20(x) 
+ return y + 1 }
+func f22(_ x: Int) -> Int { let y = f21(x) 
+ return y + 1 }
+func f23(_ x: Int) -> Int { let y = f22(x) 
+ return y + 1 }
+func f24(_ x: Int) -> Int { let y = f23(x) 
+ return y + 1 }
+func f25(_ x: Int) -> Int { let y = f24(x) 
+ return y + 1 }
+func f26(_ x: Int) -> Int { let y = f25(x) 
+ return y + 1 }
+func f27(_ x: Int) -> Int { let y = f26(x) 
+ return y + 1 }
+func f28(_ x: Int) -> Int { let y = f27(x) 
+ return y + 1 }
+func f29(_ x: Int) -> Int { let y = f28(x) 
+ return y + 1 }
+func f30(_ x: Int) -> Int { let y = f29(x) 
+ return y + 1 }
+func f31(_ x: Int) -> Int { let y = f30(x) 
+ return y + 1 }
+func f32(_ x: Int) -> Int { let y = f31(x) 
+ return y + 1 }
+func f33(_ x: Int) -> Int { let y = f32(x) 
+ return y + 1 }
+func f34(_ x: Int) -> Int { let y = f33(x) 
+ return y + 1 }
+func f35(_ x: Int) -> Int { let y = f34(x) 
+ return y + 1 }
+func f36(_ x: Int) -> Int { let y = f35(x) 
+ return y + 1 }
+func f37(_ x: Int) -> Int { let y = f36(x) 
+ return y + 1 }
+func f38(_ x: Int) -> Int { let y = f37(x) 
+ return y + 1 }
+func f39(_ x: Int) -> Int { let y = f38(x) 
+ return y + 1 }
+func f40(_ x: Int) -> Int { let y = f39(x) 
+ return y + 1 }
+func f41(_ x: Int) -> Int { let y = f40(x) 
+ return y + 1 }
+func f42(_ x: Int) -> Int { let y = f41(x) 
+ return y + 1 }
+func f43(_ x: Int) -> Int { let y = f42(x) 
+ return y + 1 }
+func f44(_ x: Int) -> Int { let y = f43(x) 
+ return y + 1 }
+func f45(_ x: Int) -> Int { let y = f44(x) 
+ return y + 1 }
+func f46(_ x: Int) -> Int { let y = f45(x) 
+ return y + 1 }
+func f47(_ x: Int) -> Int { let y = f46(x) 
+ return y + 1 }
+func f48(_ x: Int) -> Int { let y = f47(x) 
+ return y + 1 }
+func f49(_ x: Int) -> Int { let y = f48(x) 
+ return y + 1 }
+func f50(_ x: Int) -> Int { let y = f49(x) 
+ return y + 1 }
+func f51(_ x: Int) -> Int { let y = f50(x) 
+ return y + 1 }
+func f52(_ x: Int) -> Int { let y = f51(x) 
+ return y + 1 }
+func f53(_ x: Int) -> Int { let y = f52(x) 
+ return y + 1 }
+func f54(_ x: Int) -> Int { let y = f53(x) 
+ return y + 1 }
+func f55(_ x: Int) -> Int { let y = f54(x) 
+ return y + 1 }
+func f56(_ x: Int) -> Int { let y = f55(x) 
+ return y + 1 }
+func f57(_ x: Int) -> Int { let y = f56(x) 
+ return y + 1 }
+func f58(_ x: Int) -> Int { let y = f57(x) 
+ return y + 1 }
+func f59(_ x: Int) -> Int { let y = f58(x) 
+ return y + 1 }
+func f60(_ x: Int) -> Int { let y = f59(x) 
+ return y + 1 }
+func f61(_ x: Int) -> Int { let y = f60(x) 
+ return y + 1 }
+func f62(_ x: Int) -> Int { let y = f61(x) 
+ return y + 1 }
+func f63(_ x: Int) -> Int { let y = f62(x) 
+ return y + 1 }
+func f64(_ x: Int) -> Int { let y = f63(x) 
+ return y + 1 }
+func f65(_ x: Int) -> Int { let y = f64(x) 
+ return y + 1 }
+func f66(_ x: Int) -> Int { let y = f65(x) 
+ return y + 1 }
+func f67(_ x: Int) -> Int { let y = f66(x) 
+ return y + 1 }
+func f68(_ x: Int) -> Int { let y = f67(x) 
+ return y + 1 }
+func f69(_ x: Int) -> Int { let y = f68(x) 
+ return y + 1 }
+func f70(_ x: Int) -> Int { let y = f69(x) 
+ return y + 1 }
+func f71(_ x: Int) -> Int { let y = f70(x) 
+ return y + 1 }
+func f72(_ x: Int) -> Int { let y = f71(x) 
+ return y + 1 }
+func f73(_ x: Int) -> Int { let y = f72(x) 
+ return y + 1 }
+func f74(_ x: Int) -> Int { let y = f73(x) 
+ return y + 1 }
+func f75(_ x: Int) -> Int { let y = f74(x) 
+ return y + 1 }
+func f76(_ x: Int) -> Int { let y = f75(x) 
+ return y + 1 }
+func f77(_ x: Int) -> Int { let y = f76(x) 
+ return y + 1 }
+func f78(_ x: Int) -> Int { let y = f77(x) 
+ return y + 1 }
+func f79(_ x: Int) -> Int { let y = f78(x) 
+ return y + 1 }
+func f80(_ x: Int) -> Int { let y = f79(x) 
+ return y + 1 }
+func f81(_ x: Int) -> Int { let y = f80(x) 
+ return y + 1 }
+func f82(_ x: Int) -> Int { let y = f81(x) 
+ return y + 1 }
+func f83(_ x: Int) -> Int { let y = f82(x) 
+ return y + 1 }
+func f84(_ x: Int) -> Int { let y = f83(x) 
+ return y + 1 }
+func f85(_ x: Int) -> Int { let y = f84(x) 
+ return y + 1 }
+func f86(_ x: Int) -> Int { let y = f85(x) 
+ return y + 1 }
+func f87(_ x: Int) -> Int { let y = f86(x) 
+ return y + 1 }
+func f88(_ x: Int) -> Int { let y = f87(x) 
+ return y + 1 }
+func f89(_ x: Int) -> Int { let y = f88(x) 
+ return y + 1 }
+func f90(_ x: Int) -> Int { let y = f89(x) 
+ return y + 1 }
+func f91(_ x: Int) -> Int { let y = f90(x) 
+ return y + 1 }
+func f92(_ x: Int) -> Int { let y = f91(x) 
+ return y + 1 }
+func f93(_ x: Int) -> Int { let y = f92(x) 
+ return y + 1 }
+func f94(_ x: Int) -> Int { let y = f93(x) 
+ return y + 1 }
+func f95(_ x: Int) -> Int { let y = f94(x) 
+ return y + 1 }
+func f96(_ x: Int) -> Int { let y = f95(x) 
+ return y + 1 }
+func f97(_ x: Int) -> Int { let y = f96(x) 
+ return y + 1 }
+func f98(_ x: Int) -> Int { let y = f97(x) 
+ return y + 1 }
+func f99(_ x: Int) -> Int { let y = f98(x) 
+ return y + 1 }
+func f100(_ x: Int) -> Int { let y = f99(x) 
+ return y + 1 }
+func f101(_ x: Int) -> Int { let y = f100(x) 
+ return y + 1 }
+func f102(_ x: Int) -> Int { let y = f101(x) 
+ return y + 1 }
+func f103(_ x: Int) -> Int { let y = f102(x) 
+ return y + 1 }
+func f104(_ x: Int) -> Int { let y = f103(x) 
+ return y + 1 }
+func f105(_ x: Int) -> Int { let y = f104(x) 
+ return y + 1 }
+func f106(_ x: Int) -> Int { let y = f105(x) 
+ return y + 1 }
+func f107(_ x: Int) -> Int { let y = f106(x) 
+ return y + 1 }
+func f108(_ x: Int) -> Int { let y = f107(x) 
+ return y + 1 }
+func f109(_ x: Int) -> Int { let y = f108(x) 
+ return y + 1 }
+func f110(_ x: Int) -> Int { let y = f109(x) 
+ return y + 1 }
+func f111(_ x: Int) -> Int { let y = f110(x) 
+ return y + 1 }
+func f112(_ x: Int) -> Int { let y = f111(x) 
+ return y + 1 }
+func f113(_ x: Int) -> Int { let y = f112(x) 
+ return y + 1 }
+func f114(_ x: Int) -> Int { let y = f113(x) 
+ return y + 1 }
+func f115(_ x: Int) -> Int { let y = f114(x) 
+ return y + 1 }
+func f116(_ x: Int) -> Int { let y = f115(x) 
+ return y + 1 }
+func f117(_ x: Int) -> Int { let y = f116(x) 
+ return y + 1 }
+func f118(_ x: Int) -> Int { let y = f117(x) 
+ return y + 1 }
+func f119(_ x: Int) -> Int { let y = f118(x) 
+ return y + 1 }
+func f120(_ x: Int) -> Int { let y = f119(x) 
+ return y + 1 }
+func f121(_ x: Int) -> Int { let y = f120(x) 
+ return y + 1 }
+func f122(_ x: Int) -> Int { let y = f121(x) 
+ return y + 1 }
+func f123(_ x: Int) -> Int { let y = f122(x) 
+ return y + 1 }
+func f124(_ x: Int) -> Int { let y = f123(x) 
+ return y + 1 }
+func f125(_ x: Int) -> Int { let y = f124(x) 
+ return y + 1 }
+func f126(_ x: Int) -> Int { let y = f125(x) 
+ return y + 1 }
+func f127(_ x: Int) -> Int { let y = f126(x) 
+ return y + 1 }
+func f128(_ x: Int) -> Int { let y = f127(x) 
+ return y + 1 }
+func f129(_ x: Int) -> Int { let y = f128(x) 
+ return y + 1 }
+func f130(_ x: Int) -> Int { let y = f129(x) 
+ return y + 1 }
+func f131(_ x: Int) -> Int { let y = f130(x) 
+ return y + 1 }
+func f132(_ x: Int) -> Int { let y = f131(x) 
+ return y + 1 }
+func f133(_ x: Int) -> Int { let y = f132(x) 
+ return y + 1 }
+func f134(_ x: Int) -> Int { let y = f133(x) 
+ return y + 1 }
+func f135(_ x: Int) -> Int { let y = f134(x) 
+ return y + 1 }
+func f136(_ x: Int) -> Int { let y = f135(x) 
+ return y + 1 }
+func f137(_ x: Int) -> Int { let y = f136(x) 
+ return y + 1 }
+func f138(_ x: Int) -> Int { let y = f137(x) 
+ return y + 1 }
+func f139(_ x: Int) -> Int { let y = f138(x) 
+ return y + 1 }
+func f140(_ x: Int) -> Int { let y = f139(x) 
+ return y + 1 }
+func f141(_ x: Int) -> Int { let y = f140(x) 
+ return y + 1 }
+func f142(_ x: Int) -> Int { let y = f141(x) 
+ return y + 1 }
+func f143(_ x: Int) -> Int { let y = f142(x) 
+ return y + 1 }
+func f144(_ x: Int) -> Int { let y = f143(x) 
+ return y + 1 }
+func f145(_ x: Int) -> Int { let y = f144(x) 
+ return y + 1 }
+func f146(_ x: Int) -> Int { let y = f145(x) 
+ return y + 1 }
+func f147(_ x: Int) -> Int { let y = f146(x) 
+ return y + 1 }
+func f148(_ x: Int) -> Int { let y = f147(x) 
+ return y + 1 }
+func f149(_ x: Int) -> Int { let y = f148(x) 
+ return y + 1 }
+func f150(_ x: Int) -> Int { let y = f149(x) 
+ return y + 1 }
+func f151(_ x: Int) -> Int { let y = f150(x) 
+ return y + 1 }
+func f152(_ x: Int) -> Int { let y = f151(x) 
+ return y + 1 }
+func f153(_ x: Int) -> Int { let y = f152(x) 
+ return y + 1 }
+func f154(_ x: Int) -> Int { let y = f153(x) 
+ return y + 1 }
+func f155(_ x: Int) -> Int { let y = f154(x) 
+ return y + 1 }
+func f156(_ x: Int) -> Int { let y = f155(x) 
+ return y + 1 }
+func f157(_ x: Int) -> Int { let y = f156(x) 
+ return y + 1 }
+func f158(_ x: Int) -> Int { let y = f157(x) 
+ return y + 1 }
+func f159(_ x: Int) -> Int { let y = f158(x) 
+ return y + 1 }
+func f160(_ x: Int) -> Int { let y = f159(x) 
+ return y + 1 }
+func f161(_ x: Int) -> Int { let y = f160(x) 
+ return y + 1 }
+func f162(_ x: Int) -> Int { let y = f161(x) 
+ return y + 1 }
+func f163(_ x: Int) -> Int { let y = f162(x) 
+ return y + 1 }
+func f164(_ x: Int) -> Int { let y = f163(x) 
+ return y + 1 }
+func f165(_ x: Int) -> Int { let y = f164(x) 
+ return y + 1 }
+func f166(_ x: Int) -> Int { let y = f165(x) 
+ return y + 1 }
+func f167(_ x: Int) -> Int { let y = f166(x) 
+ return y + 1 }
+func f168(_ x: Int) -> Int { let y = f167(x) 
+ return y + 1 }
+func f169(_ x: Int) -> Int { let y = f168(x) 
+ return y + 1 }
+func f170(_ x: Int) -> Int { let y = f169(x) 
+ return y + 1 }
+func f171(_ x: Int) -> Int { let y = f170(x) 
+ return y + 1 }
+func f172(_ x: Int) -> Int { let y = f171(x) 
+ return y + 1 }
+func f173(_ x: Int) -> Int { let y = f172(x) 
+ return y + 1 }
+func f174(_ x: Int) -> Int { let y = f173(x) 
+ return y + 1 }
+func f175(_ x: Int) -> Int { let y = f174(x) 
+ return y + 1 }
+func f176(_ x: Int) -> Int { let y = f175(x) 
+ return y + 1 }
+func f177(_ x: Int) -> Int { let y = f176(x) 
+ return y + 1 }
+func f178(_ x: Int) -> Int { let y = f177(x) 
+ return y + 1 }
+func f179(_ x: Int) -> Int { let y = f178(x) 
+ return y + 1 }
+func f180(_ x: Int) -> Int { let y = f179(x) 
+ return y + 1 }
+func f181(_ x: Int) -> Int { let y = f180(x) 
+ return y + 1 }
+func f182(_ x: Int) -> Int { let y = f181(x) 
+ return y + 1 }
+func f183(_ x: Int) -> Int { let y = f182(x) 
+ return y + 1 }
+func f184(_ x: Int) -> Int { let y = f183(x) 
+ return y + 1 }
+func f185(_ x: Int) -> Int { let y = f184(x) 
+ return y + 1 }
+func f186(_ x: Int) -> Int { let y = f185(x) 
+ return y + 1 }
+func f187(_ x: Int) -> Int { let y = f186(x) 
+ return y + 1 }
+func f188(_ x: Int) -> Int { let y = f187(x) 
+ return y + 1 }
+func f189(_ x: Int) -> Int { let y = f188(x) 
+ return y + 1 }
+func f190(_ x: Int) -> Int { let y = f189(x) 
+ return y + 1 }
+func f191(_ x: Int) -> Int { let y = f190(x) 
+ return y + 1 }
+func f192(_ x: Int) -> Int { let y = f191(x) 
+ return y + 1 }
+func f193(_ x: Int) -> Int { let y = f192(x) 
+ return y + 1 }
+func f194(_ x: Int) -> Int { let y = f193(x) 
+ return y + 1 }
+func f195(_ x: Int) -> Int { let y = f194(x) 
+ return y + 1 }
+func f196(_ x: Int) -> Int { let y = f195(x) 
+ return y + 1 }
+func f197(_ x: Int) -> Int { let y = f196(x) 
+ return y + 1 }
+func f198(_ x: Int) -> Int { let y = f197(x) 
+ return y + 1 }
+func f199(_ x: Int) -> Int { let y = f198(x) 
+ return y + 1 }
+func f200(_ x: Int) -> Int { let y = f199(x) 
+ return y + 1 }
+func f201(_ x: Int) -> Int { let y = f200(x) 
+ return y + 1 }
+func f202(_ x: Int) -> Int { let y = f201(x) 
+ return y + 1 }
+func f203(_ x: Int) -> Int { let y = f202(x) 
+ return y + 1 }
+func f204(_ x: Int) -> Int { let y = f203(x) 
+ return y + 1 }
+func f205(_ x: Int) -> Int { let y = f204(x) 
+ return y + 1 }
+func f206(_ x: Int) -> Int { let y = f205(x) 
+ return y + 1 }
+func f207(_ x: Int) -> Int { let y = f206(x) 
+ return y + 1 }
+func f208(_ x: Int) -> Int { let y = f207(x) 
+ return y + 1 }
+func f209(_ x: Int) -> Int { let y = f208(x) 
+ return y + 1 }
+func f210(_ x: Int) -> Int { let y = f209(x) 
+ return y + 1 }
+func f211(_ x: Int) -> Int { let y = f210(x) 
+ return y + 1 }
+func f212(_ x: Int) -> Int { let y = f211(x) 
+ return y + 1 }
+func f213(_ x: Int) -> Int { let y = f212(x) 
+ return y + 1 }
+func f214(_ x: Int) -> Int { let y = f213(x) 
+ return y + 1 }
+func f215(_ x: Int) -> Int { let y = f214(x) 
+ return y + 1 }
+func f216(_ x: Int) -> Int { let y = f215(x) 
+ return y + 1 }
+func f217(_ x: Int) -> Int { let y = f216(x) 
+ return y + 1 }
+func f218(_ x: Int) -> Int { let y = f217(x) 
+ return y + 1 }
+func f219(_ x: Int) -> Int { let y = f218(x) 
+ return y + 1 }
+func f220(_ x: Int) -> Int { let y = f219(x) 
+ return y + 1 }
+func f221(_ x: Int) -> Int { let y = f220(x) 
+ return y + 1 }
+func f222(_ x: Int) -> Int { let y = f221(x) 
+ return y + 1 }
+func f223(_ x: Int) -> Int { let y = f222(x) 
+ return y + 1 }
+func f224(_ x: Int) -> Int { let y = f223(x) 
+ return y + 1 }
+func f225(_ x: Int) -> Int { let y = f224(x) 
+ return y + 1 }
+func f226(_ x: Int) -> Int { let y = f225(x) 
+ return y + 1 }
+func f227(_ x: Int) -> Int { let y = f226(x) 
+ return y + 1 }
+func f228(_ x: Int) -> Int { let y = f227(x) 
+ return y + 1 }
+func f229(_ x: Int) -> Int { let y = f228(x) 
+ return y + 1 }
+func f230(_ x: Int) -> Int { let y = f229(x) 
+ return y + 1 }
+func f231(_ x: Int) -> Int { let y = f230(x) 
+ return y + 1 }
+func f232(_ x: Int) -> Int { let y = f231(x) 
+ return y + 1 }
+func f233(_ x: Int) -> Int { let y = f232(x) 
+ return y + 1 }
+func f234(_ x: Int) -> Int { let y = f233(x) 
+ return y + 1 }
+func f235(_ x: Int) -> Int { let y = f234(x) 
+ return y + 1 }
+func f236(_ x: Int) -> Int { let y = f235(x) 
+ return y + 1 }
+func f237(_ x: Int) -> Int { let y = f236(x) 
+ return y + 1 }
+func f238(_ x: Int) -> Int { let y = f237(x) 
+ return y + 1 }
+func f239(_ x: Int) -> Int { let y = f238(x) 
+ return y + 1 }
+func f240(_ x: Int) -> Int { let y = f239(x) 
+ return y + 1 }
+func f241(_ x: Int) -> Int { let y = f240(x) 
+ return y + 1 }
+func f242(_ x: Int) -> Int { let y = f241(x) 
+ return y + 1 }
+func f243(_ x: Int) -> Int { let y = f242(x) 
+ return y + 1 }
+func f244(_ x: Int) -> Int { let y = f243(x) 
+ return y + 1 }
+func f245(_ x: Int) -> Int { let y = f244(x) 
+ return y + 1 }
+func f246(_ x: Int) -> Int { let y = f245(x) 
+ return y + 1 }
+func f247(_ x: Int) -> Int { let y = f246(x) 
+ return y + 1 }
+func f248(_ x: Int) -> Int { let y = f247(x) 
+ return y + 1 }
+func f249(_ x: Int) -> Int { let y = f248(x) 
+ return y + 1 }
+func f250(_ x: Int) -> Int { let y = f249(x) 
+ return y + 1 }
+func f251(_ x: Int) -> Int { let y = f250(x) 
+ return y + 1 }
+func f252(_ x: Int) -> Int { let y = f251(x) 
+ return y + 1 }
+func f253(_ x: Int) -> Int { let y = f252(x) 
+ return y + 1 }
+func f254(_ x: Int) -> Int { let y = f253(x) 
+ return y + 1 }
+func f255(_ x: Int) -> Int { let y = f254(x) 
+ return y + 1 }
+func f256(_ x: Int) -> Int { let y = f255(x) 
+ return y + 1 }
+func f257(_ x: Int) -> Int { let y = f256(x) 
+ return y + 1 }
+func f258(_ x: Int) -> Int { let y = f257(x) 
+ return y + 1 }
+func f259(_ x: Int) -> Int { let y = f258(x) 
+ return y + 1 }
+func f260(_ x: Int) -> Int { let y = f259(x) 
+ return y + 1 }
+func f261(_ x: Int) -> Int { let y = f260(x) 
+ return y + 1 }
+func f262(_ x: Int) -> Int { let y = f261(x) 
+ return y + 1 }
+func f263(_ x: Int) -> Int { let y = f262(x) 
+ return y + 1 }
+func f264(_ x: Int) -> Int { let y = f263(x) 
+ return y + 1 }
+func f265(_ x: Int) -> Int { let y = f264(x) 
+ return y + 1 }
+func f266(_ x: Int) -> Int { let y = f265(x) 
+ return y + 1 }
+func f267(_ x: Int) -> Int { let y = f266(x) 
+ return y + 1 }
+func f268(_ x: Int) -> Int { let y = f267(x) 
+ return y + 1 }
+func f269(_ x: Int) -> Int { let y = f268(x) 
+ return y + 1 }
+func f270(_ x: Int) -> Int { let y = f269(x) 
+ return y + 1 }
+func f271(_ x: Int) -> Int { let y = f270(x) 
+ return y + 1 }
+func f272(_ x: Int) -> Int { let y = f271(x) 
+ return y + 1 }
+func f273(_ x: Int) -> Int { let y = f272(x) 
+ return y + 1 }
+func f274(_ x: Int) -> Int { let y = f273(x) 
+ return y + 1 }
+func f275(_ x: Int) -> Int { let y = f274(x) 
+ return y + 1 }
+func f276(_ x: Int) -> Int { let y = f275(x) 
+ return y + 1 }
+func f277(_ x: Int) -> Int { let y = f276(x) 
+ return y + 1 }
+func f278(_ x: Int) -> Int { let y = f277(x) 
+ return y + 1 }
+func f279(_ x: Int) -> Int { let y = f278(x) 
+ return y + 1 }
+func f280(_ x: Int) -> Int { let y = f279(x) 
+ return y + 1 }
+func f281(_ x: Int) -> Int { let y = f280(x) 
+ return y + 1 }
+func f282(_ x: Int) -> Int { let y = f281(x) 
+ return y + 1 }
+func f283(_ x: Int) -> Int { let y = f282(x) 
+ return y + 1 }
+func f284(_ x: Int) -> Int { let y = f283(x) 
+ return y + 1 }
+func f285(_ x: Int) -> Int { let y = f284(x) 
+ return y + 1 }
+func f286(_ x: Int) -> Int { let y = f285(x) 
+ return y + 1 }
+func f287(_ x: Int) -> Int { let y = f286(x) 
+ return y + 1 }
+func f288(_ x: Int) -> Int { let y = f287(x) 
+ return y + 1 }
+func f289(_ x: Int) -> Int { let y = f288(x) 
+ return y + 1 }
+func f290(_ x: Int) -> Int { let y = f289(x) 
+ return y + 1 }
+func f291(_ x: Int) -> Int { let y = f290(x) 
+ return y + 1 }
+func f292(_ x: Int) -> Int { let y = f291(x) 
+ return y + 1 }
+func f293(_ x: Int) -> Int { let y = f292(x) 
+ return y + 1 }
+func f294(_ x: Int) -> Int { let y = f293(x) 
+ return y + 1 }
+func f295(_ x: Int) -> Int { let y = f294(x) 
+ return y + 1 }
+func f296(_ x: Int) -> Int { let y = f295(x) 
+ return y + 1 }
+func f297(_ x: Int) -> Int { let y = f296(x) 
+ return y + 1 }
+func f298(_ x: Int) -> Int { let y = f297(x) 
+ return y + 1 }
+func f299(_ x: Int) -> Int { let y = f298(x) 
+ return y + 1 }
+func f300(_ x: Int) -> Int { let y = f299(x) 
+ return y + 1 }
+func f301(_ x: Int) -> Int { let y = f300(x) 
+ return y + 1 }
+func f302(_ x: Int) -> Int { let y = f301(x) 
+ return y + 1 }
+func f303(_ x: Int) -> Int { let y = f302(x) 
+ return y + 1 }
+func f304(_ x: Int) -> Int { let y = f303(x) 
+ return y + 1 }
+func f305(_ x: Int) -> Int { let y = f304(x) 
+ return y + 1 }
+func f306(_ x: Int) -> Int { let y = f305(x) 
+ return y + 1 }
+func f307(_ x: Int) -> Int { let y = f306(x) 
+ return y + 1 }
+func f308(_ x: Int) -> Int { let y = f307(x) 
+ return y + 1 }
+func f309(_ x: Int) -> Int { let y = f308(x) 
+ return y + 1 }
+func f310(_ x: Int) -> Int { let y = f309(x) 
+ return y + 1 }
+func f311(_ x: Int) -> Int { let y = f310(x) 
+ return y + 1 }
+func f312(_ x: Int) -> Int { let y = f311(x) 
+ return y + 1 }
+func f313(_ x: Int) -> Int { let y = f312(x) 
+ return y + 1 }
+func f314(_ x: Int) -> Int { let y = f313(x) 
+ return y + 1 }
+func f315(_ x: Int) -> Int { let y = f314(x) 
+ return y + 1 }
+func f316(_ x: Int) -> Int { let y = f315(x) 
+ return y + 1 }
+func f317(_ x: Int) -> Int { let y = f316(x) 
+ return y + 1 }
+func f318(_ x: Int) -> Int { let y = f317(x) 
+ return y + 1 }
+func f319(_ x: Int) -> Int { let y = f318(x) 
+ return y + 1 }
+func f320(_ x: Int) -> Int { let y = f319(x) 
+ return y + 1 }
+func f321(_ x: Int) -> Int { let y = f320(x) 
+ return y + 1 }
+func f322(_ x: Int) -> Int { let y = f321(x) 
+ return y + 1 }
+func f323(_ x: Int) -> Int { let y = f322(x) 
+ return y + 1 }
+func f324(_ x: Int) -> Int { let y = f323(x) 
+ return y + 1 }
+func f325(_ x: Int) -> Int { let y = f324(x) 
+ return y + 1 }
+func f326(_ x: Int) -> Int { let y = f325(x) 
+ return y + 1 }
+func f327(_ x: Int) -> Int { let y = f326(x) 
+ return y + 1 }
+func f328(_ x: Int) -> Int { let y = f327(x) 
+ return y + 1 }
+func f329(_ x: Int) -> Int { let y = f328(x) 
+ return y + 1 }
+func f330(_ x: Int) -> Int { let y = f329(x) 
+ return y + 1 }
+func f331(_ x: Int) -> Int { let y = f330(x) 
+ return y + 1 }
+func f332(_ x: Int) -> Int { let y = f331(x) 
+ return y + 1 }
+func f333(_ x: Int) -> Int { let y = f332(x) 
+ return y + 1 }
+func f334(_ x: Int) -> Int { let y = f333(x) 
+ return y + 1 }
+func f335(_ x: Int) -> Int { let y = f334(x) 
+ return y + 1 }
+func f336(_ x: Int) -> Int { let y = f335(x) 
+ return y + 1 }
+func f337(_ x: Int) -> Int { let y = f336(x) 
+ return y + 1 }
+func f338(_ x: Int) -> Int { let y = f337(x) 
+ return y + 1 }
+func f339(_ x: Int) -> Int { let y = f338(x) 
+ return y + 1 }
+func f340(_ x: Int) -> Int { let y = f339(x) 
+ return y + 1 }
+func f341(_ x: Int) -> Int { let y = f340(x) 
+ return y + 1 }
+func f342(_ x: Int) -> Int { let y = f341(x) 
+ return y + 1 }
+func f343(_ x: Int) -> Int { let y = f342(x) 
+ return y + 1 }
+func f344(_ x: Int) -> Int { let y = f343(x) 
+ return y + 1 }
+func f345(_ x: Int) -> Int { let y = f344(x) 
+ return y + 1 }
+func f346(_ x: Int) -> Int { let y = f345(x) 
+ return y + 1 }
+func f347(_ x: Int) -> Int { let y = f346(x) 
+ return y + 1 }
+func f348(_ x: Int) -> Int { let y = f347(x) 
+ return y + 1 }
+func f349(_ x: Int) -> Int { let y = f348(x) 
+ return y + 1 }
+func f350(_ x: Int) -> Int { let y = f349(x) 
+ return y + 1 }
+func f351(_ x: Int) -> Int { let y = f350(x) 
+ return y + 1 }
+func f352(_ x: Int) -> Int { let y = f351(x) 
+ return y + 1 }
+func f353(_ x: Int) -> Int { let y = f352(x) 
+ return y + 1 }
+func f354(_ x: Int) -> Int { let y = f353(x) 
+ return y + 1 }
+func f355(_ x: Int) -> Int { let y = f354(x) 
+ return y + 1 }
+func f356(_ x: Int) -> Int { let y = f355(x) 
+ return y + 1 }
+func f357(_ x: Int) -> Int { let y = f356(x) 
+ return y + 1 }
+func f358(_ x: Int) -> Int { let y = f357(x) 
+ return y + 1 }
+func f359(_ x: Int) -> Int { let y = f358(x) 
+ return y + 1 }
+func f360(_ x: Int) -> Int { let y = f359(x) 
+ return y + 1 }
+func f361(_ x: Int) -> Int { let y = f360(x) 
+ return y + 1 }
+func f362(_ x: Int) -> Int { let y = f361(x) 
+ return y + 1 }
+func f363(_ x: Int) -> Int { let y = f362(x) 
+ return y + 1 }
+func f364(_ x: Int) -> Int { let y = f363(x) 
+ return y + 1 }
+func f365(_ x: Int) -> Int { let y = f364(x) 
+ return y + 1 }
+func f366(_ x: Int) -> Int { let y = f365(x) 
+ return y + 1 }
+func f367(_ x: Int) -> Int { let y = f366(x) 
+ return y + 1 }
+func f368(_ x: Int) -> Int { let y = f367(x) 
+ return y + 1 }
+func f369(_ x: Int) -> Int { let y = f368(x) 
+ return y + 1 }
+func f370(_ x: Int) -> Int { let y = f369(x) 
+ return y + 1 }
+func f371(_ x: Int) -> Int { let y = f370(x) 
+ return y + 1 }
+func f372(_ x: Int) -> Int { let y = f371(x) 
+ return y + 1 }
+func f373(_ x: Int) -> Int { let y = f372(x) 
+ return y + 1 }
+func f374(_ x: Int) -> Int { let y = f373(x) 
+ return y + 1 }
+func f375(_ x: Int) -> Int { let y = f374(x) 
+ return y + 1 }
+func f376(_ x: Int) -> Int { let y = f375(x) 
+ return y + 1 }
+func f377(_ x: Int) -> Int { let y = f376(x) 
+ return y + 1 }
+func f378(_ x: Int) -> Int { let y = f377(x) 
+ return y + 1 }
+func f379(_ x: Int) -> Int { let y = f378(x) 
+ return y + 1 }
+func f380(_ x: Int) -> Int { let y = f379(x) 
+ return y + 1 }
+func f381(_ x: Int) -> Int { let y = f380(x) 
+ return y + 1 }
+func f382(_ x: Int) -> Int { let y = f381(x) 
+ return y + 1 }
+func f383(_ x: Int) -> Int { let y = f382(x) 
+ return y + 1 }
+func f384(_ x: Int) -> Int { let y = f383(x) 
+ return y + 1 }
+func f385(_ x: Int) -> Int { let y = f384(x) 
+ return y + 1 }
+func f386(_ x: Int) -> Int { let y = f385(x) 
+ return y + 1 }
+func f387(_ x: Int) -> Int { let y = f386(x) 
+ return y + 1 }
+func f388(_ x: Int) -> Int { let y = f387(x) 
+ return y + 1 }
+func f389(_ x: Int) -> Int { let y = f388(x) 
+ return y + 1 }
+func f390(_ x: Int) -> Int { let y = f389(x) 
+ return y + 1 }
+func f391(_ x: Int) -> Int { let y = f390(x) 
+ return y + 1 }
+func f392(_ x: Int) -> Int { let y = f391(x) 
+ return y + 1 }
+func f393(_ x: Int) -> Int { let y = f392(x) 
+ return y + 1 }
+func f394(_ x: Int) -> Int { let y = f393(x) 
+ return y + 1 }
+func f395(_ x: Int) -> Int { let y = f394(x) 
+ return y + 1 }
+func f396(_ x: Int) -> Int { let y = f395(x) 
+ return y + 1 }
+func f397(_ x: Int) -> Int { let y = f396(x) 
+ return y + 1 }
+func f398(_ x: Int) -> Int { let y = f397(x) 
+ return y + 1 }
+func f399(_ x: Int) -> Int { let y = f398(x) 
+ return y + 1 }
+func f400(_ x: Int) -> Int { let y = f399(x) 
+ return y + 1 }
+func f401(_ x: Int) -> Int { let y = f400(x) 
+ return y + 1 }
+func f402(_ x: Int) -> Int { let y = f401(x) 
+ return y + 1 }
+func f403(_ x: Int) -> Int { let y = f402(x) 
+ return y + 1 }
+func f404(_ x: Int) -> Int { let y = f403(x) 
+ return y + 1 }
+func f405(_ x: Int) -> Int { let y = f404(x) 
+ return y + 1 }
+func f406(_ x: Int) -> Int { let y = f405(x) 
+ return y + 1 }
+func f407(_ x: Int) -> Int { let y = f406(x) 
+ return y + 1 }
+func f408(_ x: Int) -> Int { let y = f407(x) 
+ return y + 1 }
+func f409(_ x: Int) -> Int { let y = f408(x) 
+ return y + 1 }
+func f410(_ x: Int) -> Int { let y = f409(x) 
+ return y + 1 }
+func f411(_ x: Int) -> Int { let y = f410(x) 
+ return y + 1 }
+func f412(_ x: Int) -> Int { let y = f411(x) 
+ return y + 1 }
+func f413(_ x: Int) -> Int { let y = f412(x) 
+ return y + 1 }
+func f414(_ x: Int) -> Int { let y = f413(x) 
+ return y + 1 }
+func f415(_ x: Int) -> Int { let y = f414(x) 
+ return y + 1 }
+func f416(_ x: Int) -> Int { let y = f415(x) 
+ return y + 1 }
+func f417(_ x: Int) -> Int { let y = f416(x) 
+ return y + 1 }
+func f418(_ x: Int) -> Int { let y = f417(x) 
+ return y + 1 }
+func f419(_ x: Int) -> Int { let y = f418(x) 
+ return y + 1 }
+func f420(_ x: Int) -> Int { let y = f419(x) 
+ return y + 1 }
+func f421(_ x: Int) -> Int { let y = f420(x) 
+ return y + 1 }
+func f422(_ x: Int) -> Int { let y = f421(x) 
+ return y + 1 }
+func f423(_ x: Int) -> Int { let y = f422(x) 
+ return y + 1 }
+func f424(_ x: Int) -> Int { let y = f423(x) 
+ return y + 1 }
+func f425(_ x: Int) -> Int { let y = f424(x) 
+ return y + 1 }
+func f426(_ x: Int) -> Int { let y = f425(x) 
+ return y + 1 }
+func f427(_ x: Int) -> Int { let y = f426(x) 
+ return y + 1 }
+func f428(_ x: Int) -> Int { let y = f427(x) 
+ return y + 1 }
+func f429(_ x: Int) -> Int { let y = f428(x) 
+ return y + 1 }
+func f430(_ x: Int) -> Int { let y = f429(x) 
+ return y + 1 }
+func f431(_ x: Int) -> Int { let y = f430(x) 
+ return y + 1 }
+func f432(_ x: Int) -> Int { let y = f431(x) 
+ return y + 1 }
+func f433(_ x: Int) -> Int { let y = f432(x) 
+ return y + 1 }
+func f434(_ x: Int) -> Int { let y = f433(x) 
+ return y + 1 }
+func f435(_ x: Int) -> Int { let y = f434(x) 
+ return y + 1 }
+func f436(_ x: Int) -> Int { let y = f435(x) 
+ return y + 1 }
+func f437(_ x: Int) -> Int { let y = f436(x) 
+ return y + 1 }
+func f438(_ x: Int) -> Int { let y = f437(x) 
+ return y + 1 }
+func f439(_ x: Int) -> Int { let y = f438(x) 
+ return y + 1 }
+func f440(_ x: Int) -> Int { let y = f439(x) 
+ return y + 1 }
+func f441(_ x: Int) -> Int { let y = f440(x) 
+ return y + 1 }
+func f442(_ x: Int) -> Int { let y = f441(x) 
+ return y + 1 }
+func f443(_ x: Int) -> Int { let y = f442(x) 
+ return y + 1 }
+func f444(_ x: Int) -> Int { let y = f443(x) 
+ return y + 1 }
+func f445(_ x: Int) -> Int { let y = f444(x) 
+ return y + 1 }
+func f446(_ x: Int) -> Int { let y = f445(x) 
+ return y + 1 }
+func f447(_ x: Int) -> Int { let y = f446(x) 
+ return y + 1 }
+func f448(_ x: Int) -> Int { let y = f447(x) 
+ return y + 1 }
+func f449(_ x: Int) -> Int { let y = f448(x) 
+ return y + 1 }
+func f450(_ x: Int) -> Int { let y = f449(x) 
+ return y + 1 }
+func f451(_ x: Int) -> Int { let y = f450(x) 
+ return y + 1 }
+func f452(_ x: Int) -> Int { let y = f451(x) 
+ return y + 1 }
+func f453(_ x: Int) -> Int { let y = f452(x) 
+ return y + 1 }
+func f454(_ x: Int) -> Int { let y = f453(x) 
+ return y + 1 }
+func f455(_ x: Int) -> Int { let y = f454(x) 
+ return y + 1 }
+func f456(_ x: Int) -> Int { let y = f455(x) 
+ return y + 1 }
+func f457(_ x: Int) -> Int { let y = f456(x) 
+ return y + 1 }
+func f458(_ x: Int) -> Int { let y = f457(x) 
+ return y + 1 }
+func f459(_ x: Int) -> Int { let y = f458(x) 
+ return y + 1 }
+func f460(_ x: Int) -> Int { let y = f459(x) 
+ return y + 1 }
+func f461(_ x: Int) -> Int { let y = f460(x) 
+ return y + 1 }
+func f462(_ x: Int) -> Int { let y = f461(x) 
+ return y + 1 }
+func f463(_ x: Int) -> Int { let y = f462(x) 
+ return y + 1 }
+func f464(_ x: Int) -> Int { let y = f463(x) 
+ return y + 1 }
+func f465(_ x: Int) -> Int { let y = f464(x) 
+ return y + 1 }
+func f466(_ x: Int) -> Int { let y = f465(x) 
+ return y + 1 }
+func f467(_ x: Int) -> Int { let y = f466(x) 
+ return y + 1 }
+func f468(_ x: Int) -> Int { let y = f467(x) 
+ return y + 1 }
+func f469(_ x: Int) -> Int { let y = f468(x) 
+ return y + 1 }
+func f470(_ x: Int) -> Int { let y = f469(x) 
+ return y + 1 }
+func f471(_ x: Int) -> Int { let y = f470(x) 
+ return y + 1 }
+func f472(_ x: Int) -> Int { let y = f471(x) 
+ return y + 1 }
+func f473(_ x: Int) -> Int { let y = f472(x) 
+ return y + 1 }
+func f474(_ x: Int) -> Int { let y = f473(x) 
+ return y + 1 }
+func f475(_ x: Int) -> Int { let y = f474(x) 
+ return y + 1 }
+func f476(_ x: Int) -> Int { let y = f475(x) 
+ return y + 1 }
+func f477(_ x: Int) -> Int { let y = f476(x) 
+ return y + 1 }
+func f478(_ x: Int) -> Int { let y = f477(x) 
+ return y + 1 }
+func f479(_ x: Int) -> Int { let y = f478(x) 
+ return y + 1 }
+func f480(_ x: Int) -> Int { let y = f479(x) 
+ return y + 1 }
+func f481(_ x: Int) -> Int { let y = f480(x) 
+ return y + 1 }
+func f482(_ x: Int) -> Int { let y = f481(x) 
+ return y + 1 }
+func f483(_ x: Int) -> Int { let y = f482(x) 
+ return y + 1 }
+func f484(_ x: Int) -> Int { let y = f483(x) 
+ return y + 1 }
+func f485(_ x: Int) -> Int { let y = f484(x) 
+ return y + 1 }
+func f486(_ x: Int) -> Int { let y = f485(x) 
+ return y + 1 }
+func f487(_ x: Int) -> Int { let y = f486(x) 
+ return y + 1 }
+func f488(_ x: Int) -> Int { let y = f487(x) 
+ return y + 1 }
+func f489(_ x: Int) -> Int { let y = f488(x) 
+ return y + 1 }
+func f490(_ x: Int) -> Int { let y = f489(x) 
+ return y + 1 }
+func f491(_ x: Int) -> Int { let y = f490(x) 
+ return y + 1 }
+func f492(_ x: Int) -> Int { let y = f491(x) 
+ return y + 1 }
+func f493(_ x: Int) -> Int { let y = f492(x) 
+ return y + 1 }
+func f494(_ x: Int) -> Int { let y = f493(x) 
+ return y + 1 }
+func f495(_ x: Int) -> Int { let y = f494(x) 
+ return y + 1 }
+func f496(_ x: Int) -> Int { let y = f495(x) 
+ return y + 1 }
+func f497(_ x: Int) -> Int { let y = f496(x) 
+ return y + 1 }
+func f498(_ x: Int) -> Int { let y = f497(x) 
+ return y + 1 }
+func f499(_ x: Int) -> Int { let y = f498(x) 
+ return y + 1 }
+func f500(_ x: Int) -> Int { let y = f499(x) 
+ return y + 1 }
+func f501(_ x: Int) -> Int { let y = f500(x) 
+ return y + 1 }
+func f502(_ x: Int) -> Int { let y = f501(x) 
+ return y + 1 }
+func f503(_ x: Int) -> Int { let y = f502(x) 
+ return y + 1 }
+func f504(_ x: Int) -> Int { let y = f503(x) 
+ return y + 1 }
+func f505(_ x: Int) -> Int { let y = f504(x) 
+ return y + 1 }
+func f506(_ x: Int) -> Int { let y = f505(x) 
+ return y + 1 }
+func f507(_ x: Int) -> Int { let y = f506(x) 
+ return y + 1 }
+func f508(_ x: Int) -> Int { let y = f507(x) 
+ return y + 1 }
+func f509(_ x: Int) -> Int { let y = f508(x) 
+ return y + 1 }
+func f510(_ x: Int) -> Int { let y = f509(x) 
+ return y + 1 }
+func f511(_ x: Int) -> Int { let y = f510(x) 
+ return y + 1 }
+func f512(_ x: Int) -> Int { let y = f511(x) 
+ return y + 1 }
+func f513(_ x: Int) -> Int { let y = f512(x) 
+ return y + 1 }
+func f514(_ x: Int) -> Int { let y = f513(x) 
+ return y + 1 }
+func f515(_ x: Int) -> Int { let y = f514(x) 
+ return y + 1 }
+func f516(_ x: Int) -> Int { let y = f515(x) 
+ return y + 1 }
+func f517(_ x: Int) -> Int { let y = f516(x) 
+ return y + 1 }
+func f518(_ x: Int) -> Int { let y = f517(x) 
+ return y + 1 }
+func f519(_ x: Int) -> Int { let y = f518(x) 
+ return y + 1 }
+func f520(_ x: Int) -> Int { let y = f519(x) 
+ return y + 1 }
+func f521(_ x: Int) -> Int { let y = f520(x) 
+ return y + 1 }
+func f522(_ x: Int) -> Int { let y = f521(x) 
+ return y + 1 }
+func f523(_ x: Int) -> Int { let y = f522(x) 
+ return y + 1 }
+func f524(_ x: Int) -> Int { let y = f523(x) 
+ return y + 1 }
+func f525(_ x: Int) -> Int { let y = f524(x) 
+ return y + 1 }
+func f526(_ x: Int) -> Int { let y = f525(x) 
+ return y + 1 }
+func f527(_ x: Int) -> Int { let y = f526(x) 
+ return y + 1 }
+func f528(_ x: Int) -> Int { let y = f527(x) 
+ return y + 1 }
+func f529(_ x: Int) -> Int { let y = f528(x) 
+ return y + 1 }
+func f530(_ x: Int) -> Int { let y = f529(x) 
+ return y + 1 }
+func f531(_ x: Int) -> Int { let y = f530(x) 
+ return y + 1 }
+func f532(_ x: Int) -> Int { let y = f531(x) 
+ return y + 1 }
+func f533(_ x: Int) -> Int { let y = f532(x) 
+ return y + 1 }
+func f534(_ x: Int) -> Int { let y = f533(x) 
+ return y + 1 }
+func f535(_ x: Int) -> Int { let y = f534(x) 
+ return y + 1 }
+func f536(_ x: Int) -> Int { let y = f535(x) 
+ return y + 1 }
+func f537(_ x: Int) -> Int { let y = f536(x) 
+ return y + 1 }
+func f538(_ x: Int) -> Int { let y = f537(x) 
+ return y + 1 }
+func f539(_ x: Int) -> Int { let y = f538(x) 
+ return y + 1 }
+func f540(_ x: Int) -> Int { let y = f539(x) 
+ return y + 1 }
+func f541(_ x: Int) -> Int { let y = f540(x) 
+ return y + 1 }
+func f542(_ x: Int) -> Int { let y = f541(x) 
+ return y + 1 }
+func f543(_ x: Int) -> Int { let y = f542(x) 
+ return y + 1 }
+func f544(_ x: Int) -> Int { let y = f543(x) 
+ return y + 1 }
+func f545(_ x: Int) -> Int { let y = f544(x) 
+ return y + 1 }
+func f546(_ x: Int) -> Int { let y = f545(x) 
+ return y + 1 }
+func f547(_ x: Int) -> Int { let y = f546(x) 
+ return y + 1 }
+func f548(_ x: Int) -> Int { let y = f547(x) 
+ return y + 1 }
+func f549(_ x: Int) -> Int { let y = f548(x) 
+ return y + 1 }
+func f550(_ x: Int) -> Int { let y = f549(x) 
+ return y + 1 }
+func f551(_ x: Int) -> Int { let y = f550(x) 
+ return y + 1 }
+func f552(_ x: Int) -> Int { let y = f551(x) 
+ return y + 1 }
+func f553(_ x: Int) -> Int { let y = f552(x) 
+ return y + 1 }
+func f554(_ x: Int) -> Int { let y = f553(x) 
+ return y + 1 }
+func f555(_ x: Int) -> Int { let y = f554(x) 
+ return y + 1 }
+func f556(_ x: Int) -> Int { let y = f555(x) 
+ return y + 1 }
+func f557(_ x: Int) -> Int { let y = f556(x) 
+ return y + 1 }
+func f558(_ x: Int) -> Int { let y = f557(x) 
+ return y + 1 }
+func f559(_ x: Int) -> Int { let y = f558(x) 
+ return y + 1 }
+func f560(_ x: Int) -> Int { let y = f559(x) 
+ return y + 1 }
+func f561(_ x: Int) -> Int { let y = f560(x) 
+ return y + 1 }
+func f562(_ x: Int) -> Int { let y = f561(x) 
+ return y + 1 }
+func f563(_ x: Int) -> Int { let y = f562(x) 
+ return y + 1 }
+func f564(_ x: Int) -> Int { let y = f563(x) 
+ return y + 1 }
+func f565(_ x: Int) -> Int { let y = f564(x) 
+ return y + 1 }
+func f566(_ x: Int) -> Int { let y = f565(x) 
+ return y + 1 }
+func f567(_ x: Int) -> Int { let y = f566(x) 
+ return y + 1 }
+func f568(_ x: Int) -> Int { let y = f567(x) 
+ return y + 1 }
+func f569(_ x: Int) -> Int { let y = f568(x) 
+ return y + 1 }
+func f570(_ x: Int) -> Int { let y = f569(x) 
+ return y + 1 }
+func f571(_ x: Int) -> Int { let y = f570(x) 
+ return y + 1 }
+func f572(_ x: Int) -> Int { let y = f571(x) 
+ return y + 1 }
+func f573(_ x: Int) -> Int { let y = f572(x) 
+ return y + 1 }
+func f574(_ x: Int) -> Int { let y = f573(x) 
+ return y + 1 }
+func f575(_ x: Int) -> Int { let y = f574(x) 
+ return y + 1 }
+func f576(_ x: Int) -> Int { let y = f575(x) 
+ return y + 1 }
+func f577(_ x: Int) -> Int { let y = f576(x) 
+ return y + 1 }
+func f578(_ x: Int) -> Int { let y = f577(x) 
+ return y + 1 }
+func f579(_ x: Int) -> Int { let y = f578(x) 
+ return y + 1 }
+func f580(_ x: Int) -> Int { let y = f579(x) 
+ return y + 1 }
+func f581(_ x: Int) -> Int { let y = f580(x) 
+ return y + 1 }
+func f582(_ x: Int) -> Int { let y = f581(x) 
+ return y + 1 }
+func f583(_ x: Int) -> Int { let y = f582(x) 
+ return y + 1 }
+func f584(_ x: Int) -> Int { let y = f583(x) 
+ return y + 1 }
+func f585(_ x: Int) -> Int { let y = f584(x) 
+ return y + 1 }
+func f586(_ x: Int) -> Int { let y = f585(x) 
+ return y + 1 }
+func f587(_ x: Int) -> Int { let y = f586(x) 
+ return y + 1 }
+func f588(_ x: Int) -> Int { let y = f587(x) 
+ return y + 1 }
+func f589(_ x: Int) -> Int { let y = f588(x) 
+ return y + 1 }
+func f590(_ x: Int) -> Int { let y = f589(x) 
+ return y + 1 }
+func f591(_ x: Int) -> Int { let y = f590(x) 
+ return y + 1 }
+func f592(_ x: Int) -> Int { let y = f591(x) 
+ return y + 1 }
+func f593(_ x: Int) -> Int { let y = f592(x) 
+ return y + 1 }
+func f594(_ x: Int) -> Int { let y = f593(x) 
+ return y + 1 }
+func f595(_ x: Int) -> Int { let y = f594(x) 
+ return y + 1 }
+func f596(_ x: Int) -> Int { let y = f595(x) 
+ return y + 1 }
+func f597(_ x: Int) -> Int { let y = f596(x) 
+ return y + 1 }
+func f598(_ x: Int) -> Int { let y = f597(x) 
+ return y + 1 }
+func f599(_ x: Int) -> Int { let y = f598(x) 
+ return y + 1 }
+func f600(_ x: Int) -> Int { let y = f599(x) 
+ return y + 1 }
+func f601(_ x: Int) -> Int { let y = f600(x) 
+ return y + 1 }
+func f602(_ x: Int) -> Int { let y = f601(x) 
+ return y + 1 }
+func f603(_ x: Int) -> Int { let y = f602(x) 
+ return y + 1 }
+func f604(_ x: Int) -> Int { let y = f603(x) 
+ return y + 1 }
+func f605(_ x: Int) -> Int { let y = f604(x) 
+ return y + 1 }
+func f606(_ x: Int) -> Int { let y = f605(x) 
+ return y + 1 }
+func f607(_ x: Int) -> Int { let y = f606(x) 
+ return y + 1 }
+func f608(_ x: Int) -> Int { let y = f607(x) 
+ return y + 1 }
+func f609(_ x: Int) -> Int { let y = f608(x) 
+ return y + 1 }
+func f610(_ x: Int) -> Int { let y = f609(x) 
+ return y + 1 }
+func f611(_ x: Int) -> Int { let y = f610(x) 
+ return y + 1 }
+func f612(_ x: Int) -> Int { let y = f611(x) 
+ return y + 1 }
+func f613(_ x: Int) -> Int { let y = f612(x) 
+ return y + 1 }
+func f614(_ x: Int) -> Int { let y = f613(x) 
+ return y + 1 }
+func f615(_ x: Int) -> Int { let y = f614(x) 
+ return y + 1 }
+func f616(_ x: Int) -> Int { let y = f615(x) 
+ return y + 1 }
+func f617(_ x: Int) -> Int { let y = f616(x) 
+ return y + 1 }
+func f618(_ x: Int) -> Int { let y = f617(x) 
+ return y + 1 }
+func f619(_ x: Int) -> Int { let y = f618(x) 
+ return y + 1 }
+func f620(_ x: Int) -> Int { let y = f619(x) 
+ return y + 1 }
+func f621(_ x: Int) -> Int { let y = f620(x) 
+ return y + 1 }
+func f622(_ x: Int) -> Int { let y = f621(x) 
+ return y + 1 }
+func f623(_ x: Int) -> Int { let y = f622(x) 
+ return y + 1 }
+func f624(_ x: Int) -> Int { let y = f623(x) 
+ return y + 1 }
+func f625(_ x: Int) -> Int { let y = f624(x) 
+ return y + 1 }
+func f626(_ x: Int) -> Int { let y = f625(x) 
+ return y + 1 }
+func f627(_ x: Int) -> Int { let y = f626(x) 
+ return y + 1 }
+func f628(_ x: Int) -> Int { let y = f627(x) 
+ return y + 1 }
+func f629(_ x: Int) -> Int { let y = f628(x) 
+ return y + 1 }
+func f630(_ x: Int) -> Int { let y = f629(x) 
+ return y + 1 }
+func f631(_ x: Int) -> Int { let y = f630(x) 
+ return y + 1 }
+func f632(_ x: Int) -> Int { let y = f631(x) 
+ return y + 1 }
+func f633(_ x: Int) -> Int { let y = f632(x) 
+ return y + 1 }
+func f634(_ x: Int) -> Int { let y = f633(x) 
+ return y + 1 }
+func f635(_ x: Int) -> Int { let y = f634(x) 
+ return y + 1 }
+func f636(_ x: Int) -> Int { let y = f635(x) 
+ return y + 1 }
+func f637(_ x: Int) -> Int { let y = f636(x) 
+ return y + 1 }
+func f638(_ x: Int) -> Int { let y = f637(x) 
+ return y + 1 }
+func f639(_ x: Int) -> Int { let y = f638(x) 
+ return y + 1 }
+func f640(_ x: Int) -> Int { let y = f639(x) 
+ return y + 1 }
+func f641(_ x: Int) -> Int { let y = f640(x) 
+ return y + 1 }
+func f642(_ x: Int) -> Int { let y = f641(x) 
+ return y + 1 }
+func f643(_ x: Int) -> Int { let y = f642(x) 
+ return y + 1 }
+func f644(_ x: Int) -> Int { let y = f643(x) 
+ return y + 1 }
+func f645(_ x: Int) -> Int { let y = f644(x) 
+ return y + 1 }
+func f646(_ x: Int) -> Int { let y = f645(x) 
+ return y + 1 }
+func f647(_ x: Int) -> Int { let y = f646(x) 
+ return y + 1 }
+func f648(_ x: Int) -> Int { let y = f647(x) 
+ return y + 1 }
+func f649(_ x: Int) -> Int { let y = f648(x) 
+ return y + 1 }
+func f650(_ x: Int) -> Int { let y = f649(x) 
+ return y + 1 }
+func f651(_ x: Int) -> Int { let y = f650(x) 
+ return y + 1 }
+func f652(_ x: Int) -> Int { let y = f651(x) 
+ return y + 1 }
+func f653(_ x: Int) -> Int { let y = f652(x) 
+ return y + 1 }
+func f654(_ x: Int) -> Int { let y = f653(x) 
+ return y + 1 }
+func f655(_ x: Int) -> Int { let y = f654(x) 
+ return y + 1 }
+func f656(_ x: Int) -> Int { let y = f655(x) 
+ return y + 1 }
+func f657(_ x: Int) -> Int { let y = f656(x) 
+ return y + 1 }
+func f658(_ x: Int) -> Int { let y = f657(x) 
+ return y + 1 }
+func f659(_ x: Int) -> Int { let y = f658(x) 
+ return y + 1 }
+func f660(_ x: Int) -> Int { let y = f659(x) 
+ return y + 1 }
+func f661(_ x: Int) -> Int { let y = f660(x) 
+ return y + 1 }
+func f662(_ x: Int) -> Int { let y = f661(x) 
+ return y + 1 }
+func f663(_ x: Int) -> Int { let y = f662(x) 
+ return y + 1 }
+func f664(_ x: Int) -> Int { let y = f663(x) 
+ return y + 1 }
+func f665(_ x: Int) -> Int { let y = f664(x) 
+ return y + 1 }
+func f666(_ x: Int) -> Int { let y = f665(x) 
+ return y + 1 }
+func f667(_ x: Int) -> Int { let y = f666(x) 
+ return y + 1 }
+func f668(_ x: Int) -> Int { let y = f667(x) 
+ return y + 1 }
+func f669(_ x: Int) -> Int { let y = f668(x) 
+ return y + 1 }
+func f670(_ x: Int) -> Int { let y = f669(x) 
+ return y + 1 }
+func f671(_ x: Int) -> Int { let y = f670(x) 
+ return y + 1 }
+func f672(_ x: Int) -> Int { let y = f671(x) 
+ return y + 1 }
+func f673(_ x: Int) -> Int { let y = f672(x) 
+ return y + 1 }
+func f674(_ x: Int) -> Int { let y = f673(x) 
+ return y + 1 }
+func f675(_ x: Int) -> Int { let y = f674(x) 
+ return y + 1 }
+func f676(_ x: Int) -> Int { let y = f675(x) 
+ return y + 1 }
+func f677(_ x: Int) -> Int { let y = f676(x) 
+ return y + 1 }
+func f678(_ x: Int) -> Int { let y = f677(x) 
+ return y + 1 }
+func f679(_ x: Int) -> Int { let y = f678(x) 
+ return y + 1 }
+func f680(_ x: Int) -> Int { let y = f679(x) 
+ return y + 1 }
+func f681(_ x: Int) -> Int { let y = f680(x) 
+ return y + 1 }
+func f682(_ x: Int) -> Int { let y = f681(x) 
+ return y + 1 }
+func f683(_ x: Int) -> Int { let y = f682(x) 
+ return y + 1 }
+func f684(_ x: Int) -> Int { let y = f683(x) 
+ return y + 1 }
+func f685(_ x: Int) -> Int { let y = f684(x) 
+ return y + 1 }
+func f686(_ x: Int) -> Int { let y = f685(x) 
+ return y + 1 }
+func f687(_ x: Int) -> Int { let y = f686(x) 
+ return y + 1 }
+func f688(_ x: Int) -> Int { let y = f687(x) 
+ return y + 1 }
+func f689(_ x: Int) -> Int { let y = f688(x) 
+ return y + 1 }
+func f690(_ x: Int) -> Int { let y = f689(x) 
+ return y + 1 }
+func f691(_ x: Int) -> Int { let y = f690(x) 
+ return y + 1 }
+func f692(_ x: Int) -> Int { let y = f691(x) 
+ return y + 1 }
+func f693(_ x: Int) -> Int { let y = f692(x) 
+ return y + 1 }
+func f694(_ x: Int) -> Int { let y = f693(x) 
+ return y + 1 }
+func f695(_ x: Int) -> Int { let y = f694(x) 
+ return y + 1 }
+func f696(_ x: Int) -> Int { let y = f695(x) 
+ return y + 1 }
+func f697(_ x: Int) -> Int { let y = f696(x) 
+ return y + 1 }
+func f698(_ x: Int) -> Int { let y = f697(x) 
+ return y + 1 }
+func f699(_ x: Int) -> Int { let y = f698(x) 
+ return y + 1 }
+func f700(_ x: Int) -> Int { let y = f699(x) 
+ return y + 1 }
+func f701(_ x: Int) -> Int { let y = f700(x) 
+ return y + 1 }
+func f702(_ x: Int) -> Int { let y = f701(x) 
+ return y + 1 }
+func f703(_ x: Int) -> Int { let y = f702(x) 
+ return y + 1 }
+func f704(_ x: Int) -> Int { let y = f703(x) 
+ return y + 1 }
+func f705(_ x: Int) -> Int { let y = f704(x) 
+ return y + 1 }
+func f706(_ x: Int) -> Int { let y = f705(x) 
+ return y + 1 }
+func f707(_ x: Int) -> Int { let y = f706(x) 
+ return y + 1 }
+func f708(_ x: Int) -> Int { let y = f707(x) 
+ return y + 1 }
+func f709(_ x: Int) -> Int { let y = f708(x) 
+ return y + 1 }
+func f710(_ x: Int) -> Int { let y = f709(x) 
+ return y + 1 }
+func f711(_ x: Int) -> Int { let y = f710(x) 
+ return y + 1 }
+func f712(_ x: Int) -> Int { let y = f711(x) 
+ return y + 1 }
+func f713(_ x: Int) -> Int { let y = f712(x) 
+ return y + 1 }
+func f714(_ x: Int) -> Int { let y = f713(x) 
+ return y + 1 }
+func f715(_ x: Int) -> Int { let y = f714(x) 
+ return y + 1 }
+func f716(_ x: Int) -> Int { let y = f715(x) 
+ return y + 1 }
+func f717(_ x: Int) -> Int { let y = f716(x) 
+ return y + 1 }
+func f718(_ x: Int) -> Int { let y = f717(x) 
+ return y + 1 }
+func f719(_ x: Int) -> Int { let y = f718(x) 
+ return y + 1 }
+func f720(_ x: Int) -> Int { let y = f719(x) 
+ return y + 1 }
+func f721(_ x: Int) -> Int { let y = f720(x) 
+ return y + 1 }
+func f722(_ x: Int) -> Int { let y = f721(x) 
+ return y + 1 }
+func f723(_ x: Int) -> Int { let y = f722(x) 
+ return y + 1 }
+func f724(_ x: Int) -> Int { let y = f723(x) 
+ return y + 1 }
+func f725(_ x: Int) -> Int { let y = f724(x) 
+ return y + 1 }
+func f726(_ x: Int) -> Int { let y = f725(x) 
+ return y + 1 }
+func f727(_ x: Int) -> Int { let y = f726(x) 
+ return y + 1 }
+func f728(_ x: Int) -> Int { let y = f727(x) 
+ return y + 1 }
+func f729(_ x: Int) -> Int { let y = f728(x) 
+ return y + 1 }
+func f730(_ x: Int) -> Int { let y = f729(x) 
+ return y + 1 }
+func f731(_ x: Int) -> Int { let y = f730(x) 
+ return y + 1 }
+func f732(_ x: Int) -> Int { let y = f731(x) 
+ return y + 1 }
+func f733(_ x: Int) -> Int { let y = f732(x) 
+ return y + 1 }
+func f734(_ x: Int) -> Int { let y = f733(x) 
+ return y + 1 }
+func f735(_ x: Int) -> Int { let y = f734(x) 
+ return y + 1 }
+func f736(_ x: Int) -> Int { let y = f735(x) 
+ return y + 1 }
+func f737(_ x: Int) -> Int { let y = f736(x) 
+ return y + 1 }
+func f738(_ x: Int) -> Int { let y = f737(x) 
+ return y + 1 }
+func f739(_ x: Int) -> Int { let y = f738(x) 
+ return y + 1 }
+func f740(_ x: Int) -> Int { let y = f739(x) 
+ return y + 1 }
+func f741(_ x: Int) -> Int { let y = f740(x) 
+ return y + 1 }
+func f742(_ x: Int) -> Int { let y = f741(x) 
+ return y + 1 }
+func f743(_ x: Int) -> Int { let y = f742(x) 
+ return y + 1 }
+func f744(_ x: Int) -> Int { let y = f743(x) 
+ return y + 1 }
+func f745(_ x: Int) -> Int { let y = f744(x) 
+ return y + 1 }
+func f746(_ x: Int) -> Int { let y = f745(x) 
+ return y + 1 }
+func f747(_ x: Int) -> Int { let y = f746(x) 
+ return y + 1 }
+func f748(_ x: Int) -> Int { let y = f747(x) 
+ return y + 1 }
+func f749(_ x: Int) -> Int { let y = f748(x) 
+ return y + 1 }
+func f750(_ x: Int) -> Int { let y = f749(x) 
+ return y + 1 }
+func f751(_ x: Int) -> Int { let y = f750(x) 
+ return y + 1 }
+func f752(_ x: Int) -> Int { let y = f751(x) 
+ return y + 1 }
+func f753(_ x: Int) -> Int { let y = f752(x) 
+ return y + 1 }
+func f754(_ x: Int) -> Int { let y = f753(x) 
+ return y + 1 }
+func f755(_ x: Int) -> Int { let y = f754(x) 
+ return y + 1 }
+func f756(_ x: Int) -> Int { let y = f755(x) 
+ return y + 1 }
+func f757(_ x: Int) -> Int { let y = f756(x) 
+ return y + 1 }
+func f758(_ x: Int) -> Int { let y = f757(x) 
+ return y + 1 }
+func f759(_ x: Int) -> Int { let y = f758(x) 
+ return y + 1 }
+func f760(_ x: Int) -> Int { let y = f759(x) 
+ return y + 1 }
+func f761(_ x: Int) -> Int { let y = f760(x) 
+ return y + 1 }
+func f762(_ x: Int) -> Int { let y = f761(x) 
+ return y + 1 }
+func f763(_ x: Int) -> Int { let y = f762(x) 
+ return y + 1 }
+func f764(_ x: Int) -> Int { let y = f763(x) 
+ return y + 1 }
+func f765(_ x: Int) -> Int { let y = f764(x) 
+ return y + 1 }
+func f766(_ x: Int) -> Int { let y = f765(x) 
+ return y + 1 }
+func f767(_ x: Int) -> Int { let y = f766(x) 
+ return y + 1 }
+func f768(_ x: Int) -> Int { let y = f767(x) 
+ return y + 1 }
+func f769(_ x: Int) -> Int { let y = f768(x) 
+ return y + 1 }
+func f770(_ x: Int) -> Int { let y = f769(x) 
+ return y + 1 }
+func f771(_ x: Int) -> Int { let y = f770(x) 
+ return y + 1 }
+func f772(_ x: Int) -> Int { let y = f771(x) 
+ return y + 1 }
+func f773(_ x: Int) -> Int { let y = f772(x) 
+ return y + 1 }
+func f774(_ x: Int) -> Int { let y = f773(x) 
+ return y + 1 }
+func f775(_ x: Int) -> Int { let y = f774(x) 
+ return y + 1 }
+func f776(_ x: Int) -> Int { let y = f775(x) 
+ return y + 1 }
+func f777(_ x: Int) -> Int { let y = f776(x) 
+ return y + 1 }
+func f778(_ x: Int) -> Int { let y = f777(x) 
+ return y + 1 }
+func f779(_ x: Int) -> Int { let y = f778(x) 
+ return y + 1 }
+func f780(_ x: Int) -> Int { let y = f779(x) 
+ return y + 1 }
+func f781(_ x: Int) -> Int { let y = f780(x) 
+ return y + 1 }
+func f782(_ x: Int) -> Int { let y = f781(x) 
+ return y + 1 }
+func f783(_ x: Int) -> Int { let y = f782(x) 
+ return y + 1 }
+func f784(_ x: Int) -> Int { let y = f783(x) 
+ return y + 1 }
+func f785(_ x: Int) -> Int { let y = f784(x) 
+ return y + 1 }
+func f786(_ x: Int) -> Int { let y = f785(x) 
+ return y + 1 }
+func f787(_ x: Int) -> Int { let y = f786(x) 
+ return y + 1 }
+func f788(_ x: Int) -> Int { let y = f787(x) 
+ return y + 1 }
+func f789(_ x: Int) -> Int { let y = f788(x) 
+ return y + 1 }
+func f790(_ x: Int) -> Int { let y = f789(x) 
+ return y + 1 }
+func f791(_ x: Int) -> Int { let y = f790(x) 
+ return y + 1 }
+func f792(_ x: Int) -> Int { let y = f791(x) 
+ return y + 1 }
+func f793(_ x: Int) -> Int { let y = f792(x) 
+ return y + 1 }
+func f794(_ x: Int) -> Int { let y = f793(x) 
+ return y + 1 }
+func f795(_ x: Int) -> Int { let y = f794(x) 
+ return y + 1 }
+func f796(_ x: Int) -> Int { let y = f795(x) 
+ return y + 1 }
+func f797(_ x: Int) -> Int { let y = f796(x) 
+ return y + 1 }
+func f798(_ x: Int) -> Int { let y = f797(x) 
+ return y + 1 }
+func f799(_ x: Int) -> Int { let y = f798(x) 
+ return y + 1 }
+func f800(_ x: Int) -> Int { let y = f799(x) 
+ return y + 1 }
+func f801(_ x: Int) -> Int { let y = f800(x) 
+ return y + 1 }
+func f802(_ x: Int) -> Int { let y = f801(x) 
+ return y + 1 }
+func f803(_ x: Int) -> Int { let y = f802(x) 
+ return y + 1 }
+func f804(_ x: Int) -> Int { let y = f803(x) 
+ return y + 1 }
+func f805(_ x: Int) -> Int { let y = f804(x) 
+ return y + 1 }
+func f806(_ x: Int) -> Int { let y = f805(x) 
+ return y + 1 }
+func f807(_ x: Int) -> Int { let y = f806(x) 
+ return y + 1 }
+func f808(_ x: Int) -> Int { let y = f807(x) 
+ return y + 1 }
+func f809(_ x: Int) -> Int { let y = f808(x) 
+ return y + 1 }
+func f810(_ x: Int) -> Int { let y = f809(x) 
+ return y + 1 }
+func f811(_ x: Int) -> Int { let y = f810(x) 
+ return y + 1 }
+func f812(_ x: Int) -> Int { let y = f811(x) 
+ return y + 1 }
+func f813(_ x: Int) -> Int { let y = f812(x) 
+ return y + 1 }
+func f814(_ x: Int) -> Int { let y = f813(x) 
+ return y + 1 }
+func f815(_ x: Int) -> Int { let y = f814(x) 
+ return y + 1 }
+func f816(_ x: Int) -> Int { let y = f815(x) 
+ return y + 1 }
+func f817(_ x: Int) -> Int { let y = f816(x) 
+ return y + 1 }
+func f818(_ x: Int) -> Int { let y = f817(x) 
+ return y + 1 }
+func f819(_ x: Int) -> Int { let y = f818(x) 
+ return y + 1 }
+func f820(_ x: Int) -> Int { let y = f819(x) 
+ return y + 1 }
+func f821(_ x: Int) -> Int { let y = f820(x) 
+ return y + 1 }
+func f822(_ x: Int) -> Int { let y = f821(x) 
+ return y + 1 }
+func f823(_ x: Int) -> Int { let y = f822(x) 
+ return y + 1 }
+func f824(_ x: Int) -> Int { let y = f823(x) 
+ return y + 1 }
+func f825(_ x: Int) -> Int { let y = f824(x) 
+ return y + 1 }
+func f826(_ x: Int) -> Int { let y = f825(x) 
+ return y + 1 }
+func f827(_ x: Int) -> Int { let y = f826(x) 
+ return y + 1 }
+func f828(_ x: Int) -> Int { let y = f827(x) 
+ return y + 1 }
+func f829(_ x: Int) -> Int { let y = f828(x) 
+ return y + 1 }
+func f830(_ x: Int) -> Int { let y = f829(x) 
+ return y + 1 }
+func f831(_ x: Int) -> Int { let y = f830(x) 
+ return y + 1 }
+func f832(_ x: Int) -> Int { let y = f831(x) 
+ return y + 1 }
+func f833(_ x: Int) -> Int { let y = f832(x) 
+ return y + 1 }
+func f834(_ x: Int) -> Int { let y = f833(x) 
+ return y + 1 }
+func f835(_ x: Int) -> Int { let y = f834(x) 
+ return y + 1 }
+func f836(_ x: Int) -> Int { let y = f835(x) 
+ return y + 1 }
+func f837(_ x: Int) -> Int { let y = f836(x) 
+ return y + 1 }
+func f838(_ x: Int) -> Int { let y = f837(x) 
+ return y + 1 }
+func f839(_ x: Int) -> Int { let y = f838(x) 
+ return y + 1 }
+func f840(_ x: Int) -> Int { let y = f839(x) 
+ return y + 1 }
+func f841(_ x: Int) -> Int { let y = f840(x) 
+ return y + 1 }
+func f842(_ x: Int) -> Int { let y = f841(x) 
+ return y + 1 }
+func f843(_ x: Int) -> Int { let y = f842(x) 
+ return y + 1 }
+func f844(_ x: Int) -> Int { let y = f843(x) 
+ return y + 1 }
+func f845(_ x: Int) -> Int { let y = f844(x) 
+ return y + 1 }
+func f846(_ x: Int) -> Int { let y = f845(x) 
+ return y + 1 }
+func f847(_ x: Int) -> Int { let y = f846(x) 
+ return y + 1 }
+func f848(_ x: Int) -> Int { let y = f847(x) 
+ return y + 1 }
+func f849(_ x: Int) -> Int { let y = f848(x) 
+ return y + 1 }
+func f850(_ x: Int) -> Int { let y = f849(x) 
+ return y + 1 }
+func f851(_ x: Int) -> Int { let y = f850(x) 
+ return y + 1 }
+func f852(_ x: Int) -> Int { let y = f851(x) 
+ return y + 1 }
+func f853(_ x: Int) -> Int { let y = f852(x) 
+ return y + 1 }
+func f854(_ x: Int) -> Int { let y = f853(x) 
+ return y + 1 }
+func f855(_ x: Int) -> Int { let y = f854(x) 
+ return y + 1 }
+func f856(_ x: Int) -> Int { let y = f855(x) 
+ return y + 1 }
+func f857(_ x: Int) -> Int { let y = f856(x) 
+ return y + 1 }
+func f858(_ x: Int) -> Int { let y = f857(x) 
+ return y + 1 }
+func f859(_ x: Int) -> Int { let y = f858(x) 
+ return y + 1 }
+func f860(_ x: Int) -> Int { let y = f859(x) 
+ return y + 1 }
+func f861(_ x: Int) -> Int { let y = f860(x) 
+ return y + 1 }
+func f862(_ x: Int) -> Int { let y = f861(x) 
+ return y + 1 }
+func f863(_ x: Int) -> Int { let y = f862(x) 
+ return y + 1 }
+func f864(_ x: Int) -> Int { let y = f863(x) 
+ return y + 1 }
+func f865(_ x: Int) -> Int { let y = f864(x) 
+ return y + 1 }
+func f866(_ x: Int) -> Int { let y = f865(x) 
+ return y + 1 }
+func f867(_ x: Int) -> Int { let y = f866(x) 
+ return y + 1 }
+func f868(_ x: Int) -> Int { let y = f867(x) 
+ return y + 1 }
+func f869(_ x: Int) -> Int { let y = f868(x) 
+ return y + 1 }
+func f870(_ x: Int) -> Int { let y = f869(x) 
+ return y + 1 }
+func f871(_ x: Int) -> Int { let y = f870(x) 
+ return y + 1 }
+func f872(_ x: Int) -> Int { let y = f871(x) 
+ return y + 1 }
+func f873(_ x: Int) -> Int { let y = f872(x) 
+ return y + 1 }
+func f874(_ x: Int) -> Int { let y = f873(x) 
+ return y + 1 }
+func f875(_ x: Int) -> Int { let y = f874(x) 
+ return y + 1 }
+func f876(_ x: Int) -> Int { let y = f875(x) 
+ return y + 1 }
+func f877(_ x: Int) -> Int { let y = f876(x) 
+ return y + 1 }
+func f878(_ x: Int) -> Int { let y = f877(x) 
+ return y + 1 }
+func f879(_ x: Int) -> Int { let y = f878(x) 
+ return y + 1 }
+func f880(_ x: Int) -> Int { let y = f879(x) 
+ return y + 1 }
+func f881(_ x: Int) -> Int { let y = f880(x) 
+ return y + 1 }
+func f882(_ x: Int) -> Int { let y = f881(x) 
+ return y + 1 }
+func f883(_ x: Int) -> Int { let y = f882(x) 
+ return y + 1 }
+func f884(_ x: Int) -> Int { let y = f883(x) 
+ return y + 1 }
+func f885(_ x: Int) -> Int { let y = f884(x) 
+ return y + 1 }
+func f886(_ x: Int) -> Int { let y = f885(x) 
+ return y + 1 }
+func f887(_ x: Int) -> Int { let y = f886(x) 
+ return y + 1 }
+func f888(_ x: Int) -> Int { let y = f887(x) 
+ return y + 1 }
+func f889(_ x: Int) -> Int { let y = f888(x) 
+ return y + 1 }
+func f890(_ x: Int) -> Int { let y = f889(x) 
+ return y + 1 }
+func f891(_ x: Int) -> Int { let y = f890(x) 
+ return y + 1 }
+func f892(_ x: Int) -> Int { let y = f891(x) 
+ return y + 1 }
+func f893(_ x: Int) -> Int { let y = f892(x) 
+ return y + 1 }
+func f894(_ x: Int) -> Int { let y = f893(x) 
+ return y + 1 }
+func f895(_ x: Int) -> Int { let y = f894(x) 
+ return y + 1 }
+func f896(_ x: Int) -> Int { let y = f895(x) 
+ return y + 1 }
+func f897(_ x: Int) -> Int { let y = f896(x) 
+ return y + 1 }
+func f898(_ x: Int) -> Int { let y = f897(x) 
+ return y + 1 }
+func f899(_ x: Int) -> Int { let y = f898(x) 
+ return y + 1 }
+func f900(_ x: Int) -> Int { let y = f899(x) 
+ return y + 1 }
+func f901(_ x: Int) -> Int { let y = f900(x) 
+ return y + 1 }
+func f902(_ x: Int) -> Int { let y = f901(x) 
+ return y + 1 }
+func f903(_ x: Int) -> Int { let y = f902(x) 
+ return y + 1 }
+func f904(_ x: Int) -> Int { let y = f903(x) 
+ return y + 1 }
+func f905(_ x: Int) -> Int { let y = f904(x) 
+ return y + 1 }
+func f906(_ x: Int) -> Int { let y = f905(x) 
+ return y + 1 }
+func f907(_ x: Int) -> Int { let y = f906(x) 
+ return y + 1 }
+func f908(_ x: Int) -> Int { let y = f907(x) 
+ return y + 1 }
+func f909(_ x: Int) -> Int { let y = f908(x) 
+ return y + 1 }
+func f910(_ x: Int) -> Int { let y = f909(x) 
+ return y + 1 }
+func f911(_ x: Int) -> Int { let y = f910(x) 
+ return y + 1 }
+func f912(_ x: Int) -> Int { let y = f911(x) 
+ return y + 1 }
+func f913(_ x: Int) -> Int { let y = f912(x) 
+ return y + 1 }
+func f914(_ x: Int) -> Int { let y = f913(x) 
+ return y + 1 }
+func f915(_ x: Int) -> Int { let y = f914(x) 
+ return y + 1 }
+func f916(_ x: Int) -> Int { let y = f915(x) 
+ return y + 1 }
+func f917(_ x: Int) -> Int { let y = f916(x) 
+ return y + 1 }
+func f918(_ x: Int) -> Int { let y = f917(x) 
+ return y + 1 }
+func f919(_ x: Int) -> Int { let y = f918(x) 
+ return y + 1 }
+func f920(_ x: Int) -> Int { let y = f919(x) 
+ return y + 1 }
+func f921(_ x: Int) -> Int { let y = f920(x) 
+ return y + 1 }
+func f922(_ x: Int) -> Int { let y = f921(x) 
+ return y + 1 }
+func f923(_ x: Int) -> Int { let y = f922(x) 
+ return y + 1 }
+func f924(_ x: Int) -> Int { let y = f923(x) 
+ return y + 1 }
+func f925(_ x: Int) -> Int { let y = f924(x) 
+ return y + 1 }
+func f926(_ x: Int) -> Int { let y = f925(x) 
+ return y + 1 }
+func f927(_ x: Int) -> Int { let y = f926(x) 
+ return y + 1 }
+func f928(_ x: Int) -> Int { let y = f927(x) 
+ return y + 1 }
+func f929(_ x: Int) -> Int { let y = f928(x) 
+ return y + 1 }
+func f930(_ x: Int) -> Int { let y = f929(x) 
+ return y + 1 }
+func f931(_ x: Int) -> Int { let y = f930(x) 
+ return y + 1 }
+func f932(_ x: Int) -> Int { let y = f931(x) 
+ return y + 1 }
+func f933(_ x: Int) -> Int { let y = f932(x) 
+ return y + 1 }
+func f934(_ x: Int) -> Int { let y = f933(x) 
+ return y + 1 }
+func f935(_ x: Int) -> Int { let y = f934(x) 
+ return y + 1 }
+func f936(_ x: Int) -> Int { let y = f935(x) 
+ return y + 1 }
+func f937(_ x: Int) -> Int { let y = f936(x) 
+ return y + 1 }
+func f938(_ x: Int) -> Int { let y = f937(x) 
+ return y + 1 }
+func f939(_ x: Int) -> Int { let y = f938(x) 
+ return y + 1 }
+func f940(_ x: Int) -> Int { let y = f939(x) 
+ return y + 1 }
+func f941(_ x: Int) -> Int { let y = f940(x) 
+ return y + 1 }
+func f942(_ x: Int) -> Int { let y = f941(x) 
+ return y + 1 }
+func f943(_ x: Int) -> Int { let y = f942(x) 
+ return y + 1 }
+func f944(_ x: Int) -> Int { let y = f943(x) 
+ return y + 1 }
+func f945(_ x: Int) -> Int { let y = f944(x) 
+ return y + 1 }
+func f946(_ x: Int) -> Int { let y = f945(x) 
+ return y + 1 }
+func f947(_ x: Int) -> Int { let y = f946(x) 
+ return y + 1 }
+func f948(_ x: Int) -> Int { let y = f947(x) 
+ return y + 1 }
+func f949(_ x: Int) -> Int { let y = f948(x) 
+ return y + 1 }
+func f950(_ x: Int) -> Int { let y = f949(x) 
+ return y + 1 }
+func f951(_ x: Int) -> Int { let y = f950(x) 
+ return y + 1 }
+func f952(_ x: Int) -> Int { let y = f951(x) 
+ return y + 1 }
+func f953(_ x: Int) -> Int { let y = f952(x) 
+ return y + 1 }
+func f954(_ x: Int) -> Int { let y = f953(x) 
+ return y + 1 }
+func f955(_ x: Int) -> Int { let y = f954(x) 
+ return y + 1 }
+func f956(_ x: Int) -> Int { let y = f955(x) 
+ return y + 1 }
+func f957(_ x: Int) -> Int { let y = f956(x) 
+ return y + 1 }
+func f958(_ x: Int) -> Int { let y = f957(x) 
+ return y + 1 }
+func f959(_ x: Int) -> Int { let y = f958(x) 
+ return y + 1 }
+func f960(_ x: Int) -> Int { let y = f959(x) 
+ return y + 1 }
+func f961(_ x: Int) -> Int { let y = f960(x) 
+ return y + 1 }
+func f962(_ x: Int) -> Int { let y = f961(x) 
+ return y + 1 }
+func f963(_ x: Int) -> Int { let y = f962(x) 
+ return y + 1 }
+func f964(_ x: Int) -> Int { let y = f963(x) 
+ return y + 1 }
+func f965(_ x: Int) -> Int { let y = f964(x) 
+ return y + 1 }
+func f966(_ x: Int) -> Int { let y = f965(x) 
+ return y + 1 }
+func f967(_ x: Int) -> Int { let y = f966(x) 
+ return y + 1 }
+func f968(_ x: Int) -> Int { let y = f967(x) 
+ return y + 1 }
+func f969(_ x: Int) -> Int { let y = f968(x) 
+ return y + 1 }
+func f970(_ x: Int) -> Int { let y = f969(x) 
+ return y + 1 }
+func f971(_ x: Int) -> Int { let y = f970(x) 
+ return y + 1 }
+func f972(_ x: Int) -> Int { let y = f971(x) 
+ return y + 1 }
+func f973(_ x: Int) -> Int { let y = f972(x) 
+ return y + 1 }
+func f974(_ x: Int) -> Int { let y = f973(x) 
+ return y + 1 }
+func f975(_ x: Int) -> Int { let y = f974(x) 
+ return y + 1 }
+func f976(_ x: Int) -> Int { let y = f975(x) 
+ return y + 1 }
+func f977(_ x: Int) -> Int { let y = f976(x) 
+ return y + 1 }
+func f978(_ x: Int) -> Int { let y = f977(x) 
+ return y + 1 }
+func f979(_ x: Int) -> Int { let y = f978(x) 
+ return y + 1 }
+func f980(_ x: Int) -> Int { let y = f979(x) 
+ return y + 1 }
+func f981(_ x: Int) -> Int { let y = f980(x) 
+ return y + 1 }
+func f982(_ x: Int) -> Int { let y = f981(x) 
+ return y + 1 }
+func f983(_ x: Int) -> Int { let y = f982(x) 
+ return y + 1 }
+func f984(_ x: Int) -> Int { let y = f983(x) 
+ return y + 1 }
+func f985(_ x: Int) -> Int { let y = f984(x) 
+ return y + 1 }
+func f986(_ x: Int) -> Int { let y = f985(x) 
+ return y + 1 }
+func f987(_ x: Int) -> Int { let y = f986(x) 
+ return y + 1 }
+func f988(_ x: Int) -> Int { let y = f987(x) 
+ return y + 1 }
+func f989(_ x: Int) -> Int { let y = f988(x) 
+ return y + 1 }
+func f990(_ x: Int) -> Int { let y = f989(x) 
+ return y + 1 }
+func f991(_ x: Int) -> Int { let y = f990(x) 
+ return y + 1 }
+func f992(_ x: Int) -> Int { let y = f991(x) 
+ return y + 1 }
+func f993(_ x: Int) -> Int { let y = f992(x) 
+ return y + 1 }
+func f994(_ x: Int) -> Int { let y = f993(x) 
+ return y + 1 }
+func f995(_ x: Int) -> Int { let y = f994(x) 
+ return y + 1 }
+func f996(_ x: Int) -> Int { let y = f995(x) 
+ return y + 1 }
+func f997(_ x: Int) -> Int { let y = f996(x) 
+ return y + 1 }
+func f998(_ x: Int) -> Int { let y = f997(x) 
+ return y + 1 }
+func f999(_ x: Int) -> Int { let y = f998(x) 
+ return y + 1 }
+func f1000(_ x: Int) -> Int { let y = f999(x) 
+ return y + 1 }
+func f1001(_ x: Int) -> Int { let y = f1000(x) 
+ return y + 1 }
+func f1002(_ x: Int) -> Int { let y = f1001(x) 
+ return y + 1 }
+func f1003(_ x: Int) -> Int { let y = f1002(x) 
+ return y + 1 }
+func f1004(_ x: Int) -> Int { let y = f1003(x) 
+ return y + 1 }
+func f1005(_ x: Int) -> Int { let y = f1004(x) 
+ return y + 1 }
+func f1006(_ x: Int) -> Int { let y = f1005(x) 
+ return y + 1 }
+func f1007(_ x: Int) -> Int { let y = f1006(x) 
+ return y + 1 }
+func f1008(_ x: Int) -> Int { let y = f1007(x) 
+ return y + 1 }
+func f1009(_ x: Int) -> Int { let y = f1008(x) 
+ return y + 1 }
+func f1010(_ x: Int) -> Int { let y = f1009(x) 
+ return y + 1 }
+func f1011(_ x: Int) -> Int { let y = f1010(x) 
+ return y + 1 }
+func f1012(_ x: Int) -> Int { let y = f1011(x) 
+ return y + 1 }
+func f1013(_ x: Int) -> Int { let y = f1012(x) 
+ return y + 1 }
+func f1014(_ x: Int) -> Int { let y = f1013(x) 
+ return y + 1 }
+func f1015(_ x: Int) -> Int { let y = f1014(x) 
+ return y + 1 }
+func f1016(_ x: Int) -> Int { let y = f1015(x) 
+ return y + 1 }
+func f1017(_ x: Int) -> Int { let y = f1016(x) 
+ return y + 1 }
+func f1018(_ x: Int) -> Int { let y = f1017(x) 
+ return y + 1 }
+func f1019(_ x: Int) -> Int { let y = f1018(x) 
+ return y + 1 }
+func f1020(_ x: Int) -> Int { let y = f1019(x) 
+ return y + 1 }
+func f1021(_ x: Int) -> Int { let y = f1020(x) 
+ return y + 1 }
+func f1022(_ x: Int) -> Int { let y = f1021(x) 
+ return y + 1 }
+func f1023(_ x: Int) -> Int { let y = f1022(x) 
+ return y + 1 }
+func f1024(_ x: Int) -> Int { let y = f1023(x) 
+ return y + 1 }
+func f1025(_ x: Int) -> Int { let y = f1024(x) 
+ return y + 1 }
+func f1026(_ x: Int) -> Int { let y = f1025(x) 
+ return y + 1 }
+func f1027(_ x: Int) -> Int { let y = f1026(x) 
+ return y + 1 }
+func f1028(_ x: Int) -> Int { let y = f1027(x) 
+ return y + 1 }
+func f1029(_ x: Int) -> Int { let y = f1028(x) 
+ return y + 1 }
+func f1030(_ x: Int) -> Int { let y = f1029(x) 
+ return y + 1 }
+func f1031(_ x: Int) -> Int { let y = f1030(x) 
+ return y + 1 }
+func f1032(_ x: Int) -> Int { let y = f1031(x) 
+ return y + 1 }
+func f1033(_ x: Int) -> Int { let y = f1032(x) 
+ return y + 1 }
+func f1034(_ x: Int) -> Int { let y = f1033(x) 
+ return y + 1 }
+func f1035(_ x: Int) -> Int { let y = f1034(x) 
+ return y + 1 }
+func f1036(_ x: Int) -> Int { let y = f1035(x) 
+ return y + 1 }
+func f1037(_ x: Int) -> Int { let y = f1036(x) 
+ return y + 1 }
+func f1038(_ x: Int) -> Int { let y = f1037(x) 
+ return y + 1 }
+func f1039(_ x: Int) -> Int { let y = f1038(x) 
+ return y + 1 }
+func f1040(_ x: Int) -> Int { let y = f1039(x) 
+ return y + 1 }
+func f1041(_ x: Int) -> Int { let y = f1040(x) 
+ return y + 1 }
+func f1042(_ x: Int) -> Int { let y = f1041(x) 
+ return y + 1 }
+func f1043(_ x: Int) -> Int { let y = f1042(x) 
+ return y + 1 }
+func f1044(_ x: Int) -> Int { let y = f1043(x) 
+ return y + 1 }
+func f1045(_ x: Int) -> Int { let y = f1044(x) 
+ return y + 1 }
+func f1046(_ x: Int) -> Int { let y = f1045(x) 
+ return y + 1 }
+func f1047(_ x: Int) -> Int { let y = f1046(x) 
+ return y + 1 }
+func f1048(_ x: Int) -> Int { let y = f1047(x) 
+ return y + 1 }
+func f1049(_ x: Int) -> Int { let y = f1048(x) 
+ return y + 1 }
+func f1050(_ x: Int) -> Int { let y = f1049(x) 
+ return y + 1 }
+func f1051(_ x: Int) -> Int { let y = f1050(x) 
+ return y + 1 }
+func f1052(_ x: Int) -> Int { let y = f1051(x) 
+ return y + 1 }
+func f1053(_ x: Int) -> Int { let y = f1052(x) 
+ return y + 1 }
+func f1054(_ x: Int) -> Int { let y = f1053(x) 
+ return y + 1 }
+func f1055(_ x: Int) -> Int { let y = f1054(x) 
+ return y + 1 }
+func f1056(_ x: Int) -> Int { let y = f1055(x) 
+ return y + 1 }
+func f1057(_ x: Int) -> Int { let y = f1056(x) 
+ return y + 1 }
+func f1058(_ x: Int) -> Int { let y = f1057(x) 
+ return y + 1 }
+func f1059(_ x: Int) -> Int { let y = f1058(x) 
+ return y + 1 }
+func f1060(_ x: Int) -> Int { let y = f1059(x) 
+ return y + 1 }
+func f1061(_ x: Int) -> Int { let y = f1060(x) 
+ return y + 1 }
+func f1062(_ x: Int) -> Int { let y = f1061(x) 
+ return y + 1 }
+func f1063(_ x: Int) -> Int { let y = f1062(x) 
+ return y + 1 }
+func f1064(_ x: Int) -> Int { let y = f1063(x) 
+ return y + 1 }
+func f1065(_ x: Int) -> Int { let y = f1064(x) 
+ return y + 1 }
+func f1066(_ x: Int) -> Int { let y = f1065(x) 
+ return y + 1 }
+func f1067(_ x: Int) -> Int { let y = f1066(x) 
+ return y + 1 }
+func f1068(_ x: Int) -> Int { let y = f1067(x) 
+ return y + 1 }
+func f1069(_ x: Int) -> Int { let y = f1068(x) 
+ return y + 1 }
+func f1070(_ x: Int) -> Int { let y = f1069(x) 
+ return y + 1 }
+func f1071(_ x: Int) -> Int { let y = f1070(x) 
+ return y + 1 }
+func f1072(_ x: Int) -> Int { let y = f1071(x) 
+ return y + 1 }
+func f1073(_ x: Int) -> Int { let y = f1072(x) 
+ return y + 1 }
+func f1074(_ x: Int) -> Int { let y = f1073(x) 
+ return y + 1 }
+func f1075(_ x: Int) -> Int { let y = f1074(x) 
+ return y + 1 }
+func f1076(_ x: Int) -> Int { let y = f1075(x) 
+ return y + 1 }
+func f1077(_ x: Int) -> Int { let y = f1076(x) 
+ return y + 1 }
+func f1078(_ x: Int) -> Int { let y = f1077(x) 
+ return y + 1 }
+func f1079(_ x: Int) -> Int { let y = f1078(x) 
+ return y + 1 }
+func f1080(_ x: Int) -> Int { let y = f1079(x) 
+ return y + 1 }
+func f1081(_ x: Int) -> Int { let y = f1080(x) 
+ return y + 1 }
+func f1082(_ x: Int) -> Int { let y = f1081(x) 
+ return y + 1 }
+func f1083(_ x: Int) -> Int { let y = f1082(x) 
+ return y + 1 }
+func f1084(_ x: Int) -> Int { let y = f1083(x) 
+ return y + 1 }
+func f1085(_ x: Int) -> Int { let y = f1084(x) 
+ return y + 1 }
+func f1086(_ x: Int) -> Int { let y = f1085(x) 
+ return y + 1 }
+func f1087(_ x: Int) -> Int { let y = f1086(x) 
+ return y + 1 }
+func f1088(_ x: Int) -> Int { let y = f1087(x) 
+ return y + 1 }
+func f1089(_ x: Int) -> Int { let y = f1088(x) 
+ return y + 1 }
+func f1090(_ x: Int) -> Int { let y = f1089(x) 
+ return y + 1 }
+func f1091(_ x: Int) -> Int { let y = f1090(x) 
+ return y + 1 }
+func f1092(_ x: Int) -> Int { let y = f1091(x) 
+ return y + 1 }
+func f1093(_ x: Int) -> Int { let y = f1092(x) 
+ return y + 1 }
+func f1094(_ x: Int) -> Int { let y = f1093(x) 
+ return y + 1 }
+func f1095(_ x: Int) -> Int { let y = f1094(x) 
+ return y + 1 }
+func f1096(_ x: Int) -> Int { let y = f1095(x) 
+ return y + 1 }
+func f1097(_ x: Int) -> Int { let y = f1096(x) 
+ return y + 1 }
+func f1098(_ x: Int) -> Int { let y = f1097(x) 
+ return y + 1 }
+func f1099(_ x: Int) -> Int { let y = f1098(x) 
+ return y + 1 }
+func f1100(_ x: Int) -> Int { let y = f1099(x) 
+ return y + 1 }
+func f1101(_ x: Int) -> Int { let y = f1100(x) 
+ return y + 1 }
+func f1102(_ x: Int) -> Int { let y = f1101(x) 
+ return y + 1 }
+func f1103(_ x: Int) -> Int { let y = f1102(x) 
+ return y + 1 }
+func f1104(_ x: Int) -> Int { let y = f1103(x) 
+ return y + 1 }
+func f1105(_ x: Int) -> Int { let y = f1104(x) 
+ return y + 1 }
+func f1106(_ x: Int) -> Int { let y = f1105(x) 
+ return y + 1 }
+func f1107(_ x: Int) -> Int { let y = f1106(x) 
+ return y + 1 }
+func f1108(_ x: Int) -> Int { let y = f1107(x) 
+ return y + 1 }
+func f1109(_ x: Int) -> Int { let y = f1108(x) 
+ return y + 1 }
+func f1110(_ x: Int) -> Int { let y = f1109(x) 
+ return y + 1 }
+func f1111(_ x: Int) -> Int { let y = f1110(x) 
+ return y + 1 }
+func f1112(_ x: Int) -> Int { let y = f1111(x) 
+ return y + 1 }
+func f1113(_ x: Int) -> Int { let y = f1112(x) 
+ return y + 1 }
+func f1114(_ x: Int) -> Int { let y = f1113(x) 
+ return y + 1 }
+func f1115(_ x: Int) -> Int { let y = f1114(x) 
+ return y + 1 }
+func f1116(_ x: Int) -> Int { let y = f1115(x) 
+ return y + 1 }
+func f1117(_ x: Int) -> Int { let y = f1116(x) 
+ return y + 1 }
+func f1118(_ x: Int) -> Int { let y = f1117(x) 
+ return y + 1 }
+func f1119(_ x: Int) -> Int { let y = f1118(x) 
+ return y + 1 }
+func f1120(_ x: Int) -> Int { let y = f1119(x) 
+ return y + 1 }
+func f1121(_ x: Int) -> Int { let y = f1120(x) 
+ return y + 1 }
+func f1122(_ x: Int) -> Int { let y = f1121(x) 
+ return y + 1 }
+func f1123(_ x: Int) -> Int { let y = f1122(x) 
+ return y + 1 }
+func f1124(_ x: Int) -> Int { let y = f1123(x) 
+ return y + 1 }
+func f1125(_ x: Int) -> Int { let y = f1124(x) 
+ return y + 1 }
+func f1126(_ x: Int) -> Int { let y = f1125(x) 
+ return y + 1 }
+func f1127(_ x: Int) -> Int { let y = f1126(x) 
+ return y + 1 }
+func f1128(_ x: Int) -> Int { let y = f1127(x) 
+ return y + 1 }
+func f1129(_ x: Int) -> Int { let y = f1128(x) 
+ return y + 1 }
+func f1130(_ x: Int) -> Int { let y = f1129(x) 
+ return y + 1 }
+func f1131(_ x: Int) -> Int { let y = f1130(x) 
+ return y + 1 }
+func f1132(_ x: Int) -> Int { let y = f1131(x) 
+ return y + 1 }
+func f1133(_ x: Int) -> Int { let y = f1132(x) 
+ return y + 1 }
+func f1134(_ x: Int) -> Int { let y = f1133(x) 
+ return y + 1 }
+func f1135(_ x: Int) -> Int { let y = f1134(x) 
+ return y + 1 }
+func f1136(_ x: Int) -> Int { let y = f1135(x) 
+ return y + 1 }
+func f1137(_ x: Int) -> Int { let y = f1136(x) 
+ return y + 1 }
+func f1138(_ x: Int) -> Int { let y = f1137(x) 
+ return y + 1 }
+func f1139(_ x: Int) -> Int { let y = f1138(x) 
+ return y + 1 }
+func f1140(_ x: Int) -> Int { let y = f1139(x) 
+ return y + 1 }
+func f1141(_ x: Int) -> Int { let y = f1140(x) 
+ return y + 1 }
+func f1142(_ x: Int) -> Int { let y = f1141(x) 
+ return y + 1 }
+func f1143(_ x: Int) -> Int { let y = f1142(x) 
+ return y + 1 }
+func f1144(_ x: Int) -> Int { let y = f1143(x) 
+ return y + 1 }
+func f1145(_ x: Int) -> Int { let y = f1144(x) 
+ return y + 1 }
+func f1146(_ x: Int) -> Int { let y = f1145(x) 
+ return y + 1 }
+func f1147(_ x: Int) -> Int { let y = f1146(x) 
+ return y + 1 }
+func f1148(_ x: Int) -> Int { let y = f1147(x) 
+ return y + 1 }
+func f1149(_ x: Int) -> Int { let y = f1148(x) 
+ return y + 1 }
+func f1150(_ x: Int) -> Int { let y = f1149(x) 
+ return y + 1 }
+func f1151(_ x: Int) -> Int { let y = f1150(x) 
+ return y + 1 }
+func f1152(_ x: Int) -> Int { let y = f1151(x) 
+ return y + 1 }
+func f1153(_ x: Int) -> Int { let y = f1152(x) 
+ return y + 1 }
+func f1154(_ x: Int) -> Int { let y = f1153(x) 
+ return y + 1 }
+func f1155(_ x: Int) -> Int { let y = f1154(x) 
+ return y + 1 }
+func f1156(_ x: Int) -> Int { let y = f1155(x) 
+ return y + 1 }
+func f1157(_ x: Int) -> Int { let y = f1156(x) 
+ return y + 1 }
+func f1158(_ x: Int) -> Int { let y = f1157(x) 
+ return y + 1 }
+func f1159(_ x: Int) -> Int { let y = f1158(x) 
+ return y + 1 }
+func f1160(_ x: Int) -> Int { let y = f1159(x) 
+ return y + 1 }
+func f1161(_ x: Int) -> Int { let y = f1160(x) 
+ return y + 1 }
+func f1162(_ x: Int) -> Int { let y = f1161(x) 
+ return y + 1 }
+func f1163(_ x: Int) -> Int { let y = f1162(x) 
+ return y + 1 }
+func f1164(_ x: Int) -> Int { let y = f1163(x) 
+ return y + 1 }
+func f1165(_ x: Int) -> Int { let y = f1164(x) 
+ return y + 1 }
+func f1166(_ x: Int) -> Int { let y = f1165(x) 
+ return y + 1 }
+func f1167(_ x: Int) -> Int { let y = f1166(x) 
+ return y + 1 }
+func f1168(_ x: Int) -> Int { let y = f1167(x) 
+ return y + 1 }
+func f1169(_ x: Int) -> Int { let y = f1168(x) 
+ return y + 1 }
+func f1170(_ x: Int) -> Int { let y = f1169(x) 
+ return y + 1 }
+func f1171(_ x: Int) -> Int { let y = f1170(x) 
+ return y + 1 }
+func f1172(_ x: Int) -> Int { let y = f1171(x) 
+ return y + 1 }
+func f1173(_ x: Int) -> Int { let y = f1172(x) 
+ return y + 1 }
+func f1174(_ x: Int) -> Int { let y = f1173(x) 
+ return y + 1 }
+func f1175(_ x: Int) -> Int { let y = f1174(x) 
+ return y + 1 }
+func f1176(_ x: Int) -> Int { let y = f1175(x) 
+ return y + 1 }
+func f1177(_ x: Int) -> Int { let y = f1176(x) 
+ return y + 1 }
+func f1178(_ x: Int) -> Int { let y = f1177(x) 
+ return y + 1 }
+func f1179(_ x: Int) -> Int { let y = f1178(x) 
+ return y + 1 }
+func f1180(_ x: Int) -> Int { let y = f1179(x) 
+ return y + 1 }
+func f1181(_ x: Int) -> Int { let y = f1180(x) 
+ return y + 1 }
+func f1182(_ x: Int) -> Int { let y = f1181(x) 
+ return y + 1 }
+func f1183(_ x: Int) -> Int { let y = f1182(x) 
+ return y + 1 }
+func f1184(_ x: Int) -> Int { let y = f1183(x) 
+ return y + 1 }
+func f1185(_ x: Int) -> Int { let y = f1184(x) 
+ return y + 1 }
+func f1186(_ x: Int) -> Int { let y = f1185(x) 
+ return y + 1 }
+func f1187(_ x: Int) -> Int { let y = f1186(x) 
+ return y + 1 }
+func f1188(_ x: Int) -> Int { let y = f1187(x) 
+ return y + 1 }
+func f1189(_ x: Int) -> Int { let y = f1188(x) 
+ return y + 1 }
+func f1190(_ x: Int) -> Int { let y = f1189(x) 
+ return y + 1 }
+func f1191(_ x: Int) -> Int { let y = f1190(x) 
+ return y + 1 }
+func f1192(_ x: Int) -> Int { let y = f1191(x) 
+ return y + 1 }
+func f1193(_ x: Int) -> Int { let y = f1192(x) 
+ return y + 1 }
+func f1194(_ x: Int) -> Int { let y = f1193(x) 
+ return y + 1 }
+func f1195(_ x: Int) -> Int { let y = f1194(x) 
+ return y + 1 }
+func f1196(_ x: Int) -> Int { let y = f1195(x) 
+ return y + 1 }
+func f1197(_ x: Int) -> Int { let y = f1196(x) 
+ return y + 1 }
+func f1198(_ x: Int) -> Int { let y = f1197(x) 
+ return y + 1 }
+func f1199(_ x: Int) -> Int { let y = f1198(x) 
+ return y + 1 }
+func f1200(_ x: Int) -> Int { let y = f1199(x) 
+ return y + 1 }
+func f1201(_ x: Int) -> Int { let y = f1200(x) 
+ return y + 1 }
+func f1202(_ x: Int) -> Int { let y = f1201(x) 
+ return y + 1 }
+func f1203(_ x: Int) -> Int { let y = f1202(x) 
+ return y + 1 }
+func f1204(_ x: Int) -> Int { let y = f1203(x) 
+ return y + 1 }
+func f1205(_ x: Int) -> Int { let y = f1204(x) 
+ return y + 1 }
+func f1206(_ x: Int) -> Int { let y = f1205(x) 
+ return y + 1 }
+func f1207(_ x: Int) -> Int { let y = f1206(x) 
+ return y + 1 }
+func f1208(_ x: Int) -> Int { let y = f1207(x) 
+ return y + 1 }
+func f1209(_ x: Int) -> Int { let y = f1208(x) 
+ return y + 1 }
+func f1210(_ x: Int) -> Int { let y = f1209(x) 
+ return y + 1 }
+func f1211(_ x: Int) -> Int { let y = f1210(x) 
+ return y + 1 }
+func f1212(_ x: Int) -> Int { let y = f1211(x) 
+ return y + 1 }
+func f1213(_ x: Int) -> Int { let y = f1212(x) 
+ return y + 1 }
+func f1214(_ x: Int) -> Int { let y = f1213(x) 
+ return y + 1 }
+func f1215(_ x: Int) -> Int { let y = f1214(x) 
+ return y + 1 }
+func f1216(_ x: Int) -> Int { let y = f1215(x) 
+ return y + 1 }
+func f1217(_ x: Int) -> Int { let y = f1216(x) 
+ return y + 1 }
+func f1218(_ x: Int) -> Int { let y = f1217(x) 
+ return y + 1 }
+func f1219(_ x: Int) -> Int { let y = f1218(x) 
+ return y + 1 }
+func f1220(_ x: Int) -> Int { let y = f1219(x) 
+ return y + 1 }
+func f1221(_ x: Int) -> Int { let y = f1220(x) 
+ return y + 1 }
+func f1222(_ x: Int) -> Int { let y = f1221(x) 
+ return y + 1 }
+func f1223(_ x: Int) -> Int { let y = f1222(x) 
+ return y + 1 }
+func f1224(_ x: Int) -> Int { let y = f1223(x) 
+ return y + 1 }
+func f1225(_ x: Int) -> Int { let y = f1224(x) 
+ return y + 1 }
+func f1226(_ x: Int) -> Int { let y = f1225(x) 
+ return y + 1 }
+func f1227(_ x: Int) -> Int { let y = f1226(x) 
+ return y + 1 }
+func f1228(_ x: Int) -> Int { let y = f1227(x) 
+ return y + 1 }
+func f1229(_ x: Int) -> Int { let y = f1228(x) 
+ return y + 1 }
+func f1230(_ x: Int) -> Int { let y = f1229(x) 
+ return y + 1 }
+func f1231(_ x: Int) -> Int { let y = f1230(x) 
+ return y + 1 }
+func f1232(_ x: Int) -> Int { let y = f1231(x) 
+ return y + 1 }
+func f1233(_ x: Int) -> Int { let y = f1232(x) 
+ return y + 1 }
+func f1234(_ x: Int) -> Int { let y = f1233(x) 
+ return y + 1 }
+func f1235(_ x: Int) -> Int { let y = f1234(x) 
+ return y + 1 }
+func f1236(_ x: Int) -> Int { let y = f1235(x) 
+ return y + 1 }
+func f1237(_ x: Int) -> Int { let y = f1236(x) 
+ return y + 1 }
+func f1238(_ x: Int) -> Int { let y = f1237(x) 
+ return y + 1 }
+func f1239(_ x: Int) -> Int { let y = f1238(x) 
+ return y + 1 }
+func f1240(_ x: Int) -> Int { let y = f1239(x) 
+ return y + 1 }
+func f1241(_ x: Int) -> Int { let y = f1240(x) 
+ return y + 1 }
+func f1242(_ x: Int) -> Int { let y = f1241(x) 
+ return y + 1 }
+func f1243(_ x: Int) -> Int { let y = f1242(x) 
+ return y + 1 }
+func f1244(_ x: Int) -> Int { let y = f1243(x) 
+ return y + 1 }
+func f1245(_ x: Int) -> Int { let y = f1244(x) 
+ return y + 1 }
+func f1246(_ x: Int) -> Int { let y = f1245(x) 
+ return y + 1 }
+func f1247(_ x: Int) -> Int { let y = f1246(x) 
+ return y + 1 }
+func f1248(_ x: Int) -> Int { let y = f1247(x) 
+ return y + 1 }
+func f1249(_ x: Int) -> Int { let y = f1248(x) 
+ return y + 1 }
+func f1250(_ x: Int) -> Int { let y = f1249(x) 
+ return y + 1 }
+func f1251(_ x: Int) -> Int { let y = f1250(x) 
+ return y + 1 }
+func f1252(_ x: Int) -> Int { let y = f1251(x) 
+ return y + 1 }
+func f1253(_ x: Int) -> Int { let y = f1252(x) 
+ return y + 1 }
+func f1254(_ x: Int) -> Int { let y = f1253(x) 
+ return y + 1 }
+func f1255(_ x: Int) -> Int { let y = f1254(x) 
+ return y + 1 }
+func f1256(_ x: Int) -> Int { let y = f1255(x) 
+ return y + 1 }
+func f1257(_ x: Int) -> Int { let y = f1256(x) 
+ return y + 1 }
+func f1258(_ x: Int) -> Int { let y = f1257(x) 
+ return y + 1 }
+func f1259(_ x: Int) -> Int { let y = f1258(x) 
+ return y + 1 }
+func f1260(_ x: Int) -> Int { let y = f1259(x) 
+ return y + 1 }
+func f1261(_ x: Int) -> Int { let y = f1260(x) 
+ return y + 1 }
+func f1262(_ x: Int) -> Int { let y = f1261(x) 
+ return y + 1 }
+func f1263(_ x: Int) -> Int { let y = f1262(x) 
+ return y + 1 }
+func f1264(_ x: Int) -> Int { let y = f1263(x) 
+ return y + 1 }
+func f1265(_ x: Int) -> Int { let y = f1264(x) 
+ return y + 1 }
+func f1266(_ x: Int) -> Int { let y = f1265(x) 
+ return y + 1 }
+func f1267(_ x: Int) -> Int { let y = f1266(x) 
+ return y + 1 }
+func f1268(_ x: Int) -> Int { let y = f1267(x) 
+ return y + 1 }
+func f1269(_ x: Int) -> Int { let y = f1268(x) 
+ return y + 1 }
+func f1270(_ x: Int) -> Int { let y = f1269(x) 
+ return y + 1 }
+func f1271(_ x: Int) -> Int { let y = f1270(x) 
+ return y + 1 }
+func f1272(_ x: Int) -> Int { let y = f1271(x) 
+ return y + 1 }
+func f1273(_ x: Int) -> Int { let y = f1272(x) 
+ return y + 1 }
+func f1274(_ x: Int) -> Int { let y = f1273(x) 
+ return y + 1 }
+func f1275(_ x: Int) -> Int { let y = f1274(x) 
+ return y + 1 }
+func f1276(_ x: Int) -> Int { let y = f1275(x) 
+ return y + 1 }
+func f1277(_ x: Int) -> Int { let y = f1276(x) 
+ return y + 1 }
+func f1278(_ x: Int) -> Int { let y = f1277(x) 
+ return y + 1 }
+func f1279(_ x: Int) -> Int { let y = f1278(x) 
+ return y + 1 }
+func f1280(_ x: Int) -> Int { let y = f1279(x) 
+ return y + 1 }
+func f1281(_ x: Int) -> Int { let y = f1280(x) 
+ return y + 1 }
+func f1282(_ x: Int) -> Int { let y = f1281(x) 
+ return y + 1 }
+func f1283(_ x: Int) -> Int { let y = f1282(x) 
+ return y + 1 }
+func f1284(_ x: Int) -> Int { let y = f1283(x) 
+ return y + 1 }
+func f1285(_ x: Int) -> Int { let y = f1284(x) 
+ return y + 1 }
+func f1286(_ x: Int) -> Int { let y = f1285(x) 
+ return y + 1 }
+func f1287(_ x: Int) -> Int { let y = f1286(x) 
+ return y + 1 }
+func f1288(_ x: Int) -> Int { let y = f1287(x) 
+ return y + 1 }
+func f1289(_ x: Int) -> Int { let y = f1288(x) 
+ return y + 1 }
+func f1290(_ x: Int) -> Int { let y = f1289(x) 
+ return y + 1 }
+func f1291(_ x: Int) -> Int { let y = f1290(x) 
+ return y + 1 }
+func f1292(_ x: Int) -> Int { let y = f1291(x) 
+ return y + 1 }
+func f1293(_ x: Int) -> Int { let y = f1292(x) 
+ return y + 1 }
+func f1294(_ x: Int) -> Int { let y = f1293(x) 
+ return y + 1 }
+func f1295(_ x: Int) -> Int { let y = f1294(x) 
+ return y + 1 }
+func f1296(_ x: Int) -> Int { let y = f1295(x) 
+ return y + 1 }
+func f1297(_ x: Int) -> Int { let y = f1296(x) 
+ return y + 1 }
+func f1298(_ x: Int) -> Int { let y = f1297(x) 
+ return y + 1 }
+func f1299(_ x: Int) -> Int { let y = f1298(x) 
+ return y + 1 }
+func f1300(_ x: Int) -> Int { let y = f1299(x) 
+ return y + 1 }
+func f1301(_ x: Int) -> Int { let y = f1300(x) 
+ return y + 1 }
+func f1302(_ x: Int) -> Int { let y = f1301(x) 
+ return y + 1 }
+func f1303(_ x: Int) -> Int { let y = f1302(x) 
+ return y + 1 }
+func f1304(_ x: Int) -> Int { let y = f1303(x) 
+ return y + 1 }
+func f1305(_ x: Int) -> Int { let y = f1304(x) 
+ return y + 1 }
+func f1306(_ x: Int) -> Int { let y = f1305(x) 
+ return y + 1 }
+func f1307(_ x: Int) -> Int { let y = f1306(x) 
+ return y + 1 }
+func f1308(_ x: Int) -> Int { let y = f1307(x) 
+ return y + 1 }
+func f1309(_ x: Int) -> Int { let y = f1308(x) 
+ return y + 1 }
+func f1310(_ x: Int) -> Int { let y = f1309(x) 
+ return y + 1 }
+func f1311(_ x: Int) -> Int { let y = f1310(x) 
+ return y + 1 }
+func f1312(_ x: Int) -> Int { let y = f1311(x) 
+ return y + 1 }
+func f1313(_ x: Int) -> Int { let y = f1312(x) 
+ return y + 1 }
+func f1314(_ x: Int) -> Int { let y = f1313(x) 
+ return y + 1 }
+func f1315(_ x: Int) -> Int { let y = f1314(x) 
+ return y + 1 }
+func f1316(_ x: Int) -> Int { let y = f1315(x) 
+ return y + 1 }
+func f1317(_ x: Int) -> Int { let y = f1316(x) 
+ return y + 1 }
+func f1318(_ x: Int) -> Int { let y = f1317(x) 
+ return y + 1 }
+func f1319(_ x: Int) -> Int { let y = f1318(x) 
+ return y + 1 }
+func f1320(_ x: Int) -> Int { let y = f1319(x) 
+ return y + 1 }
+func f1321(_ x: Int) -> Int { let y = f1320(x) 
+ return y + 1 }
+func f1322(_ x: Int) -> Int { let y = f1321(x) 
+ return y + 1 }
+func f1323(_ x: Int) -> Int { let y = f1322(x) 
+ return y + 1 }
+func f1324(_ x: Int) -> Int { let y = f1323(x) 
+ return y + 1 }
+func f1325(_ x: Int) -> Int { let y = f1324(x) 
+ return y + 1 }
+func f1326(_ x: Int) -> Int { let y = f1325(x) 
+ return y + 1 }
+func f1327(_ x: Int) -> Int { let y = f1326(x) 
+ return y + 1 }
+func f1328(_ x: Int) -> Int { let y = f1327(x) 
+ return y + 1 }
+func f1329(_ x: Int) -> Int { let y = f1328(x) 
+ return y + 1 }
+func f1330(_ x: Int) -> Int { let y = f1329(x) 
+ return y + 1 }
+func f1331(_ x: Int) -> Int { let y = f1330(x) 
+ return y + 1 }
+func f1332(_ x: Int) -> Int { let y = f1331(x) 
+ return y + 1 }
+func f1333(_ x: Int) -> Int { let y = f1332(x) 
+ return y + 1 }
+func f1334(_ x: Int) -> Int { let y = f1333(x) 
+ return y + 1 }
+func f1335(_ x: Int) -> Int { let y = f1334(x) 
+ return y + 1 }
+func f1336(_ x: Int) -> Int { let y = f1335(x) 
+ return y + 1 }
+func f1337(_ x: Int) -> Int { let y = f1336(x) 
+ return y + 1 }
+func f1338(_ x: Int) -> Int { let y = f1337(x) 
+ return y + 1 }
+func f1339(_ x: Int) -> Int { let y = f1338(x) 
+ return y + 1 }
+func f1340(_ x: Int) -> Int { let y = f1339(x) 
+ return y + 1 }
+func f1341(_ x: Int) -> Int { let y = f1340(x) 
+ return y + 1 }
+func f1342(_ x: Int) -> Int { let y = f1341(x) 
+ return y + 1 }
+func f1343(_ x: Int) -> Int { let y = f1342(x) 
+ return y + 1 }
+func f1344(_ x: Int) -> Int { let y = f1343(x) 
+ return y + 1 }
+func f1345(_ x: Int) -> Int { let y = f1344(x) 
+ return y + 1 }
+func f1346(_ x: Int) -> Int { let y = f1345(x) 
+ return y + 1 }
+func f1347(_ x: Int) -> Int { let y = f1346(x) 
+ return y + 1 }
+func f1348(_ x: Int) -> Int { let y = f1347(x) 
+ return y + 1 }
+func f1349(_ x: Int) -> Int { let y = f1348(x) 
+ return y + 1 }
+func f1350(_ x: Int) -> Int { let y = f1349(x) 
+ return y + 1 }
+func f1351(_ x: Int) -> Int { let y = f1350(x) 
+ return y + 1 }
+func f1352(_ x: Int) -> Int { let y = f1351(x) 
+ return y + 1 }
+func f1353(_ x: Int) -> Int { let y = f1352(x) 
+ return y + 1 }
+func f1354(_ x: Int) -> Int { let y = f1353(x) 
+ return y + 1 }
+func f1355(_ x: Int) -> Int { let y = f1354(x) 
+ return y + 1 }
+func f1356(_ x: Int) -> Int { let y = f1355(x) 
+ return y + 1 }
+func f1357(_ x: Int) -> Int { let y = f1356(x) 
+ return y + 1 }
+func f1358(_ x: Int) -> Int { let y = f1357(x) 
+ return y + 1 }
+func f1359(_ x: Int) -> Int { let y = f1358(x) 
+ return y + 1 }
+func f1360(_ x: Int) -> Int { let y = f1359(x) 
+ return y + 1 }
+func f1361(_ x: Int) -> Int { let y = f1360(x) 
+ return y + 1 }
+func f1362(_ x: Int) -> Int { let y = f1361(x) 
+ return y + 1 }
+func f1363(_ x: Int) -> Int { let y = f1362(x) 
+ return y + 1 }
+func f1364(_ x: Int) -> Int { let y = f1363(x) 
+ return y + 1 }
+func f1365(_ x: Int) -> Int { let y = f1364(x) 
+ return y + 1 }
+func f1366(_ x: Int) -> Int { let y = f1365(x) 
+ return y + 1 }
+func f1367(_ x: Int) -> Int { let y = f1366(x) 
+ return y + 1 }
+func f1368(_ x: Int) -> Int { let y = f1367(x) 
+ return y + 1 }
+func f1369(_ x: Int) -> Int { let y = f1368(x) 
+ return y + 1 }
+func f1370(_ x: Int) -> Int { let y = f1369(x) 
+ return y + 1 }
+func f1371(_ x: Int) -> Int { let y = f1370(x) 
+ return y + 1 }
+func f1372(_ x: Int) -> Int { let y = f1371(x) 
+ return y + 1 }
+func f1373(_ x: Int) -> Int { let y = f1372(x) 
+ return y + 1 }
+func f1374(_ x: Int) -> Int { let y = f1373(x) 
+ return y + 1 }
+func f1375(_ x: Int) -> Int { let y = f1374(x) 
+ return y + 1 }
+func f1376(_ x: Int) -> Int { let y = f1375(x) 
+ return y + 1 }
+func f1377(_ x: Int) -> Int { let y = f1376(x) 
+ return y + 1 }
+func f1378(_ x: Int) -> Int { let y = f1377(x) 
+ return y + 1 }
+func f1379(_ x: Int) -> Int { let y = f1378(x) 
+ return y + 1 }
+func f1380(_ x: Int) -> Int { let y = f1379(x) 
+ return y + 1 }
+func f1381(_ x: Int) -> Int { let y = f1380(x) 
+ return y + 1 }
+func f1382(_ x: Int) -> Int { let y = f1381(x) 
+ return y + 1 }
+func f1383(_ x: Int) -> Int { let y = f1382(x) 
+ return y + 1 }
+func f1384(_ x: Int) -> Int { let y = f1383(x) 
+ return y + 1 }
+func f1385(_ x: Int) -> Int { let y = f1384(x) 
+ return y + 1 }
+func f1386(_ x: Int) -> Int { let y = f1385(x) 
+ return y + 1 }
+func f1387(_ x: Int) -> Int { let y = f1386(x) 
+ return y + 1 }
+func f1388(_ x: Int) -> Int { let y = f1387(x) 
+ return y + 1 }
+func f1389(_ x: Int) -> Int { let y = f1388(x) 
+ return y + 1 }
+func f1390(_ x: Int) -> Int { let y = f1389(x) 
+ return y + 1 }
+func f1391(_ x: Int) -> Int { let y = f1390(x) 
+ return y + 1 }
+func f1392(_ x: Int) -> Int { let y = f1391(x) 
+ return y + 1 }
+func f1393(_ x: Int) -> Int { let y = f1392(x) 
+ return y + 1 }
+func f1394(_ x: Int) -> Int { let y = f1393(x) 
+ return y + 1 }
+func f1395(_ x: Int) -> Int { let y = f1394(x) 
+ return y + 1 }
+func f1396(_ x: Int) -> Int { let y = f1395(x) 
+ return y + 1 }
+func f1397(_ x: Int) -> Int { let y = f1396(x) 
+ return y + 1 }
+func f1398(_ x: Int) -> Int { let y = f1397(x) 
+ return y + 1 }
+func f1399(_ x: Int) -> Int { let y = f1398(x) 
+ return y + 1 }
+func f1400(_ x: Int) -> Int { let y = f1399(x) 
+ return y + 1 }
+func f1401(_ x: Int) -> Int { let y = f1400(x) 
+ return y + 1 }
+func f1402(_ x: Int) -> Int { let y = f1401(x) 
+ return y + 1 }
+func f1403(_ x: Int) -> Int { let y = f1402(x) 
+ return y + 1 }
+func f1404(_ x: Int) -> Int { let y = f1403(x) 
+ return y + 1 }
+func f1405(_ x: Int) -> Int { let y = f1404(x) 
+ return y + 1 }
+func f1406(_ x: Int) -> Int { let y = f1405(x) 
+ return y + 1 }
+func f1407(_ x: Int) -> Int { let y = f1406(x) 
+ return y + 1 }
+func f1408(_ x: Int) -> Int { let y = f1407(x) 
+ return y + 1 }
+func f1409(_ x: Int) -> Int { let y = f1408(x) 
+ return y + 1 }
+func f1410(_ x: Int) -> Int { let y = f1409(x) 
+ return y + 1 }
+func f1411(_ x: Int) -> Int { let y = f1410(x) 
+ return y + 1 }
+func f1412(_ x: Int) -> Int { let y = f1411(x) 
+ return y + 1 }
+func f1413(_ x: Int) -> Int { let y = f1412(x) 
+ return y + 1 }
+func f1414(_ x: Int) -> Int { let y = f1413(x) 
+ return y + 1 }
+func f1415(_ x: Int) -> Int { let y = f1414(x) 
+ return y + 1 }
+func f1416(_ x: Int) -> Int { let y = f1415(x) 
+ return y + 1 }
+func f1417(_ x: Int) -> Int { let y = f1416(x) 
+ return y + 1 }
+func f1418(_ x: Int) -> Int { let y = f1417(x) 
+ return y + 1 }
+func f1419(_ x: Int) -> Int { let y = f1418(x) 
+ return y + 1 }
+func f1420(_ x: Int) -> Int { let y = f1419(x) 
+ return y + 1 }
+func f1421(_ x: Int) -> Int { let y = f1420(x) 
+ return y + 1 }
+func f1422(_ x: Int) -> Int { let y = f1421(x) 
+ return y + 1 }
+func f1423(_ x: Int) -> Int { let y = f1422(x) 
+ return y + 1 }
+func f1424(_ x: Int) -> Int { let y = f1423(x) 
+ return y + 1 }
+func f1425(_ x: Int) -> Int { let y = f1424(x) 
+ return y + 1 }
+func f1426(_ x: Int) -> Int { let y = f1425(x) 
+ return y + 1 }
+func f1427(_ x: Int) -> Int { let y = f1426(x) 
+ return y + 1 }
+func f1428(_ x: Int) -> Int { let y = f1427(x) 
+ return y + 1 }
+func f1429(_ x: Int) -> Int { let y = f1428(x) 
+ return y + 1 }
+func f1430(_ x: Int) -> Int { let y = f1429(x) 
+ return y + 1 }
+func f1431(_ x: Int) -> Int { let y = f1430(x) 
+ return y + 1 }
+func f1432(_ x: Int) -> Int { let y = f1431(x) 
+ return y + 1 }
+func f1433(_ x: Int) -> Int { let y = f1432(x) 
+ return y + 1 }
+func f1434(_ x: Int) -> Int { let y = f1433(x) 
+ return y + 1 }
+func f1435(_ x: Int) -> Int { let y = f1434(x) 
+ return y + 1 }
+func f1436(_ x: Int) -> Int { let y = f1435(x) 
+ return y + 1 }
+func f1437(_ x: Int) -> Int { let y = f1436(x) 
+ return y + 1 }
+func f1438(_ x: Int) -> Int { let y = f1437(x) 
+ return y + 1 }
+func f1439(_ x: Int) -> Int { let y = f1438(x) 
+ return y + 1 }
+func f1440(_ x: Int) -> Int { let y = f1439(x) 
+ return y + 1 }
+func f1441(_ x: Int) -> Int { let y = f1440(x) 
+ return y + 1 }
+func f1442(_ x: Int) -> Int { let y = f1441(x) 
+ return y + 1 }
+func f1443(_ x: Int) -> Int { let y = f1442(x) 
+ return y + 1 }
+func f1444(_ x: Int) -> Int { let y = f1443(x) 
+ return y + 1 }
+func f1445(_ x: Int) -> Int { let y = f1444(x) 
+ return y + 1 }
+func f1446(_ x: Int) -> Int { let y = f1445(x) 
+ return y + 1 }
+func f1447(_ x: Int) -> Int { let y = f1446(x) 
+ return y + 1 }
+func f1448(_ x: Int) -> Int { let y = f1447(x) 
+ return y + 1 }
+func f1449(_ x: Int) -> Int { let y = f1448(x) 
+ return y + 1 }
+func f1450(_ x: Int) -> Int { let y = f1449(x) 
+ return y + 1 }
+func f1451(_ x: Int) -> Int { let y = f1450(x) 
+ return y + 1 }
+func f1452(_ x: Int) -> Int { let y = f1451(x) 
+ return y + 1 }
+func f1453(_ x: Int) -> Int { let y = f1452(x) 
+ return y + 1 }
+func f1454(_ x: Int) -> Int { let y = f1453(x) 
+ return y + 1 }
+func f1455(_ x: Int) -> Int { let y = f1454(x) 
+ return y + 1 }
+func f1456(_ x: Int) -> Int { let y = f1455(x) 
+ return y + 1 }
+func f1457(_ x: Int) -> Int { let y = f1456(x) 
+ return y + 1 }
+func f1458(_ x: Int) -> Int { let y = f1457(x) 
+ return y + 1 }
+func f1459(_ x: Int) -> Int { let y = f1458(x) 
+ return y + 1 }
+func f1460(_ x: Int) -> Int { let y = f1459(x) 
+ return y + 1 }
+func f1461(_ x: Int) -> Int { let y = f1460(x) 
+ return y + 1 }
+func f1462(_ x: Int) -> Int { let y = f1461(x) 
+ return y + 1 }
+func f1463(_ x: Int) -> Int { let y = f1462(x) 
+ return y + 1 }
+func f1464(_ x: Int) -> Int { let y = f1463(x) 
+ return y + 1 }
+func f1465(_ x: Int) -> Int { let y = f1464(x) 
+ return y + 1 }
+func f1466(_ x: Int) -> Int { let y = f1465(x) 
+ return y + 1 }
+func f1467(_ x: Int) -> Int { let y = f1466(x) 
+ return y + 1 }
+func f1468(_ x: Int) -> Int { let y = f1467(x) 
+ return y + 1 }
+func f1469(_ x: Int) -> Int { let y = f1468(x) 
+ return y + 1 }
+func f1470(_ x: Int) -> Int { let y = f1469(x) 
+ return y + 1 }
+func f1471(_ x: Int) -> Int { let y = f1470(x) 
+ return y + 1 }
+func f1472(_ x: Int) -> Int { let y = f1471(x) 
+ return y + 1 }
+func f1473(_ x: Int) -> Int { let y = f1472(x) 
+ return y + 1 }
+func f1474(_ x: Int) -> Int { let y = f1473(x) 
+ return y + 1 }
+func f1475(_ x: Int) -> Int { let y = f1474(x) 
+ return y + 1 }
+func f1476(_ x: Int) -> Int { let y = f1475(x) 
+ return y + 1 }
+func f1477(_ x: Int) -> Int { let y = f1476(x) 
+ return y + 1 }
+func f1478(_ x: Int) -> Int { let y = f1477(x) 
+ return y + 1 }
+func f1479(_ x: Int) -> Int { let y = f1478(x) 
+ return y + 1 }
+func f1480(_ x: Int) -> Int { let y = f1479(x) 
+ return y + 1 }
+func f1481(_ x: Int) -> Int { let y = f1480(x) 
+ return y + 1 }
+func f1482(_ x: Int) -> Int { let y = f1481(x) 
+ return y + 1 }
+func f1483(_ x: Int) -> Int { let y = f1482(x) 
+ return y + 1 }
+func f1484(_ x: Int) -> Int { let y = f1483(x) 
+ return y + 1 }
+func f1485(_ x: Int) -> Int { let y = f1484(x) 
+ return y + 1 }
+func f1486(_ x: Int) -> Int { let y = f1485(x) 
+ return y + 1 }
+func f1487(_ x: Int) -> Int { let y = f1486(x) 
+ return y + 1 }
+func f1488(_ x: Int) -> Int { let y = f1487(x) 
+ return y + 1 }
+func f1489(_ x: Int) -> Int { let y = f1488(x) 
+ return y + 1 }
+func f1490(_ x: Int) -> Int { let y = f1489(x) 
+ return y + 1 }
+func f1491(_ x: Int) -> Int { let y = f1490(x) 
+ return y + 1 }
+func f1492(_ x: Int) -> Int { let y = f1491(x) 
+ return y + 1 }
+func f1493(_ x: Int) -> Int { let y = f1492(x) 
+ return y + 1 }
+func f1494(_ x: Int) -> Int { let y = f1493(x) 
+ return y + 1 }
+func f1495(_ x: Int) -> Int { let y = f1494(x) 
+ return y + 1 }
+func f1496(_ x: Int) -> Int { let y = f1495(x) 
+ return y + 1 }
+func f1497(_ x: Int) -> Int { let y = f1496(x) 
+ return y + 1 }
+func f1498(_ x: Int) -> Int { let y = f1497(x) 
+ return y + 1 }
+func f1499(_ x: Int) -> Int { let y = f1498(x) 
+ return y + 1 }
+func f1500(_ x: Int) -> Int { let y = f1499(x) 
+ return y + 1 }
+func f1501(_ x: Int) -> Int { let y = f1500(x) 
+ return y + 1 }
+func f1502(_ x: Int) -> Int { let y = f1501(x) 
+ return y + 1 }
+func f1503(_ x: Int) -> Int { let y = f1502(x) 
+ return y + 1 }
+func f1504(_ x: Int) -> Int { let y = f1503(x) 
+ return y + 1 }
+func f1505(_ x: Int) -> Int { let y = f1504(x) 
+ return y + 1 }
+func f1506(_ x: Int) -> Int { let y = f1505(x) 
+ return y + 1 }
+func f1507(_ x: Int) -> Int { let y = f1506(x) 
+ return y + 1 }
+func f1508(_ x: Int) -> Int { let y = f1507(x) 
+ return y + 1 }
+func f1509(_ x: Int) -> Int { let y = f1508(x) 
+ return y + 1 }
+func f1510(_ x: Int) -> Int { let y = f1509(x) 
+ return y + 1 }
+func f1511(_ x: Int) -> Int { let y = f1510(x) 
+ return y + 1 }
+func f1512(_ x: Int) -> Int { let y = f1511(x) 
+ return y + 1 }
+func f1513(_ x: Int) -> Int { let y = f1512(x) 
+ return y + 1 }
+func f1514(_ x: Int) -> Int { let y = f1513(x) 
+ return y + 1 }
+func f1515(_ x: Int) -> Int { let y = f1514(x) 
+ return y + 1 }
+func f1516(_ x: Int) -> Int { let y = f1515(x) 
+ return y + 1 }
+func f1517(_ x: Int) -> Int { let y = f1516(x) 
+ return y + 1 }
+func f1518(_ x: Int) -> Int { let y = f1517(x) 
+ return y + 1 }
+func f1519(_ x: Int) -> Int { let y = f1518(x) 
+ return y + 1 }
+func f1520(_ x: Int) -> Int { let y = f1519(x) 
+ return y + 1 }
+func f1521(_ x: Int) -> Int { let y = f1520(x) 
+ return y + 1 }
+func f1522(_ x: Int) -> Int { let y = f1521(x) 
+ return y + 1 }
+func f1523(_ x: Int) -> Int { let y = f1522(x) 
+ return y + 1 }
+func f1524(_ x: Int) -> Int { let y = f1523(x) 
+ return y + 1 }
+func f1525(_ x: Int) -> Int { let y = f1524(x) 
+ return y + 1 }
+func f1526(_ x: Int) -> Int { let y = f1525(x) 
+ return y + 1 }
+func f1527(_ x: Int) -> Int { let y = f1526(x) 
+ return y + 1 }
+func f1528(_ x: Int) -> Int { let y = f1527(x) 
+ return y + 1 }
+func f1529(_ x: Int) -> Int { let y = f1528(x) 
+ return y + 1 }
+func f1530(_ x: Int) -> Int { let y = f1529(x) 
+ return y + 1 }
+func f1531(_ x: Int) -> Int { let y = f1530(x) 
+ return y + 1 }
+func f1532(_ x: Int) -> Int { let y = f1531(x) 
+ return y + 1 }
+func f1533(_ x: Int) -> Int { let y = f1532(x) 
+ return y + 1 }
+func f1534(_ x: Int) -> Int { let y = f1533(x) 
+ return y + 1 }
+func f1535(_ x: Int) -> Int { let y = f1534(x) 
+ return y + 1 }
+func f1536(_ x: Int) -> Int { let y = f1535(x) 
+ return y + 1 }
+func f1537(_ x: Int) -> Int { let y = f1536(x) 
+ return y + 1 }
+func f1538(_ x: Int) -> Int { let y = f1537(x) 
+ return y + 1 }
+func f1539(_ x: Int) -> Int { let y = f1538(x) 
+ return y + 1 }
+func f1540(_ x: Int) -> Int { let y = f1539(x) 
+ return y + 1 }
+func f1541(_ x: Int) -> Int { let y = f1540(x) 
+ return y + 1 }
+func f1542(_ x: Int) -> Int { let y = f1541(x) 
+ return y + 1 }
+func f1543(_ x: Int) -> Int { let y = f1542(x) 
+ return y + 1 }
+func f1544(_ x: Int) -> Int { let y = f1543(x) 
+ return y + 1 }
+func f1545(_ x: Int) -> Int { let y = f1544(x) 
+ return y + 1 }
+func f1546(_ x: Int) -> Int { let y = f1545(x) 
+ return y + 1 }
+func f1547(_ x: Int) -> Int { let y = f1546(x) 
+ return y + 1 }
+func f1548(_ x: Int) -> Int { let y = f1547(x) 
+ return y + 1 }
+func f1549(_ x: Int) -> Int { let y = f1548(x) 
+ return y + 1 }
+func f1550(_ x: Int) -> Int { let y = f1549(x) 
+ return y + 1 }
+func f1551(_ x: Int) -> Int { let y = f1550(x) 
+ return y + 1 }
+func f1552(_ x: Int) -> Int { let y = f1551(x) 
+ return y + 1 }
+func f1553(_ x: Int) -> Int { let y = f1552(x) 
+ return y + 1 }
+func f1554(_ x: Int) -> Int { let y = f1553(x) 
+ return y + 1 }
+func f1555(_ x: Int) -> Int { let y = f1554(x) 
+ return y + 1 }
+func f1556(_ x: Int) -> Int { let y = f1555(x) 
+ return y + 1 }
+func f1557(_ x: Int) -> Int { let y = f1556(x) 
+ return y + 1 }
+func f1558(_ x: Int) -> Int { let y = f1557(x) 
+ return y + 1 }
+func f1559(_ x: Int) -> Int { let y = f1558(x) 
+ return y + 1 }
+func f1560(_ x: Int) -> Int { let y = f1559(x) 
+ return y + 1 }
+func f1561(_ x: Int) -> Int { let y = f1560(x) 
+ return y + 1 }
+func f1562(_ x: Int) -> Int { let y = f1561(x) 
+ return y + 1 }
+func f1563(_ x: Int) -> Int { let y = f1562(x) 
+ return y + 1 }
+func f1564(_ x: Int) -> Int { let y = f1563(x) 
+ return y + 1 }
+func f1565(_ x: Int) -> Int { let y = f1564(x) 
+ return y + 1 }
+func f1566(_ x: Int) -> Int { let y = f1565(x) 
+ return y + 1 }
+func f1567(_ x: Int) -> Int { let y = f1566(x) 
+ return y + 1 }
+func f1568(_ x: Int) -> Int { let y = f1567(x) 
+ return y + 1 }
+func f1569(_ x: Int) -> Int { let y = f1568(x) 
+ return y + 1 }
+func f1570(_ x: Int) -> Int { let y = f1569(x) 
+ return y + 1 }
+func f1571(_ x: Int) -> Int { let y = f1570(x) 
+ return y + 1 }
+func f1572(_ x: Int) -> Int { let y = f1571(x) 
+ return y + 1 }
+func f1573(_ x: Int) -> Int { let y = f1572(x) 
+ return y + 1 }
+func f1574(_ x: Int) -> Int { let y = f1573(x) 
+ return y + 1 }
+func f1575(_ x: Int) -> Int { let y = f1574(x) 
+ return y + 1 }
+func f1576(_ x: Int) -> Int { let y = f1575(x) 
+ return y + 1 }
+func f1577(_ x: Int) -> Int { let y = f1576(x) 
+ return y + 1 }
+func f1578(_ x: Int) -> Int { let y = f1577(x) 
+ return y + 1 }
+func f1579(_ x: Int) -> Int { let y = f1578(x) 
+ return y + 1 }
+func f1580(_ x: Int) -> Int { let y = f1579(x) 
+ return y + 1 }
+func f1581(_ x: Int) -> Int { let y = f1580(x) 
+ return y + 1 }
+func f1582(_ x: Int) -> Int { let y = f1581(x) 
+ return y + 1 }
+func f1583(_ x: Int) -> Int { let y = f1582(x) 
+ return y + 1 }
+func f1584(_ x: Int) -> Int { let y = f1583(x) 
+ return y + 1 }
+func f1585(_ x: Int) -> Int { let y = f1584(x) 
+ return y + 1 }
+func f1586(_ x: Int) -> Int { let y = f1585(x) 
+ return y + 1 }
+func f1587(_ x: Int) -> Int { let y = f1586(x) 
+ return y + 1 }
+func f1588(_ x: Int) -> Int { let y = f1587(x) 
+ return y + 1 }
+func f1589(_ x: Int) -> Int { let y = f1588(x) 
+ return y + 1 }
+func f1590(_ x: Int) -> Int { let y = f1589(x) 
+ return y + 1 }
+func f1591(_ x: Int) -> Int { let y = f1590(x) 
+ return y + 1 }
+func f1592(_ x: Int) -> Int { let y = f1591(x) 
+ return y + 1 }
+func f1593(_ x: Int) -> Int { let y = f1592(x) 
+ return y + 1 }
+func f1594(_ x: Int) -> Int { let y = f1593(x) 
+ return y + 1 }
+func f1595(_ x: Int) -> Int { let y = f1594(x) 
+ return y + 1 }
+func f1596(_ x: Int) -> Int { let y = f1595(x) 
+ return y + 1 }
+func f1597(_ x: Int) -> Int { let y = f1596(x) 
+ return y + 1 }
+func f1598(_ x: Int) -> Int { let y = f1597(x) 
+ return y + 1 }
+func f1599(_ x: Int) -> Int { let y = f1598(x) 
+ return y + 1 }
+func f1600(_ x: Int) -> Int { let y = f1599(x) 
+ return y + 1 }
+func f1601(_ x: Int) -> Int { let y = f1600(x) 
+ return y + 1 }
+func f1602(_ x: Int) -> Int { let y = f1601(x) 
+ return y + 1 }
+func f1603(_ x: Int) -> Int { let y = f1602(x) 
+ return y + 1 }
+func f1604(_ x: Int) -> Int { let y = f1603(x) 
+ return y + 1 }
+func f1605(_ x: Int) -> Int { let y = f1604(x) 
+ return y + 1 }
+func f1606(_ x: Int) -> Int { let y = f1605(x) 
+ return y + 1 }
+func f1607(_ x: Int) -> Int { let y = f1606(x) 
+ return y + 1 }
+func f1608(_ x: Int) -> Int { let y = f1607(x) 
+ return y + 1 }
+func f1609(_ x: Int) -> Int { let y = f1608(x) 
+ return y + 1 }
+func f1610(_ x: Int) -> Int { let y = f1609(x) 
+ return y + 1 }
+func f1611(_ x: Int) -> Int { let y = f1610(x) 
+ return y + 1 }
+func f1612(_ x: Int) -> Int { let y = f1611(x) 
+ return y + 1 }
+func f1613(_ x: Int) -> Int { let y = f1612(x) 
+ return y + 1 }
+func f1614(_ x: Int) -> Int { let y = f1613(x) 
+ return y + 1 }
+func f1615(_ x: Int) -> Int { let y = f1614(x) 
+ return y + 1 }
+func f1616(_ x: Int) -> Int { let y = f1615(x) 
+ return y + 1 }
+func f1617(_ x: Int) -> Int { let y = f1616(x) 
+ return y + 1 }
+func f1618(_ x: Int) -> Int { let y = f1617(x) 
+ return y + 1 }
+func f1619(_ x: Int) -> Int { let y = f1618(x) 
+ return y + 1 }
+func f1620(_ x: Int) -> Int { let y = f1619(x) 
+ return y + 1 }
+func f1621(_ x: Int) -> Int { let y = f1620(x) 
+ return y + 1 }
+func f1622(_ x: Int) -> Int { let y = f1621(x) 
+ return y + 1 }
+func f1623(_ x: Int) -> Int { let y = f1622(x) 
+ return y + 1 }
+func f1624(_ x: Int) -> Int { let y = f1623(x) 
+ return y + 1 }
+func f1625(_ x: Int) -> Int { let y = f1624(x) 
+ return y + 1 }
+func f1626(_ x: Int) -> Int { let y = f1625(x) 
+ return y + 1 }
+func f1627(_ x: Int) -> Int { let y = f1626(x) 
+ return y + 1 }
+func f1628(_ x: Int) -> Int { let y = f1627(x) 
+ return y + 1 }
+func f1629(_ x: Int) -> Int { let y = f1628(x) 
+ return y + 1 }
+func f1630(_ x: Int) -> Int { let y = f1629(x) 
+ return y + 1 }
+func f1631(_ x: Int) -> Int { let y = f1630(x) 
+ return y + 1 }
+func f1632(_ x: Int) -> Int { let y = f1631(x) 
+ return y + 1 }
+func f1633(_ x: Int) -> Int { let y = f1632(x) 
+ return y + 1 }
+func f1634(_ x: Int) -> Int { let y = f1633(x) 
+ return y + 1 }
+func f1635(_ x: Int) -> Int { let y = f1634(x) 
+ return y + 1 }
+func f1636(_ x: Int) -> Int { let y = f1635(x) 
+ return y + 1 }
+func f1637(_ x: Int) -> Int { let y = f1636(x) 
+ return y + 1 }
+func f1638(_ x: Int) -> Int { let y = f1637(x) 
+ return y + 1 }
+func f1639(_ x: Int) -> Int { let y = f1638(x) 
+ return y + 1 }
+func f1640(_ x: Int) -> Int { let y = f1639(x) 
+ return y + 1 }
+func f1641(_ x: Int) -> Int { let y = f1640(x) 
+ return y + 1 }
+func f1642(_ x: Int) -> Int { let y = f1641(x) 
+ return y + 1 }
+func f1643(_ x: Int) -> Int { let y = f1642(x) 
+ return y + 1 }
+func f1644(_ x: Int) -> Int { let y = f1643(x) 
+ return y + 1 }
+func f1645(_ x: Int) -> Int { let y = f1644(x) 
+ return y + 1 }
+func f1646(_ x: Int) -> Int { let y = f1645(x) 
+ return y + 1 }
+func f1647(_ x: Int) -> Int { let y = f1646(x) 
+ return y + 1 }
+func f1648(_ x: Int) -> Int { let y = f1647(x) 
+ return y + 1 }
+func f1649(_ x: Int) -> Int { let y = f1648(x) 
+ return y + 1 }
+func f1650(_ x: Int) -> Int { let y = f1649(x) 
+ return y + 1 }
+func f1651(_ x: Int) -> Int { let y = f1650(x) 
+ return y + 1 }
+func f1652(_ x: Int) -> Int { let y = f1651(x) 
+ return y + 1 }
+func f1653(_ x: Int) -> Int { let y = f1652(x) 
+ return y + 1 }
+func f1654(_ x: Int) -> Int { let y = f1653(x) 
+ return y + 1 }
+func f1655(_ x: Int) -> Int { let y = f1654(x) 
+ return y + 1 }
+func f1656(_ x: Int) -> Int { let y = f1655(x) 
+ return y + 1 }
+func f1657(_ x: Int) -> Int { let y = f1656(x) 
+ return y + 1 }
+func f1658(_ x: Int) -> Int { let y = f1657(x) 
+ return y + 1 }
+func f1659(_ x: Int) -> Int { let y = f1658(x) 
+ return y + 1 }
+func f1660(_ x: Int) -> Int { let y = f1659(x) 
+ return y + 1 }
+func f1661(_ x: Int) -> Int { let y = f1660(x) 
+ return y + 1 }
+func f1662(_ x: Int) -> Int { let y = f1661(x) 
+ return y + 1 }
+func f1663(_ x: Int) -> Int { let y = f1662(x) 
+ return y + 1 }
+func f1664(_ x: Int) -> Int { let y = f1663(x) 
+ return y + 1 }
+func f1665(_ x: Int) -> Int { let y = f1664(x) 
+ return y + 1 }
+func f1666(_ x: Int) -> Int { let y = f1665(x) 
+ return y + 1 }
+func f1667(_ x: Int) -> Int { let y = f1666(x) 
+ return y + 1 }
+func f1668(_ x: Int) -> Int { let y = f1667(x) 
+ return y + 1 }
+func f1669(_ x: Int) -> Int { let y = f1668(x) 
+ return y + 1 }
+func f1670(_ x: Int) -> Int { let y = f1669(x) 
+ return y + 1 }
+func f1671(_ x: Int) -> Int { let y = f1670(x) 
+ return y + 1 }
+func f1672(_ x: Int) -> Int { let y = f1671(x) 
+ return y + 1 }
+func f1673(_ x: Int) -> Int { let y = f1672(x) 
+ return y + 1 }
+func f1674(_ x: Int) -> Int { let y = f1673(x) 
+ return y + 1 }
+func f1675(_ x: Int) -> Int { let y = f1674(x) 
+ return y + 1 }
+func f1676(_ x: Int) -> Int { let y = f1675(x) 
+ return y + 1 }
+func f1677(_ x: Int) -> Int { let y = f1676(x) 
+ return y + 1 }
+func f1678(_ x: Int) -> Int { let y = f1677(x) 
+ return y + 1 }
+func f1679(_ x: Int) -> Int { let y = f1678(x) 
+ return y + 1 }
+func f1680(_ x: Int) -> Int { let y = f1679(x) 
+ return y + 1 }
+func f1681(_ x: Int) -> Int { let y = f1680(x) 
+ return y + 1 }
+func f1682(_ x: Int) -> Int { let y = f1681(x) 
+ return y + 1 }
+func f1683(_ x: Int) -> Int { let y = f1682(x) 
+ return y + 1 }
+func f1684(_ x: Int) -> Int { let y = f1683(x) 
+ return y + 1 }
+func f1685(_ x: Int) -> Int { let y = f1684(x) 
+ return y + 1 }
+func f1686(_ x: Int) -> Int { let y = f1685(x) 
+ return y + 1 }
+func f1687(_ x: Int) -> Int { let y = f1686(x) 
+ return y + 1 }
+func f1688(_ x: Int) -> Int { let y = f1687(x) 
+ return y + 1 }
+func f1689(_ x: Int) -> Int { let y = f1688(x) 
+ return y + 1 }
+func f1690(_ x: Int) -> Int { let y = f1689(x) 
+ return y + 1 }
+func f1691(_ x: Int) -> Int { let y = f1690(x) 
+ return y + 1 }
+func f1692(_ x: Int) -> Int { let y = f1691(x) 
+ return y + 1 }
+func f1693(_ x: Int) -> Int { let y = f1692(x) 
+ return y + 1 }
+func f1694(_ x: Int) -> Int { let y = f1693(x) 
+ return y + 1 }
+func f1695(_ x: Int) -> Int { let y = f1694(x) 
+ return y + 1 }
+func f1696(_ x: Int) -> Int { let y = f1695(x) 
+ return y + 1 }
+func f1697(_ x: Int) -> Int { let y = f1696(x) 
+ return y + 1 }
+func f1698(_ x: Int) -> Int { let y = f1697(x) 
+ return y + 1 }
+func f1699(_ x: Int) -> Int { let y = f1698(x) 
+ return y + 1 }
+func f1700(_ x: Int) -> Int { let y = f1699(x) 
+ return y + 1 }
+func f1701(_ x: Int) -> Int { let y = f1700(x) 
+ return y + 1 }
+func f1702(_ x: Int) -> Int { let y = f1701(x) 
+ return y + 1 }
+func f1703(_ x: Int) -> Int { let y = f1702(x) 
+ return y + 1 }
+func f1704(_ x: Int) -> Int { let y = f1703(x) 
+ return y + 1 }
+func f1705(_ x: Int) -> Int { let y = f1704(x) 
+ return y + 1 }
+func f1706(_ x: Int) -> Int { let y = f1705(x) 
+ return y + 1 }
+func f1707(_ x: Int) -> Int { let y = f1706(x) 
+ return y + 1 }
+func f1708(_ x: Int) -> Int { let y = f1707(x) 
+ return y + 1 }
+func f1709(_ x: Int) -> Int { let y = f1708(x) 
+ return y + 1 }
+func f1710(_ x: Int) -> Int { let y = f1709(x) 
+ return y + 1 }
+func f1711(_ x: Int) -> Int { let y = f1710(x) 
+ return y + 1 }
+func f1712(_ x: Int) -> Int { let y = f1711(x) 
+ return y + 1 }
+func f1713(_ x: Int) -> Int { let y = f1712(x) 
+ return y + 1 }
+func f1714(_ x: Int) -> Int { let y = f1713(x) 
+ return y + 1 }
+func f1715(_ x: Int) -> Int { let y = f1714(x) 
+ return y + 1 }
+func f1716(_ x: Int) -> Int { let y = f1715(x) 
+ return y + 1 }
+func f1717(_ x: Int) -> Int { let y = f1716(x) 
+ return y + 1 }
+func f1718(_ x: Int) -> Int { let y = f1717(x) 
+ return y + 1 }
+func f1719(_ x: Int) -> Int { let y = f1718(x) 
+ return y + 1 }
+func f1720(_ x: Int) -> Int { let y = f1719(x) 
+ return y + 1 }
+func f1721(_ x: Int) -> Int { let y = f1720(x) 
+ return y + 1 }
+func f1722(_ x: Int) -> Int { let y = f1721(x) 
+ return y + 1 }
+func f1723(_ x: Int) -> Int { let y = f1722(x) 
+ return y + 1 }
+func f1724(_ x: Int) -> Int { let y = f1723(x) 
+ return y + 1 }
+func f1725(_ x: Int) -> Int { let y = f1724(x) 
+ return y + 1 }
+func f1726(_ x: Int) -> Int { let y = f1725(x) 
+ return y + 1 }
+func f1727(_ x: Int) -> Int { let y = f1726(x) 
+ return y + 1 }
+func f1728(_ x: Int) -> Int { let y = f1727(x) 
+ return y + 1 }
+func f1729(_ x: Int) -> Int { let y = f1728(x) 
+ return y + 1 }
+func f1730(_ x: Int) -> Int { let y = f1729(x) 
+ return y + 1 }
+func f1731(_ x: Int) -> Int { let y = f1730(x) 
+ return y + 1 }
+func f1732(_ x: Int) -> Int { let y = f1731(x) 
+ return y + 1 }
+func f1733(_ x: Int) -> Int { let y = f1732(x) 
+ return y + 1 }
+func f1734(_ x: Int) -> Int { let y = f1733(x) 
+ return y + 1 }
+func f1735(_ x: Int) -> Int { let y = f1734(x) 
+ return y + 1 }
+func f1736(_ x: Int) -> Int { let y = f1735(x) 
+ return y + 1 }
+func f1737(_ x: Int) -> Int { let y = f1736(x) 
+ return y + 1 }
+func f1738(_ x: Int) -> Int { let y = f1737(x) 
+ return y + 1 }
+func f1739(_ x: Int) -> Int { let y = f1738(x) 
+ return y + 1 }
+func f1740(_ x: Int) -> Int { let y = f1739(x) 
+ return y + 1 }
+func f1741(_ x: Int) -> Int { let y = f1740(x) 
+ return y + 1 }
+func f1742(_ x: Int) -> Int { let y = f1741(x) 
+ return y + 1 }
+func f1743(_ x: Int) -> Int { let y = f1742(x) 
+ return y + 1 }
+func f1744(_ x: Int) -> Int { let y = f1743(x) 
+ return y + 1 }
+func f1745(_ x: Int) -> Int { let y = f1744(x) 
+ return y + 1 }
+func f1746(_ x: Int) -> Int { let y = f1745(x) 
+ return y + 1 }
+func f1747(_ x: Int) -> Int { let y = f1746(x) 
+ return y + 1 }
+func f1748(_ x: Int) -> Int { let y = f1747(x) 
+ return y + 1 }
+func f1749(_ x: Int) -> Int { let y = f1748(x) 
+ return y + 1 }
+func f1750(_ x: Int) -> Int { let y = f1749(x) 
+ return y + 1 }
+func f1751(_ x: Int) -> Int { let y = f1750(x) 
+ return y + 1 }
+func f1752(_ x: Int) -> Int { let y = f1751(x) 
+ return y + 1 }
+func f1753(_ x: Int) -> Int { let y = f1752(x) 
+ return y + 1 }
+func f1754(_ x: Int) -> Int { let y = f1753(x) 
+ return y + 1 }
+func f1755(_ x: Int) -> Int { let y = f1754(x) 
+ return y + 1 }
+func f1756(_ x: Int) -> Int { let y = f1755(x) 
+ return y + 1 }
+func f1757(_ x: Int) -> Int { let y = f1756(x) 
+ return y + 1 }
+func f1758(_ x: Int) -> Int { let y = f1757(x) 
+ return y + 1 }
+func f1759(_ x: Int) -> Int { let y = f1758(x) 
+ return y + 1 }
+func f1760(_ x: Int) -> Int { let y = f1759(x) 
+ return y + 1 }
+func f1761(_ x: Int) -> Int { let y = f1760(x) 
+ return y + 1 }
+func f1762(_ x: Int) -> Int { let y = f1761(x) 
+ return y + 1 }
+func f1763(_ x: Int) -> Int { let y = f1762(x) 
+ return y + 1 }
+func f1764(_ x: Int) -> Int { let y = f1763(x) 
+ return y + 1 }
+func f1765(_ x: Int) -> Int { let y = f1764(x) 
+ return y + 1 }
+func f1766(_ x: Int) -> Int { let y = f1765(x) 
+ return y + 1 }
+func f1767(_ x: Int) -> Int { let y = f1766(x) 
+ return y + 1 }
+func f1768(_ x: Int) -> Int { let y = f1767(x) 
+ return y + 1 }
+func f1769(_ x: Int) -> Int { let y = f1768(x) 
+ return y + 1 }
+func f1770(_ x: Int) -> Int { let y = f1769(x) 
+ return y + 1 }
+func f1771(_ x: Int) -> Int { let y = f1770(x) 
+ return y + 1 }
+func f1772(_ x: Int) -> Int { let y = f1771(x) 
+ return y + 1 }
+func f1773(_ x: Int) -> Int { let y = f1772(x) 
+ return y + 1 }
+func f1774(_ x: Int) -> Int { let y = f1773(x) 
+ return y + 1 }
+func f1775(_ x: Int) -> Int { let y = f1774(x) 
+ return y + 1 }
+func f1776(_ x: Int) -> Int { let y = f1775(x) 
+ return y + 1 }
+func f1777(_ x: Int) -> Int { let y = f1776(x) 
+ return y + 1 }
+func f1778(_ x: Int) -> Int { let y = f1777(x) 
+ return y + 1 }
+func f1779(_ x: Int) -> Int { let y = f1778(x) 
+ return y + 1 }
+func f1780(_ x: Int) -> Int { let y = f1779(x) 
+ return y + 1 }
+func f1781(_ x: Int) -> Int { let y = f1780(x) 
+ return y + 1 }
+func f1782(_ x: Int) -> Int { let y = f1781(x) 
+ return y + 1 }
+func f1783(_ x: Int) -> Int { let y = f1782(x) 
+ return y + 1 }
+func f1784(_ x: Int) -> Int { let y = f1783(x) 
+ return y + 1 }
+func f1785(_ x: Int) -> Int { let y = f1784(x) 
+ return y + 1 }
+func f1786(_ x: Int) -> Int { let y = f1785(x) 
+ return y + 1 }
+func f1787(_ x: Int) -> Int { let y = f1786(x) 
+ return y + 1 }
+func f1788(_ x: Int) -> Int { let y = f1787(x) 
+ return y + 1 }
+func f1789(_ x: Int) -> Int { let y = f1788(x) 
+ return y + 1 }
+func f1790(_ x: Int) -> Int { let y = f1789(x) 
+ return y + 1 }
+func f1791(_ x: Int) -> Int { let y = f1790(x) 
+ return y + 1 }
+func f1792(_ x: Int) -> Int { let y = f1791(x) 
+ return y + 1 }
+func f1793(_ x: Int) -> Int { let y = f1792(x) 
+ return y + 1 }
+func f1794(_ x: Int) -> Int { let y = f1793(x) 
+ return y + 1 }
+func f1795(_ x: Int) -> Int { let y = f1794(x) 
+ return y + 1 }
+func f1796(_ x: Int) -> Int { let y = f1795(x) 
+ return y + 1 }
+func f1797(_ x: Int) -> Int { let y = f1796(x) 
+ return y + 1 }
+func f1798(_ x: Int) -> Int { let y = f1797(x) 
+ return y + 1 }
+func f1799(_ x: Int) -> Int { let y = f1798(x) 
+ return y + 1 }
+func f1800(_ x: Int) -> Int { let y = f1799(x) 
+ return y + 1 }
+func f1801(_ x: Int) -> Int { let y = f1800(x) 
+ return y + 1 }
+func f1802(_ x: Int) -> Int { let y = f1801(x) 
+ return y + 1 }
+func f1803(_ x: Int) -> Int { let y = f1802(x) 
+ return y + 1 }
+func f1804(_ x: Int) -> Int { let y = f1803(x) 
+ return y + 1 }
+func f1805(_ x: Int) -> Int { let y = f1804(x) 
+ return y + 1 }
+func f1806(_ x: Int) -> Int { let y = f1805(x) 
+ return y + 1 }
+func f1807(_ x: Int) -> Int { let y = f1806(x) 
+ return y + 1 }
+func f1808(_ x: Int) -> Int { let y = f1807(x) 
+ return y + 1 }
+func f1809(_ x: Int) -> Int { let y = f1808(x) 
+ return y + 1 }
+func f1810(_ x: Int) -> Int { let y = f1809(x) 
+ return y + 1 }
+func f1811(_ x: Int) -> Int { let y = f1810(x) 
+ return y + 1 }
+func f1812(_ x: Int) -> Int { let y = f1811(x) 
+ return y + 1 }
+func f1813(_ x: Int) -> Int { let y = f1812(x) 
+ return y + 1 }
+func f1814(_ x: Int) -> Int { let y = f1813(x) 
+ return y + 1 }
+func f1815(_ x: Int) -> Int { let y = f1814(x) 
+ return y + 1 }
+func f1816(_ x: Int) -> Int { let y = f1815(x) 
+ return y + 1 }
+func f1817(_ x: Int) -> Int { let y = f1816(x) 
+ return y + 1 }
+func f1818(_ x: Int) -> Int { let y = f1817(x) 
+ return y + 1 }
+func f1819(_ x: Int) -> Int { let y = f1818(x) 
+ return y + 1 }
+func f1820(_ x: Int) -> Int { let y = f1819(x) 
+ return y + 1 }
+func f1821(_ x: Int) -> Int { let y = f1820(x) 
+ return y + 1 }
+func f1822(_ x: Int) -> Int { let y = f1821(x) 
+ return y + 1 }
+func f1823(_ x: Int) -> Int { let y = f1822(x) 
+ return y + 1 }
+func f1824(_ x: Int) -> Int { let y = f1823(x) 
+ return y + 1 }
+func f1825(_ x: Int) -> Int { let y = f1824(x) 
+ return y + 1 }
+func f1826(_ x: Int) -> Int { let y = f1825(x) 
+ return y + 1 }
+func f1827(_ x: Int) -> Int { let y = f1826(x) 
+ return y + 1 }
+func f1828(_ x: Int) -> Int { let y = f1827(x) 
+ return y + 1 }
+func f1829(_ x: Int) -> Int { let y = f1828(x) 
+ return y + 1 }
+func f1830(_ x: Int) -> Int { let y = f1829(x) 
+ return y + 1 }
+func f1831(_ x: Int) -> Int { let y = f1830(x) 
+ return y + 1 }
+func f1832(_ x: Int) -> Int { let y = f1831(x) 
+ return y + 1 }
+func f1833(_ x: Int) -> Int { let y = f1832(x) 
+ return y + 1 }
+func f1834(_ x: Int) -> Int { let y = f1833(x) 
+ return y + 1 }
+func f1835(_ x: Int) -> Int { let y = f1834(x) 
+ return y + 1 }
+func f1836(_ x: Int) -> Int { let y = f1835(x) 
+ return y + 1 }
+func f1837(_ x: Int) -> Int { let y = f1836(x) 
+ return y + 1 }
+func f1838(_ x: Int) -> Int { let y = f1837(x) 
+ return y + 1 }
+func f1839(_ x: Int) -> Int { let y = f1838(x) 
+ return y + 1 }
+func f1840(_ x: Int) -> Int { let y = f1839(x) 
+ return y + 1 }
+func f1841(_ x: Int) -> Int { let y = f1840(x) 
+ return y + 1 }
+func f1842(_ x: Int) -> Int { let y = f1841(x) 
+ return y + 1 }
+func f1843(_ x: Int) -> Int { let y = f1842(x) 
+ return y + 1 }
+func f1844(_ x: Int) -> Int { let y = f1843(x) 
+ return y + 1 }
+func f1845(_ x: Int) -> Int { let y = f1844(x) 
+ return y + 1 }
+func f1846(_ x: Int) -> Int { let y = f1845(x) 
+ return y + 1 }
+func f1847(_ x: Int) -> Int { let y = f1846(x) 
+ return y + 1 }
+func f1848(_ x: Int) -> Int { let y = f1847(x) 
+ return y + 1 }
+func f1849(_ x: Int) -> Int { let y = f1848(x) 
+ return y + 1 }
+func f1850(_ x: Int) -> Int { let y = f1849(x) 
+ return y + 1 }
+func f1851(_ x: Int) -> Int { let y = f1850(x) 
+ return y + 1 }
+func f1852(_ x: Int) -> Int { let y = f1851(x) 
+ return y + 1 }
+func f1853(_ x: Int) -> Int { let y = f1852(x) 
+ return y + 1 }
+func f1854(_ x: Int) -> Int { let y = f1853(x) 
+ return y + 1 }
+func f1855(_ x: Int) -> Int { let y = f1854(x) 
+ return y + 1 }
+func f1856(_ x: Int) -> Int { let y = f1855(x) 
+ return y + 1 }
+func f1857(_ x: Int) -> Int { let y = f1856(x) 
+ return y + 1 }
+func f1858(_ x: Int) -> Int { let y = f1857(x) 
+ return y + 1 }
+func f1859(_ x: Int) -> Int { let y = f1858(x) 
+ return y + 1 }
+func f1860(_ x: Int) -> Int { let y = f1859(x) 
+ return y + 1 }
+func f1861(_ x: Int) -> Int { let y = f1860(x) 
+ return y + 1 }
+func f1862(_ x: Int) -> Int { let y = f1861(x) 
+ return y + 1 }
+func f1863(_ x: Int) -> Int { let y = f1862(x) 
+ return y + 1 }
+func f1864(_ x: Int) -> Int { let y = f1863(x) 
+ return y + 1 }
+func f1865(_ x: Int) -> Int { let y = f1864(x) 
+ return y + 1 }
+func f1866(_ x: Int) -> Int { let y = f1865(x) 
+ return y + 1 }
+func f1867(_ x: Int) -> Int { let y = f1866(x) 
+ return y + 1 }
+func f1868(_ x: Int) -> Int { let y = f1867(x) 
+ return y + 1 }
+func f1869(_ x: Int) -> Int { let y = f1868(x) 
+ return y + 1 }
+func f1870(_ x: Int) -> Int { let y = f1869(x) 
+ return y + 1 }
+func f1871(_ x: Int) -> Int { let y = f1870(x) 
+ return y + 1 }
+func f1872(_ x: Int) -> Int { let y = f1871(x) 
+ return y + 1 }
+func f1873(_ x: Int) -> Int { let y = f1872(x) 
+ return y + 1 }
+func f1874(_ x: Int) -> Int { let y = f1873(x) 
+ return y + 1 }
+func f1875(_ x: Int) -> Int { let y = f1874(x) 
+ return y + 1 }
+func f1876(_ x: Int) -> Int { let y = f1875(x) 
+ return y + 1 }
+func f1877(_ x: Int) -> Int { let y = f1876(x) 
+ return y + 1 }
+func f1878(_ x: Int) -> Int { let y = f1877(x) 
+ return y + 1 }
+func f1879(_ x: Int) -> Int { let y = f1878(x) 
+ return y + 1 }
+func f1880(_ x: Int) -> Int { let y = f1879(x) 
+ return y + 1 }
+func f1881(_ x: Int) -> Int { let y = f1880(x) 
+ return y + 1 }
+func f1882(_ x: Int) -> Int { let y = f1881(x) 
+ return y + 1 }
+func f1883(_ x: Int) -> Int { let y = f1882(x) 
+ return y + 1 }
+func f1884(_ x: Int) -> Int { let y = f1883(x) 
+ return y + 1 }
+func f1885(_ x: Int) -> Int { let y = f1884(x) 
+ return y + 1 }
+func f1886(_ x: Int) -> Int { let y = f1885(x) 
+ return y + 1 }
+func f1887(_ x: Int) -> Int { let y = f1886(x) 
+ return y + 1 }
+func f1888(_ x: Int) -> Int { let y = f1887(x) 
+ return y + 1 }
+func f1889(_ x: Int) -> Int { let y = f1888(x) 
+ return y + 1 }
+func f1890(_ x: Int) -> Int { let y = f1889(x) 
+ return y + 1 }
+func f1891(_ x: Int) -> Int { let y = f1890(x) 
+ return y + 1 }
+func f1892(_ x: Int) -> Int { let y = f1891(x) 
+ return y + 1 }
+func f1893(_ x: Int) -> Int { let y = f1892(x) 
+ return y + 1 }
+func f1894(_ x: Int) -> Int { let y = f1893(x) 
+ return y + 1 }
+func f1895(_ x: Int) -> Int { let y = f1894(x) 
+ return y + 1 }
+func f1896(_ x: Int) -> Int { let y = f1895(x) 
+ return y + 1 }
+func f1897(_ x: Int) -> Int { let y = f1896(x) 
+ return y + 1 }
+func f1898(_ x: Int) -> Int { let y = f1897(x) 
+ return y + 1 }
+func f1899(_ x: Int) -> Int { let y = f1898(x) 
+ return y + 1 }
+func f1900(_ x: Int) -> Int { let y = f1899(x) 
+ return y + 1 }
+func f1901(_ x: Int) -> Int { let y = f1900(x) 
+ return y + 1 }
+func f1902(_ x: Int) -> Int { let y = f1901(x) 
+ return y + 1 }
+func f1903(_ x: Int) -> Int { let y = f1902(x) 
+ return y + 1 }
+func f1904(_ x: Int) -> Int { let y = f1903(x) 
+ return y + 1 }
+func f1905(_ x: Int) -> Int { let y = f1904(x) 
+ return y + 1 }
+func f1906(_ x: Int) -> Int { let y = f1905(x) 
+ return y + 1 }
+func f1907(_ x: Int) -> Int { let y = f1906(x) 
+ return y + 1 }
+func f1908(_ x: Int) -> Int { let y = f1907(x) 
+ return y + 1 }
+func f1909(_ x: Int) -> Int { let y = f1908(x) 
+ return y + 1 }
+func f1910(_ x: Int) -> Int { let y = f1909(x) 
+ return y + 1 }
+func f1911(_ x: Int) -> Int { let y = f1910(x) 
+ return y + 1 }
+func f1912(_ x: Int) -> Int { let y = f1911(x) 
+ return y + 1 }
+func f1913(_ x: Int) -> Int { let y = f1912(x) 
+ return y + 1 }
+func f1914(_ x: Int) -> Int { let y = f1913(x) 
+ return y + 1 }
+func f1915(_ x: Int) -> Int { let y = f1914(x) 
+ return y + 1 }
+func f1916(_ x: Int) -> Int { let y = f1915(x) 
+ return y + 1 }
+func f1917(_ x: Int) -> Int { let y = f1916(x) 
+ return y + 1 }
+func f1918(_ x: Int) -> Int { let y = f1917(x) 
+ return y + 1 }
+func f1919(_ x: Int) -> Int { let y = f1918(x) 
+ return y + 1 }
+func f1920(_ x: Int) -> Int { let y = f1919(x) 
+ return y + 1 }
+func f1921(_ x: Int) -> Int { let y = f1920(x) 
+ return y + 1 }
+func f1922(_ x: Int) -> Int { let y = f1921(x) 
+ return y + 1 }
+func f1923(_ x: Int) -> Int { let y = f1922(x) 
+ return y + 1 }
+func f1924(_ x: Int) -> Int { let y = f1923(x) 
+ return y + 1 }
+func f1925(_ x: Int) -> Int { let y = f1924(x) 
+ return y + 1 }
+func f1926(_ x: Int) -> Int { let y = f1925(x) 
+ return y + 1 }
+func f1927(_ x: Int) -> Int { let y = f1926(x) 
+ return y + 1 }
+func f1928(_ x: Int) -> Int { let y = f1927(x) 
+ return y + 1 }
+func f1929(_ x: Int) -> Int { let y = f1928(x) 
+ return y + 1 }
+func f1930(_ x: Int) -> Int { let y = f1929(x) 
+ return y + 1 }
+func f1931(_ x: Int) -> Int { let y = f1930(x) 
+ return y + 1 }
+func f1932(_ x: Int) -> Int { let y = f1931(x) 
+ return y + 1 }
+func f1933(_ x: Int) -> Int { let y = f1932(x) 
+ return y + 1 }
+func f1934(_ x: Int) -> Int { let y = f1933(x) 
+ return y + 1 }
+func f1935(_ x: Int) -> Int { let y = f1934(x) 
+ return y + 1 }
+func f1936(_ x: Int) -> Int { let y = f1935(x) 
+ return y + 1 }
+func f1937(_ x: Int) -> Int { let y = f1936(x) 
+ return y + 1 }
+func f1938(_ x: Int) -> Int { let y = f1937(x) 
+ return y + 1 }
+func f1939(_ x: Int) -> Int { let y = f1938(x) 
+ return y + 1 }
+func f1940(_ x: Int) -> Int { let y = f1939(x) 
+ return y + 1 }
+func f1941(_ x: Int) -> Int { let y = f1940(x) 
+ return y + 1 }
+func f1942(_ x: Int) -> Int { let y = f1941(x) 
+ return y + 1 }
+func f1943(_ x: Int) -> Int { let y = f1942(x) 
+ return y + 1 }
+func f1944(_ x: Int) -> Int { let y = f1943(x) 
+ return y + 1 }
+func f1945(_ x: Int) -> Int { let y = f1944(x) 
+ return y + 1 }
+func f1946(_ x: Int) -> Int { let y = f1945(x) 
+ return y + 1 }
+func f1947(_ x: Int) -> Int { let y = f1946(x) 
+ return y + 1 }
+func f1948(_ x: Int) -> Int { let y = f1947(x) 
+ return y + 1 }
+func f1949(_ x: Int) -> Int { let y = f1948(x) 
+ return y + 1 }
+func f1950(_ x: Int) -> Int { let y = f1949(x) 
+ return y + 1 }
+func f1951(_ x: Int) -> Int { let y = f1950(x) 
+ return y + 1 }
+func f1952(_ x: Int) -> Int { let y = f1951(x) 
+ return y + 1 }
+func f1953(_ x: Int) -> Int { let y = f1952(x) 
+ return y + 1 }
+func f1954(_ x: Int) -> Int { let y = f1953(x) 
+ return y + 1 }
+func f1955(_ x: Int) -> Int { let y = f1954(x) 
+ return y + 1 }
+func f1956(_ x: Int) -> Int { let y = f1955(x) 
+ return y + 1 }
+func f1957(_ x: Int) -> Int { let y = f1956(x) 
+ return y + 1 }
+func f1958(_ x: Int) -> Int { let y = f1957(x) 
+ return y + 1 }
+func f1959(_ x: Int) -> Int { let y = f1958(x) 
+ return y + 1 }
+func f1960(_ x: Int) -> Int { let y = f1959(x) 
+ return y + 1 }
+func f1961(_ x: Int) -> Int { let y = f1960(x) 
+ return y + 1 }
+func f1962(_ x: Int) -> Int { let y = f1961(x) 
+ return y + 1 }
+func f1963(_ x: Int) -> Int { let y = f1962(x) 
+ return y + 1 }
+func f1964(_ x: Int) -> Int { let y = f1963(x) 
+ return y + 1 }
+func f1965(_ x: Int) -> Int { let y = f1964(x) 
+ return y + 1 }
+func f1966(_ x: Int) -> Int { let y = f1965(x) 
+ return y + 1 }
+func f1967(_ x: Int) -> Int { let y = f1966(x) 
+ return y + 1 }
+func f1968(_ x: Int) -> Int { let y = f1967(x) 
+ return y + 1 }
+func f1969(_ x: Int) -> Int { let y = f1968(x) 
+ return y + 1 }
+func f1970(_ x: Int) -> Int { let y = f1969(x) 
+ return y + 1 }
+func f1971(_ x: Int) -> Int { let y = f1970(x) 
+ return y + 1 }
+func f1972(_ x: Int) -> Int { let y = f1971(x) 
+ return y + 1 }
+func f1973(_ x: Int) -> Int { let y = f1972(x) 
+ return y + 1 }
+func f1974(_ x: Int) -> Int { let y = f1973(x) 
+ return y + 1 }
+func f1975(_ x: Int) -> Int { let y = f1974(x) 
+ return y + 1 }
+func f1976(_ x: Int) -> Int { let y = f1975(x) 
+ return y + 1 }
+func f1977(_ x: Int) -> Int { let y = f1976(x) 
+ return y + 1 }
+func f1978(_ x: Int) -> Int { let y = f1977(x) 
+ return y + 1 }
+func f1979(_ x: Int) -> Int { let y = f1978(x) 
+ return y + 1 }
+func f1980(_ x: Int) -> Int { let y = f1979(x) 
+ return y + 1 }
+func f1981(_ x: Int) -> Int { let y = f1980(x) 
+ return y + 1 }
+func f1982(_ x: Int) -> Int { let y = f1981(x) 
+ return y + 1 }
+func f1983(_ x: Int) -> Int { let y = f1982(x) 
+ return y + 1 }
+func f1984(_ x: Int) -> Int { let y = f1983(x) 
+ return y + 1 }
+func f1985(_ x: Int) -> Int { let y = f1984(x) 
+ return y + 1 }
+func f1986(_ x: Int) -> Int { let y = f1985(x) 
+ return y + 1 }
+func f1987(_ x: Int) -> Int { let y = f1986(x) 
+ return y + 1 }
+func f1988(_ x: Int) -> Int { let y = f1987(x) 
+ return y + 1 }
+func f1989(_ x: Int) -> Int { let y = f1988(x) 
+ return y + 1 }
+func f1990(_ x: Int) -> Int { let y = f1989(x) 
+ return y + 1 }
+func f1991(_ x: Int) -> Int { let y = f1990(x) 
+ return y + 1 }
+func f1992(_ x: Int) -> Int { let y = f1991(x) 
+ return y + 1 }
+func f1993(_ x: Int) -> Int { let y = f1992(x) 
+ return y + 1 }
+func f1994(_ x: Int) -> Int { let y = f1993(x) 
+ return y + 1 }
+func f1995(_ x: Int) -> Int { let y = f1994(x) 
+ return y + 1 }
+func f1996(_ x: Int) -> Int { let y = f1995(x) 
+ return y + 1 }
+func f1997(_ x: Int) -> Int { let y = f1996(x) 
+ return y + 1 }
+func f1998(_ x: Int) -> Int { let y = f1997(x) 
+ return y + 1 }
+func f1999(_ x: Int) -> Int { let y = f1998(x) 
+ return y + 1 }
+func f2000(_ x: Int) -> Int { let y = f1999(x) 
+ return y + 1 }
+func f2001(_ x: Int) -> Int { let y = f2000(x) 
+ return y + 1 }
+func f2002(_ x: Int) -> Int { let y = f2001(x) 
+ return y + 1 }
+func f2003(_ x: Int) -> Int { let y = f2002(x) 
+ return y + 1 }
+func f2004(_ x: Int) -> Int { let y = f2003(x) 
+ return y + 1 }
+func f2005(_ x: Int) -> Int { let y = f2004(x) 
+ return y + 1 }
+func f2006(_ x: Int) -> Int { let y = f2005(x) 
+ return y + 1 }
+func f2007(_ x: Int) -> Int { let y = f2006(x) 
+ return y + 1 }
+func f2008(_ x: Int) -> Int { let y = f2007(x) 
+ return y + 1 }
+func f2009(_ x: Int) -> Int { let y = f2008(x) 
+ return y + 1 }
+func f2010(_ x: Int) -> Int { let y = f2009(x) 
+ return y + 1 }
+func f2011(_ x: Int) -> Int { let y = f2010(x) 
+ return y + 1 }
+func f2012(_ x: Int) -> Int { let y = f2011(x) 
+ return y + 1 }
+func f2013(_ x: Int) -> Int { let y = f2012(x) 
+ return y + 1 }
+func f2014(_ x: Int) -> Int { let y = f2013(x) 
+ return y + 1 }
+func f2015(_ x: Int) -> Int { let y = f2014(x) 
+ return y + 1 }
+func f2016(_ x: Int) -> Int { let y = f2015(x) 
+ return y + 1 }
+func f2017(_ x: Int) -> Int { let y = f2016(x) 
+ return y + 1 }
+func f2018(_ x: Int) -> Int { let y = f2017(x) 
+ return y + 1 }
+func f2019(_ x: Int) -> Int { let y = f2018(x) 
+ return y + 1 }
+func f2020(_ x: Int) -> Int { let y = f2019(x) 
+ return y + 1 }
+func f2021(_ x: Int) -> Int { let y = f2020(x) 
+ return y + 1 }
+func f2022(_ x: Int) -> Int { let y = f2021(x) 
+ return y + 1 }
+func f2023(_ x: Int) -> Int { let y = f2022(x) 
+ return y + 1 }
+func f2024(_ x: Int) -> Int { let y = f2023(x) 
+ return y + 1 }
+func f2025(_ x: Int) -> Int { let y = f2024(x) 
+ return y + 1 }
+func f2026(_ x: Int) -> Int { let y = f2025(x) 
+ return y + 1 }
+func f2027(_ x: Int) -> Int { let y = f2026(x) 
+ return y + 1 }
+func f2028(_ x: Int) -> Int { let y = f2027(x) 
+ return y + 1 }
+func f2029(_ x: Int) -> Int { let y = f2028(x) 
+ return y + 1 }
+func f2030(_ x: Int) -> Int { let y = f2029(x) 
+ return y + 1 }
+func f2031(_ x: Int) -> Int { let y = f2030(x) 
+ return y + 1 }
+func f2032(_ x: Int) -> Int { let y = f2031(x) 
+ return y + 1 }
+func f2033(_ x: Int) -> Int { let y = f2032(x) 
+ return y + 1 }
+func f2034(_ x: Int) -> Int { let y = f2033(x) 
+ return y + 1 }
+func f2035(_ x: Int) -> Int { let y = f2034(x) 
+ return y + 1 }
+func f2036(_ x: Int) -> Int { let y = f2035(x) 
+ return y + 1 }
+func f2037(_ x: Int) -> Int { let y = f2036(x) 
+ return y + 1 }
+func f2038(_ x: Int) -> Int { let y = f2037(x) 
+ return y + 1 }
+func f2039(_ x: Int) -> Int { let y = f2038(x) 
+ return y + 1 }
+func f2040(_ x: Int) -> Int { let y = f2039(x) 
+ return y + 1 }
+func f2041(_ x: Int) -> Int { let y = f2040(x) 
+ return y + 1 }
+func f2042(_ x: Int) -> Int { let y = f2041(x) 
+ return y + 1 }
+func f2043(_ x: Int) -> Int { let y = f2042(x) 
+ return y + 1 }
+func f2044(_ x: Int) -> Int { let y = f2043(x) 
+ return y + 1 }
+func f2045(_ x: Int) -> Int { let y = f2044(x) 
+ return y + 1 }
+func f2046(_ x: Int) -> Int { let y = f2045(x) 
+ return y + 1 }
+func f2047(_ x: Int) -> Int { let y = f2046(x) 
+ return y + 1 }
+func f2048(_ x: Int) -> Int { let y = f2047(x) 
+ return y + 1 }
+func f2049(_ x: Int) -> Int { let y = f2048(x) 
+ return y + 1 }
+func f2050(_ x: Int) -> Int { let y = f2049(x) 
+ return y + 1 }
+func f2051(_ x: Int) -> Int { let y = f2050(x) 
+ return y + 1 }
+func f2052(_ x: Int) -> Int { let y = f2051(x) 
+ return y + 1 }
+func f2053(_ x: Int) -> Int { let y = f2052(x) 
+ return y + 1 }
+func f2054(_ x: Int) -> Int { let y = f2053(x) 
+ return y + 1 }
+func f2055(_ x: Int) -> Int { let y = f2054(x) 
+ return y + 1 }
+func f2056(_ x: Int) -> Int { let y = f2055(x) 
+ return y + 1 }
+func f2057(_ x: Int) -> Int { let y = f2056(x) 
+ return y + 1 }
+func f2058(_ x: Int) -> Int { let y = f2057(x) 
+ return y + 1 }
+func f2059(_ x: Int) -> Int { let y = f2058(x) 
+ return y + 1 }
+func f2060(_ x: Int) -> Int { let y = f2059(x) 
+ return y + 1 }
+func f2061(_ x: Int) -> Int { let y = f2060(x) 
+ return y + 1 }
+func f2062(_ x: Int) -> Int { let y = f2061(x) 
+ return y + 1 }
+func f2063(_ x: Int) -> Int { let y = f2062(x) 
+ return y + 1 }
+func f2064(_ x: Int) -> Int { let y = f2063(x) 
+ return y + 1 }
+func f2065(_ x: Int) -> Int { let y = f2064(x) 
+ return y + 1 }
+func f2066(_ x: Int) -> Int { let y = f2065(x) 
+ return y + 1 }
+func f2067(_ x: Int) -> Int { let y = f2066(x) 
+ return y + 1 }
+func f2068(_ x: Int) -> Int { let y = f2067(x) 
+ return y + 1 }
+func f2069(_ x: Int) -> Int { let y = f2068(x) 
+ return y + 1 }
+func f2070(_ x: Int) -> Int { let y = f2069(x) 
+ return y + 1 }
+func f2071(_ x: Int) -> Int { let y = f2070(x) 
+ return y + 1 }
+func f2072(_ x: Int) -> Int { let y = f2071(x) 
+ return y + 1 }
+func f2073(_ x: Int) -> Int { let y = f2072(x) 
+ return y + 1 }
+func f2074(_ x: Int) -> Int { let y = f2073(x) 
+ return y + 1 }
+func f2075(_ x: Int) -> Int { let y = f2074(x) 
+ return y + 1 }
+func f2076(_ x: Int) -> Int { let y = f2075(x) 
+ return y + 1 }
+func f2077(_ x: Int) -> Int { let y = f2076(x) 
+ return y + 1 }
+func f2078(_ x: Int) -> Int { let y = f2077(x) 
+ return y + 1 }
+func f2079(_ x: Int) -> Int { let y = f2078(x) 
+ return y + 1 }
+func f2080(_ x: Int) -> Int { let y = f2079(x) 
+ return y + 1 }
+func f2081(_ x: Int) -> Int { let y = f2080(x) 
+ return y + 1 }
+func f2082(_ x: Int) -> Int { let y = f2081(x) 
+ return y + 1 }
+func f2083(_ x: Int) -> Int { let y = f2082(x) 
+ return y + 1 }
+func f2084(_ x: Int) -> Int { let y = f2083(x) 
+ return y + 1 }
+func f2085(_ x: Int) -> Int { let y = f2084(x) 
+ return y + 1 }
+func f2086(_ x: Int) -> Int { let y = f2085(x) 
+ return y + 1 }
+func f2087(_ x: Int) -> Int { let y = f2086(x) 
+ return y + 1 }
+func f2088(_ x: Int) -> Int { let y = f2087(x) 
+ return y + 1 }
+func f2089(_ x: Int) -> Int { let y = f2088(x) 
+ return y + 1 }
+func f2090(_ x: Int) -> Int { let y = f2089(x) 
+ return y + 1 }
+func f2091(_ x: Int) -> Int { let y = f2090(x) 
+ return y + 1 }
+func f2092(_ x: Int) -> Int { let y = f2091(x) 
+ return y + 1 }
+func f2093(_ x: Int) -> Int { let y = f2092(x) 
+ return y + 1 }
+func f2094(_ x: Int) -> Int { let y = f2093(x) 
+ return y + 1 }
+func f2095(_ x: Int) -> Int { let y = f2094(x) 
+ return y + 1 }
+func f2096(_ x: Int) -> Int { let y = f2095(x) 
+ return y + 1 }
+func f2097(_ x: Int) -> Int { let y = f2096(x) 
+ return y + 1 }
+func f2098(_ x: Int) -> Int { let y = f2097(x) 
+ return y + 1 }
+func f2099(_ x: Int) -> Int { let y = f2098(x) 
+ return y + 1 }
+let r = f2099(0)
+write(r, "\n")
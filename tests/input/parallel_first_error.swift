@@ -0,0 +1,121 @@
+func f0(_ a: Int) -> Int {
+	return a
+}
+func f1(_ a: Int) -> Int {
+	return a
+}
+func f2(_ a: Int) -> Int {
+	return a
+}
+func f3(_ a: Int) -> Int {
+	return a
+}
+func f4(_ a: Int) -> Int {
+	return a
+}
+func f5(_ a: Int) -> Int {
+	return a
+}
+func f6(_ a: Int) -> Int {
+	return a
+}
+func f7(_ a: Int) -> Int {
+	return a
+}
+func f8(_ a: Int) -> Int {
+	return a
+}
+func f9(_ a: Int) -> Int {
+	return a
+}
+func f10(_ a: Int) -> Int {
+	return b
+}
+func f11(_ a: Int) -> Int {
+	return a
+}
+func f12(_ a: Int) -> Int {
+	return a
+}
+func f13(_ a: Int) -> Int {
+	return a
+}
+func f14(_ a: Int) -> Int {
+	return a
+}
+func f15(_ a: Int) -> Int {
+	return a
+}
+func f16(_ a: Int) -> Int {
+	return a
+}
+func f17(_ a: Int) -> Int {
+	return a
+}
+func f18(_ a: Int) -> Int {
+	return a
+}
+func f19(_ a: Int) -> Int {
+	return a
+}
+func f20(_ a: Int) -> Int {
+	return a
+}
+let bad = 1 + "s"
+func f21(_ a: Int) -> Int {
+	return a
+}
+func f22(_ a: Int) -> Int {
+	return a
+}
+func f23(_ a: Int) -> Int {
+	return a
+}
+func f24(_ a: Int) -> Int {
+	return a
+}
+func f25(_ a: Int) -> Int {
+	return a
+}
+func f26(_ a: Int) -> Int {
+	return a
+}
+func f27(_ a: Int) -> Int {
+	return a
+}
+func f28(_ a: Int) -> Int {
+	return a
+}
+func f29(_ a: Int) -> Int {
+	return a
+}
+func f30(_ a: Int) -> Int {
+	return "x"
+}
+func f31(_ a: Int) -> Int {
+	return a
+}
+func f32(_ a: Int) -> Int {
+	return a
+}
+func f33(_ a: Int) -> Int {
+	return a
+}
+func f34(_ a: Int) -> Int {
+	return a
+}
+func f35(_ a: Int) -> Int {
+	return a
+}
+func f36(_ a: Int) -> Int {
+	return a
+}
+func f37(_ a: Int) -> Int {
+	return a
+}
+func f38(_ a: Int) -> Int {
+	return a
+}
+func f39(_ a: Int) -> Int {
+	return a
+}
@@ -0,0 +1,40 @@
+func compare(_ a: Int, _ b: Int) {
+    if a != b {
+        write("ne ")
+    } else {
+        write("eq ")
+    }
+    if a == b {
+        write("eq ")
+    }
+    if a <= b {
+        write("le ")
+    }
+    if a >= b {
+        write("ge ")
+    }
+    let flag = a < b
+    if flag {
+        write("lt")
+    }
+    write("\n")
+}
+
+func scale(_ x: Double, _ n: Int) -> Double {
+    var result = x * 2
+    result = result + 1
+    var i = 0
+    while i != n {
+        result = result / 2
+        i = i + 1
+    }
+    return result
+}
+
+compare(1, 2)
+compare(2, 2)
+compare(3, 2)
+let half = scale(3.0, 1)
+write(half, "\n")
+let same = scale(0.5, 0)
+write(same, "\n")
@@ -0,0 +1,86 @@
+var counter = 0
+
+func fib(_ n: Int) -> Int {
+    if n < 2 {
+        return n
+    } else {
+        let n1 = n - 1
+        let n2 = n - 2
+        let a = fib(n1)
+        let b = fib(n2)
+        return a + b
+    }
+}
+
+func repeatStr(_ s: String, times n: Int) -> String {
+    var result = ""
+    var i = 0
+    while i < n {
+        result = result + s
+        i = i + 1
+    }
+    return result
+}
+
+func usesGlobal(_ x: Int) -> Int {
+    return x + counter
+}
+
+func callsGlobalUser(_ x: Int) -> Int {
+    let y = usesGlobal(x)
+    return y
+}
+
+func logged(_ x: Int) -> Int {
+    write("log ", x, "\n")
+    return x
+}
+
+func strStuff(_ s: String) -> Int? {
+    let l = length(s)
+    let sub = substring(of: s, startingAt: 1, endingBefore: 3)
+    if let sub {
+        let o = ord(sub)
+        return o + l
+    } else {
+        return nil
+    }
+}
+
+func toD(_ x: Int) -> Double {
+    let d = Int2Double(x)
+    return d * 1.5
+}
+
+func nothing(_ x: Int) {
+    let y = x * 2
+}
+
+func divNeg(_ x: Int) -> Int {
+    return x / 2
+}
+
+let f10 = fib(10)
+let f20 = fib(20)
+write(f10, " ", f20, "\n")
+let r = repeatStr("ab", times: 3)
+let big = repeatStr("abcdefgh", times: 100)
+write(r, " ", big, "\n")
+counter = 5
+let g = callsGlobalUser(1)
+let l = logged(3)
+let s1 = strStuff("hello")
+let s2 = strStuff("h")
+write(g, l, s1, s2, "\n")
+let d = toD(3)
+write(d, "\n")
+nothing(4)
+let m5 = 0 - 5
+let n1 = divNeg(m5)
+let n2 = divNeg(7)
+write(n1, n2, "\n")
+var v = 0
+v = fib(12)
+write(v, "\n")
+let c = chr(65)
+write(c, "\n")
@@ -0,0 +1,48 @@
+func reverse(_ s: String) -> String {
+    var result = ""
+    var i = length(s)
+    while i > 0 {
+        let j = i - 1
+        let c = substring(of: s, startingAt: j, endingBefore: i)
+        if let c {
+            result = result + c
+        }
+        i = i - 1
+    }
+    return result
+}
+
+func checksum(_ s: String) -> Int {
+    var sum = 0
+    var i = 0
+    let n = length(s)
+    while i < n {
+        let c = substring(of: s, startingAt: i, endingBefore: n)
+        if let c {
+            let o = ord(c)
+            sum = sum + o
+        }
+        i = i + 1
+    }
+    return sum
+}
+
+let text0 = readString()
+let text = text0 ?? "Hello, world! The quick brown fox jumps over the lazy dog."
+let r = reverse(text)
+write(r, "\n")
+let sum = checksum(text)
+write(sum, "\n")
+let a = substring(of: text, startingAt: 7, endingBefore: 12)
+let b = substring(of: text, startingAt: 12, endingBefore: 7)
+let c = substring(of: text, startingAt: 58, endingBefore: 58)
+let d = substring(of: text, startingAt: 3, endingBefore: 3)
+let e = substring(of: "", startingAt: 0, endingBefore: 0)
+let m1 = 0 - 1
+let f = substring(of: text, startingAt: m1, endingBefore: 2)
+let g = substring(of: text, startingAt: 0, endingBefore: 59)
+let h = substring(of: text, startingAt: 57, endingBefore: 58)
+write(a, b, c, d, e, f, g, h, "\n")
+let o1 = ord("")
+let o2 = ord("A")
+write(o1, " ", o2, "\n")
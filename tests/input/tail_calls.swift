@@ -0,0 +1,74 @@
+// calls of the function itself right before its return reuse the frame
+func sum(_ n: Int, _ acc: Int) -> Int {
+	if n <= 0 {
+		return acc
+	}
+	let m = n - 1
+	let a = acc + n
+	let res = sum(m, a)
+	return res
+}
+
+// the arguments are swapped by the call
+func gcd(_ a: Int, _ b: Int) -> Int {
+	if b == 0 {
+		return a
+	}
+	let r = a - (a / b) * b
+	let g = gcd(b, r)
+	return g
+}
+
+// the result is assigned to a variable declared before
+func digits(_ n: Int, count c: Int) -> Int {
+	var result = c
+	if n >= 10 {
+		let next = n / 10
+		let d = c + 1
+		result = digits(next, count: d)
+		return result
+	}
+	return result
+}
+
+// the result is kept in a global variable, so the call stays
+var calls = 0
+var last = 0
+func countCalls(_ n: Int) -> Int {
+	calls = calls + 1
+	if n == 0 {
+		return calls
+	}
+	let m = n - 1
+	last = countCalls(m)
+	return last
+}
+
+// procedure in a tail position of both branches, the parameter is shadowed
+func countdown(_ n: Int, _ step: Int) {
+	if n > 0 {
+		write(n, " ")
+		let n = n - step
+		countdown(n, step)
+	} else {
+		write("\n")
+		return
+	}
+}
+
+let s0 = readString()
+let s = s0 ?? "tail"
+let l = length(s)
+let k = l * 1000
+let total = sum(k, 0)
+write(total, "\n")
+let x = 1071 * l
+let y = 462 * l
+let g = gcd(x, y)
+write(g, "\n")
+let d = digits(total, count: 1)
+write(d, "\n")
+let c = countCalls(l)
+write(c, " ", calls, " ", last, "\n")
+let from = l * 5
+countdown(from, l)
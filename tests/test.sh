@@ -5,6 +5,9 @@ numberOfArgs=$#
 
 testNum=0
 compilerPath="../bin/compiler"
+# set when the script runs itself again with other compiler options, see the end of the file
+compilerFlags=${compilerFlags:-}
+flagsSuffix=${compilerFlags:+ ($compilerFlags)}
 
 # arguments:
 # 1. name of test
@@ -19,7 +22,7 @@ execTest () {
 		fi
 	fi
 	echo -e "\e[33m--------------------------------\e[0m"
-	bash -c "$compilerPath < $2 > tmp_output.txt 2>&1"
+	bash -c "$compilerPath $compilerFlags < $2 > tmp_output.txt 2>&1"
 	returnCode=$?
 	touch tmp_output2.txt
 	if [ "$returnCode" = "0" ]; then
@@ -27,17 +30,41 @@ execTest () {
 	fi
 	printf "\n" >> tmp_output2.txt
 	if [ $returnCode -ne $4 ]; then
-		printf "\e[1m\e[31mFailed\e[0m Test %02d: $1:\n" $testNum
+		printf "\e[1m\e[31mFailed\e[0m Test %02d: $1$flagsSuffix:\n" $testNum
 		printf "\tWrong return code, expected $4, got $returnCode\n"
 	elif [ -z "$(diff --ignore-trailing-space --ignore-blank-lines tmp_output2.txt $3)" ]; then
-		printf "\e[1m\e[32mPassed\e[0m Test %02d: $1\n" $testNum
+		printf "\e[1m\e[32mPassed\e[0m Test %02d: $1$flagsSuffix\n" $testNum
 	else
-		printf "\e[1m\e[31mFailed\e[0m Test %02d: $1\n" $testNum
+		printf "\e[1m\e[31mFailed\e[0m Test %02d: $1$flagsSuffix\n" $testNum
 		diff tmp_output2.txt $3 | colordiff
 	fi
 	rm -f tmp_output.txt tmp_output2.txt
 }
 
+# arguments:
+# 1. name of test
+# 2. input file
+# 3. line expected among the statistics printed with -fstats
+statsTest () {
+	testNum=$((testNum+1))
+	if [ -n "$compilerFlags" ]; then
+		return;  # the statistics only depend on the default options
+	fi
+	if (( numberOfArgs > 0 )); then
+		if (( $testToRun != $testNum )); then
+			return;
+		fi
+	fi
+	echo -e "\e[33m--------------------------------\e[0m"
+	statistics=$(bash -c "$compilerPath -fstats < $2 2>&1 > /dev/null")
+	if grep --quiet --line-regexp --fixed-strings "$3" <<< "$statistics"; then
+		printf "\e[1m\e[32mPassed\e[0m Test %02d: $1\n" $testNum
+	else
+		printf "\e[1m\e[31mFailed\e[0m Test %02d: $1\n" $testNum
+		printf "\tExpected \"$3\" in:\n%s\n" "$statistics"
+	fi
+}
+
 execTest "Empty program" "input/empty.swift" "output/empty.txt" 0
 execTest "Unfinished multiline comment" "input/multiline_comment_unfinished.swift" "output/empty.txt" 1
 execTest "Legal variable names" "input/variable_name.swift" "output/empty.txt" 0
@@ -162,6 +189,7 @@ execTest "Escape sequence + ord" "input/escape_ord.swift" "output/escape_ord.txt
 execTest "Ord function with empty string" "input/ord_empty.swift" "output/empty.txt" 0
 execTest "Substring end out of bounds" "input/substring_oob.swift" "output/empty.txt" 0
 execTest "Implicit cast in nil coalescence" "input/implicit_cast_coal.swift" "output/empty.txt" 0
+execTest "Implicit cast of nil coalescence default" "input/implicit_cast_coal_nil.swift" "output/implicit_cast_coal_nil.txt" 0
 execTest "Wrong argument name" "input/func_wrong_arg_name.swift" "output/empty.txt" 9
 execTest "Unused param" "input/unused_param.swift" "output/empty.txt" 0
 execTest "Function param with same name" "input/func_param_same_name.swift" "output/empty.txt" 9
@@ -169,3 +197,31 @@ execTest "Implicit conversion when assigning" "input/assign_convert.swift" "outp
 execTest "Write nil" "input/print_nil.swift" "output/empty.txt" 0
 execTest "nil == nil" "input/nil_eq_nil.swift" "output/empty.txt" 0
 execTest "Opt type == non-opt type" "input/opt_eq_var.swift" "output/empty.txt" 0
+execTest "Deeply nested blocks" "input/deep_nesting.swift" "output/deep_nesting.txt" 0
+execTest "More functions than fit into a fixed-size table" "input/many_functions.swift" "output/many_functions.txt" 0
+execTest "Earliest error among function bodies" "input/parallel_first_error.swift" "output/empty.txt" 5
+execTest "Builtin function called as a procedure" "input/builtin_as_procedure.swift" "output/builtin_as_procedure.txt" 0
+execTest "Constant folding and propagation" "input/constant_folding.swift" "output/constant_folding.txt" 0
+execTest "Unreachable functions and statements" "input/dead_code.swift" "output/dead_code.txt" 0
+execTest "Dead stores and unused variables" "input/dead_stores.swift" "output/dead_stores.txt" 0
+execTest "Compile time evaluation of pure calls" "input/pure_calls.swift" "output/pure_calls.txt" 0
+execTest "Peephole rewrites of conditions and conversions" "input/peephole.swift" "output/peephole.txt" 0
+execTest "Jump chains, empty branches and unreachable code" "input/jump_chains.swift" "output/jump_chains.txt" 0
+execTest "Comparisons and optional bindings compiled into branches" "input/compare_branch.swift" "output/compare_branch.txt" 0
+execTest "Builtins compiled into shared subroutines" "input/runtime_library.swift" "output/runtime_library.txt" 0
+execTest "Small functions inlined at their call sites" "input/inline_functions.swift" "output/inline_functions.txt" 0
+execTest "Self calls in tail position reuse the frame" "input/tail_calls.swift" "output/tail_calls.txt" 0
+execTest "Loop invariants moved before loops" "input/loop_invariants.swift" "output/loop_invariants.txt" 0
+execTest "Repeated values in straight-line code reused" "input/common_subexpressions.swift" "output/common_subexpressions.txt" 0
+execTest "Algebraic identities and constant reassociation" "input/algebraic_simplification.swift" "output/algebraic_simplification.txt" 0
+statsTest "Nested constant operands reassociated" "input/algebraic_simplification.swift" "simplifier reassociations: 5"
+execTest "Int literals converted to doubles during compilation" "input/literal_conversion.swift" "output/literal_conversion.txt" 0
+execTest "If let over a nil constant" "input/if_let_nil_constant.swift" "output/if_let_nil_constant.txt" 0
+execTest "Same names declared in sibling blocks of a loop body" "input/loop_block_scopes.swift" "output/loop_block_scopes.txt" 0
+
+# the same programs again with the values kept in temporaries and without the optimiser
+if [ -z "$compilerFlags" ]; then
+	for flags in "-ftemporaries" "-O0" "-O0 -ftemporaries"; do
+		compilerFlags="$flags" bash "$0" "$@"
+	done
+fi